@@ -1,6 +1,8 @@
 #pragma once
 
 #include "ECS/Component.h"
+#include "ECS/StateHash.h"
+#include "ECS/Snapshot.h"
 #include <SDL3/SDL.h>
 
 namespace Lite2D {
@@ -38,6 +40,41 @@ public:
         return "Particle";
     }
     
+    void HashState(StateHasher& hasher) const override {
+        hasher.Add(radius);
+        hasher.Add(mass);
+        hasher.Add(lifetime);
+        hasher.Add(maxLifetime);
+        hasher.Add(isActive);
+        hasher.Add(collisionCount);
+    }
+    
+    void WriteSnapshot(SnapshotWriter& writer) const override {
+        writer.Write(radius);
+        writer.Write(mass);
+        writer.Write(lifetime);
+        writer.Write(maxLifetime);
+        writer.Write(r);
+        writer.Write(g);
+        writer.Write(b);
+        writer.Write(a);
+        writer.Write(isActive);
+        writer.Write(collisionCount);
+    }
+    
+    void ReadSnapshot(SnapshotReader& reader) override {
+        reader.Read(radius);
+        reader.Read(mass);
+        reader.Read(lifetime);
+        reader.Read(maxLifetime);
+        reader.Read(r);
+        reader.Read(g);
+        reader.Read(b);
+        reader.Read(a);
+        reader.Read(isActive);
+        reader.Read(collisionCount);
+    }
+    
     // Helper methods
     void UpdateLifetime(float deltaTime) {
         if (lifetime > 0.0f) {
@@ -53,6 +90,13 @@ public:
         isActive = true;
     }
     
+    // Park an expired particle for reuse: inactive, and no longer reported as expired
+    void Deactivate() {
+        lifetime = 0.0f;
+        maxLifetime = 0.0f;
+        isActive = false;
+    }
+    
     bool IsExpired() const {
         return lifetime <= 0.0f && maxLifetime > 0.0f;
     }
@@ -1,23 +1,36 @@
 #include "ParticleGame.h"
+#include "Utils/AllocationTracker.h"
+#include "Utils/timer.h"
+#include "Utils/Trace.h"
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
 #include <cmath>
+#include <random>
 
 namespace Lite2D {
 namespace ECS {
 
 ParticleGame::ParticleGame() 
-    : mWindow(nullptr), mRenderer(nullptr), mWindowWidth(1920), mWindowHeight(1080),
-      mIsRunning(false), mLastFrameTime(0.0f), mFPS(0.0f), mFPSTimer(0.0f), mFrameCount(0) {
+    : mWindow(nullptr), mRenderer(nullptr), mHeadless(false), mWindowWidth(1920), mWindowHeight(1080),
+      mIsRunning(false), mSeed(std::random_device{}()), mLastFrameTime(0.0f), mFPS(0.0f), mFPSTimer(0.0f), mFrameCount(0) {
 }
 
 ParticleGame::~ParticleGame() {
     Shutdown();
 }
 
-bool ParticleGame::Initialize(int windowWidth, int windowHeight) {
+bool ParticleGame::Initialize(int windowWidth, int windowHeight, bool headless) {
     mWindowWidth = windowWidth;
     mWindowHeight = windowHeight;
+    mHeadless = headless;
+    
+    if (mReplay.IsLoaded()) {
+        // Spawn areas and boundaries depend on the size; the replay only matches at the recorded one
+        mSeed = mReplay.GetSeed();
+        mWindowWidth = mReplay.GetViewWidth();
+        mWindowHeight = mReplay.GetViewHeight();
+    }
     
     if (!InitializeSDL()) {
         std::cerr << "Failed to initialize SDL" << std::endl;
@@ -30,15 +43,27 @@ bool ParticleGame::Initialize(int windowWidth, int windowHeight) {
     }
     
     ConfigureSystems();
+    ConfigureInput();
     InitializeParticles();
     
-    std::cout << "Particle Game initialized successfully!" << std::endl;
+    std::cout << "Particle Game initialized successfully! (seed " << mSeed << ")" << std::endl;
     PrintInstructions();
     
     return true;
 }
 
 bool ParticleGame::InitializeSDL() {
+    if (mHeadless) {
+        // Software renderer on an offscreen surface - no video subsystem or display needed
+        mHeadlessRenderer = std::make_unique<HeadlessRenderer>();
+        if (!mHeadlessRenderer->Initialize(mWindowWidth, mWindowHeight)) {
+            std::cerr << "Headless renderer could not be created! SDL_Error: " << SDL_GetError() << std::endl;
+            return false;
+        }
+        mRenderer = mHeadlessRenderer->GetRendererObject();
+        return true;
+    }
+    
     if (!SDL_Init(SDL_INIT_VIDEO | SDL_INIT_EVENTS)) {
         std::cerr << "SDL could not initialize! SDL_Error: " << SDL_GetError() << std::endl;
         return false;
@@ -65,6 +90,7 @@ bool ParticleGame::InitializeECS() {
     // Create ECS managers
     mEntityManager = std::make_unique<EntityManager>();
     mSystemManager = std::make_unique<SystemManager>();
+    mSystemManager->SetRandomSeed(mSeed);
     
     // Register systems
     mMovementSystem = mSystemManager->RegisterSystem<MovementSystem>();
@@ -114,6 +140,21 @@ void ParticleGame::ConfigureSystems() {
     mParticleSystem->SetLifetimeRange(15.0f, 45.0f);
     mParticleSystem->SetColorRange(100, 255, 100, 255, 100, 255, 180, 255);
     mParticleSystem->SetMaxParticles(500);
+    mParticleSystem->EnablePooling(true); // Recycle expired particles instead of destroying them
+}
+
+void ParticleGame::ConfigureInput() {
+    mActions.Clear();
+    mActions.BindKey(ACTION_QUIT, SDL_SCANCODE_ESCAPE);
+    mActions.BindKey(ACTION_BURST, SDL_SCANCODE_SPACE);
+    mActions.BindKey(ACTION_RESET, SDL_SCANCODE_R);
+    mActions.BindKey(ACTION_BASIC_DEMO, SDL_SCANCODE_1);
+    mActions.BindKey(ACTION_STRESS_TEST, SDL_SCANCODE_2);
+    mActions.BindKey(ACTION_BURST_DEMO, SDL_SCANCODE_3);
+    mActions.BindKey(ACTION_RAINBOW_DEMO, SDL_SCANCODE_4);
+    mActions.BindKey(ACTION_STATISTICS, SDL_SCANCODE_S);
+    mActions.BindKey(ACTION_REWIND, SDL_SCANCODE_BACKSPACE);
+    mActions.BindMouseButton(ACTION_SPAWN_AT_CURSOR, SDL_BUTTON_LEFT);
 }
 
 void ParticleGame::InitializeParticles() {
@@ -134,38 +175,152 @@ void ParticleGame::Run() {
     }
     
     while (mIsRunning) {
-        HandleEvents();
+        PollEvents();
         
         float currentTime = SDL_GetTicks() / 1000.0f;
         float deltaTime = currentTime - mLastFrameTime;
         mLastFrameTime = currentTime;
         
+        mRecorder.RecordFrame(deltaTime, mFrameEvents.data(), mFrameEvents.size());
+        HandleEvents(mFrameEvents.data(), mFrameEvents.size());
+        
         Update(deltaTime);
         Render();
+        AllocationTracker::MarkFrame();
         
         // Cap frame rate to ~60 FPS
         SDL_Delay(16);
     }
 }
 
-void ParticleGame::HandleEvents() {
+void ParticleGame::RunHeadless(int frameCount, float fixedDeltaTime) {
+    if (mReplay.IsLoaded()) {
+        frameCount = static_cast<int>(mReplay.GetFrameCount());
+        mReplay.Restart();
+        std::cout << "Replaying " << frameCount << " recorded frames (" << mReplay.GetEventCount() 
+                  << " input events)..." << std::endl;
+    } else {
+        std::cout << "Running " << frameCount << " headless frames..." << std::endl;
+    }
+    mIsRunning = true;
+    
+    // Per-system timing for the run, reported below
+    mSystemManager->EnableProfiling(true);
+    mSystemManager->ResetProfiling();
+    
+    Timer timer;
+    timer.Start();
+    
+    // Heap traffic per frame (LITE2D_TRACK_ALLOCATIONS builds only)
+    size_t totalAllocations = 0;
+    size_t totalBytes = 0;
+    size_t maxFrameAllocations = 0;
+    AllocationTracker::MarkFrame();
+    
+    int framesRun = 0;
+    for (; framesRun < frameCount && mIsRunning; ++framesRun) {
+        float deltaTime = fixedDeltaTime;
+        const SDL_Event* events = nullptr;
+        size_t eventCount = 0;
+        if (mReplay.IsLoaded()) {
+            mReplay.NextFrame(deltaTime, events, eventCount);
+        }
+        mRecorder.RecordFrame(deltaTime, events, eventCount);
+        HandleEvents(events, eventCount);
+        
+        Update(deltaTime);
+        Render();
+        
+        AllocationTracker::AllocationStats heap = AllocationTracker::MarkFrame();
+        totalAllocations += heap.allocations;
+        totalBytes += heap.bytes;
+        maxFrameAllocations = std::max(maxFrameAllocations, heap.allocations);
+    }
+    
+    frameCount = framesRun;
+    mIsRunning = false;
+    double elapsedMs = timer.GetElapsedSeconds() * 1000.0;
+    double frameMs = frameCount > 0 ? elapsedMs / frameCount : 0.0;
+    
+    std::cout << "\n=== Headless Run Results ===" << std::endl;
+    std::cout << "Frames: " << frameCount << std::endl;
+    std::cout << "Total Time: " << std::fixed << std::setprecision(2) << elapsedMs << "ms" << std::endl;
+    std::cout << "Average Frame Time: " << std::setprecision(3) << frameMs << "ms" << std::endl;
+    std::cout << "Active Particles: " << mParticleSystem->GetActiveParticleCount() << std::endl;
+    if (AllocationTracker::IsEnabled() && frameCount > 0) {
+        std::cout << "Heap Allocations/Frame: " << std::setprecision(1) 
+                  << static_cast<double>(totalAllocations) / frameCount
+                  << " avg (" << totalBytes / frameCount << " bytes), " 
+                  << maxFrameAllocations << " max" << std::endl;
+    }
+    if (mRewindEnabled) {
+        std::cout << "Rewind History: " << mRewind.GetDepth() << " frames, " 
+                  << mRewind.GetMemoryUsage() / 1024 << " KB (last frame " << mRewind.GetLastDirtyPageCount() 
+                  << "/" << mRewind.GetLastPageCount() << " pages dirty)" << std::endl;
+    }
+    if (mHeadlessRenderer) {
+        std::cout << "Framebuffer Checksum: " << std::hex << mHeadlessRenderer->ComputeChecksum() 
+                  << std::dec << std::endl;
+    }
+    // Same seed and frame count must reproduce this exactly (see Lockstep)
+    std::cout << "State Hash: " << std::hex << ComputeStateHash() << std::dec 
+              << " (seed " << mSeed << ")" << std::endl;
+    std::cout << "============================\n" << std::endl;
+    
+    mSystemManager->PrintSystemInfo();
+    mSystemManager->EnableProfiling(false);
+}
+
+uint64_t ParticleGame::ComputeStateHash() const {
+    StateHasher hasher(mSeed);
+    hasher.Add(mDemoTimer);
+    mEntityManager->HashState(hasher);
+    mSystemManager->HashState(hasher);
+    return hasher.GetHash();
+}
+
+void ParticleGame::StartRecording() {
+    mRecorder.Begin(mSeed, mWindowWidth, mWindowHeight);
+    std::cout << "Recording input (seed " << mSeed << ")" << std::endl;
+}
+
+bool ParticleGame::SaveRecording(const std::string& path) {
+    mRecorder.Stop();
+    if (!mRecorder.SaveToFile(path)) {
+        return false;
+    }
+    std::cout << "Input recording written to " << path << " (" << mRecorder.GetFrameCount() << " frames, " 
+              << mRecorder.GetSize() << " bytes, state hash " << std::hex << ComputeStateHash() << std::dec 
+              << ")" << std::endl;
+    return true;
+}
+
+bool ParticleGame::LoadReplay(const std::string& path) {
+    if (!mReplay.LoadFromFile(path)) {
+        std::cerr << "Failed to load input recording: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void ParticleGame::PollEvents() {
+    mFrameEvents.clear();
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
+        mFrameEvents.push_back(event);
+    }
+}
+
+void ParticleGame::HandleEvents(const SDL_Event* events, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const SDL_Event& event = events[i];
+        mInput.FeedEvent(event);
+        
         switch (event.type) {
             case SDL_EVENT_QUIT:
                 mIsRunning = false;
                 break;
                 
-            case SDL_EVENT_KEY_DOWN:
-                HandleKeyboardInput();
-                break;
-                
-            case SDL_EVENT_MOUSE_BUTTON_DOWN:
-                if (event.button.button == SDL_BUTTON_LEFT) {
-                    HandleMouseInput(event.button.x, event.button.y, true);
-                }
-                break;
-                
             case SDL_EVENT_WINDOW_RESIZED:
                 mWindowWidth = event.window.data1;
                 mWindowHeight = event.window.data2;
@@ -176,47 +331,57 @@ void ParticleGame::HandleEvents() {
                 break;
         }
     }
+    
+    // Act on this frame's presses, then age them for the next frame
+    HandleKeyboardInput();
+    int mouseX = 0;
+    int mouseY = 0;
+    mInput.GetMousePosition(mouseX, mouseY);
+    HandleMouseInput(mouseX, mouseY, mActions.IsPressed(ACTION_SPAWN_AT_CURSOR));
+    mInput.Update();
 }
 
 void ParticleGame::HandleKeyboardInput() {
-    const bool* keystate = SDL_GetKeyboardState(nullptr);
-    
-    if (keystate[SDL_SCANCODE_ESCAPE]) {
+    if (mActions.IsPressed(ACTION_QUIT)) {
         mIsRunning = false;
     }
     
-    if (keystate[SDL_SCANCODE_SPACE]) {
+    if (mActions.IsPressed(ACTION_BURST)) {
         // Spawn particle burst at center
         mParticleSystem->SpawnParticleBurst(*mEntityManager, 20, 
                                            mWindowWidth / 2.0f, mWindowHeight / 2.0f);
     }
     
-    if (keystate[SDL_SCANCODE_R]) {
+    if (mActions.IsPressed(ACTION_RESET)) {
         // Reset/clear all particles
         mParticleSystem->ClearAllParticles(*mEntityManager);
         mCollisionSystem->ResetCollisionCount();
         mParticleSystem->ResetStatistics();
     }
     
-    if (keystate[SDL_SCANCODE_1]) {
+    if (mActions.IsPressed(ACTION_BASIC_DEMO)) {
         SetDemoMode(BASIC_DEMO);
     }
     
-    if (keystate[SDL_SCANCODE_2]) {
+    if (mActions.IsPressed(ACTION_STRESS_TEST)) {
         SetDemoMode(STRESS_TEST);
     }
     
-    if (keystate[SDL_SCANCODE_3]) {
+    if (mActions.IsPressed(ACTION_BURST_DEMO)) {
         SetDemoMode(BURST_DEMO);
     }
     
-    if (keystate[SDL_SCANCODE_4]) {
+    if (mActions.IsPressed(ACTION_RAINBOW_DEMO)) {
         SetDemoMode(RAINBOW_DEMO);
     }
     
-    if (keystate[SDL_SCANCODE_S]) {
+    if (mActions.IsPressed(ACTION_STATISTICS)) {
         PrintStatistics();
     }
+    
+    if (mActions.IsPressed(ACTION_REWIND)) {
+        RewindFrames(REWIND_STEP_FRAMES);
+    }
 }
 
 void ParticleGame::HandleMouseInput(int mouseX, int mouseY, bool leftClick) {
@@ -227,6 +392,7 @@ void ParticleGame::HandleMouseInput(int mouseX, int mouseY, bool leftClick) {
 }
 
 void ParticleGame::Update(float deltaTime) {
+    LITE2D_TRACE_SCOPE("ParticleGame::Update");
     // Update systems
     mSystemManager->UpdateSystems(*mEntityManager, deltaTime);
     
@@ -241,49 +407,111 @@ void ParticleGame::Update(float deltaTime) {
     
     // Update demo mode
     UpdateDemoMode(deltaTime);
+    
+    if (mRewindEnabled) {
+        RecordRewindFrame();
+    }
+}
+
+void ParticleGame::RecordRewindFrame() {
+    mSnapshotScratch.Clear();
+    SaveRewindState(mSnapshotScratch);
+    mRewind.Push(mSnapshotScratch);
+}
+
+// Layout: demo timer, mode, system table, entities, systems
+void ParticleGame::SaveRewindState(SnapshotWriter& writer) const {
+    writer.Write(mDemoTimer);
+    writer.Write(static_cast<int32_t>(mCurrentMode));
+    mSystemManager->SaveSystemTable(writer);
+    mEntityManager->SaveSnapshot(writer);
+    mSystemManager->SaveSnapshot(writer);
+}
+
+// With checkOnly, reads no further than the system table and changes nothing
+bool ParticleGame::LoadRewindState(SnapshotReader& reader, bool checkOnly) {
+    float demoTimer = 0.0f;
+    int32_t mode = BASIC_DEMO;
+    reader.Read(demoTimer);
+    reader.Read(mode);
+    if (!reader.IsOk() || !mSystemManager->CheckSystemTable(reader)) {
+        return false;
+    }
+    if (checkOnly) {
+        return true;
+    }
+    if (!mEntityManager->LoadSnapshot(reader) || !mSystemManager->LoadSnapshot(reader)) {
+        return false;
+    }
+    
+    mDemoTimer = demoTimer;
+    mCurrentMode = static_cast<DemoMode>(mode);
+    return true;
+}
+
+bool ParticleGame::RewindFrames(int frames) {
+    if (!mRewindEnabled) {
+        std::cout << "Rewind is off (run with --rewind)" << std::endl;
+        return false;
+    }
+    frames = std::min(frames, static_cast<int>(mRewind.GetDepth()));
+    if (frames <= 0 || !mRewind.ReadFrame(static_cast<size_t>(frames), mRewindFrame)) {
+        return false;
+    }
+    
+    // A different system set is refused up front. Past that, the current state is
+    // kept to go back to if the frame fails part way. The history is only consumed
+    // once the frame has loaded.
+    SnapshotReader check(mRewindFrame.data(), mRewindFrame.size());
+    if (!LoadRewindState(check, true)) {
+        std::cerr << "Rewind failed: the snapshot is from a different set of systems" << std::endl;
+        return false;
+    }
+    mSnapshotScratch.Clear();
+    SaveRewindState(mSnapshotScratch);
+    SnapshotReader reader(mRewindFrame.data(), mRewindFrame.size());
+    if (!LoadRewindState(reader, false)) {
+        SnapshotReader restore(mSnapshotScratch.GetData(), mSnapshotScratch.GetSize());
+        LoadRewindState(restore, false);
+        std::cerr << "Rewind failed to restore the snapshot" << std::endl;
+        return false;
+    }
+    mRewind.Rewind(static_cast<size_t>(frames));
+    
+    std::cout << "Rewound " << frames << " frames (" << mRewind.GetDepth() << " left, "
+              << mRewind.GetMemoryUsage() / 1024 << " KB)" << std::endl;
+    return true;
 }
 
 void ParticleGame::Render() {
+    LITE2D_TRACE_SCOPE("ParticleGame::Render");
     // Clear the screen with background color
     SDL_SetRenderDrawColor(mRenderer, 10, 10, 20, 255); // Dark blue background
     SDL_RenderClear(mRenderer);
     
-    // Render all particles
-    auto entities = mEntityManager->GetEntitiesWith<Position, Renderable, Particle>();
+    // Batch all particles
+    auto entities = mEntityManager->GetFrameEntitiesWith<Position, Renderable, Particle>();
+    mParticleShapes.Clear();
+    mCommandList.Clear();
     
     for (Entity entity : entities) {
         Position* pos = mEntityManager->GetComponent<Position>(entity);
         Particle* particle = mEntityManager->GetComponent<Particle>(entity);
         
         if (pos && particle && particle->isActive) {
-            // Set particle color
-            SDL_SetRenderDrawColor(mRenderer, particle->r, particle->g, particle->b, particle->a);
-            
             // Render particle as a solid filled circle
-            float radius = particle->radius;
-            if (radius <= 0) continue; // Skip invalid radius
-            
-            float centerX = pos->x;
-            float centerY = pos->y;
-            
-            // Draw a solid filled circle using a simple but effective method
-            // We'll draw the circle by filling it row by row
-            int radiusInt = static_cast<int>(radius);
+            if (particle->radius <= 0) continue; // Skip invalid radius
             
-            for (int y = -radiusInt; y <= radiusInt; y++) {
-                int x = static_cast<int>(std::sqrt(radius * radius - y * y));
-                if (x > 0) {
-                    // Draw a horizontal line across the circle at this y position
-                    SDL_FRect lineRect = {
-                        centerX - x, centerY + y,
-                        x * 2.0f, 1.0f
-                    };
-                    SDL_RenderFillRect(mRenderer, &lineRect);
-                }
-            }
+            SDL_Color color = {particle->r, particle->g, particle->b, particle->a};
+            mParticleShapes.AddCircle(pos->x, pos->y, particle->radius, color);
         }
     }
     
+    // Every particle goes out in a single SDL_RenderGeometry call
+    const VertexBuffer& geometry = mParticleShapes.GetGeometry();
+    mCommandList.RecordGeometry(0, &geometry, 0, geometry.GetIndexCount());
+    mCommandList.Submit(mRenderer);
+    
     // Present the frame
     SDL_RenderPresent(mRenderer);
 }
@@ -322,14 +550,13 @@ void ParticleGame::SetDemoMode(DemoMode mode) {
 
 void ParticleGame::UpdateDemoMode(float deltaTime) {
     // Demo-specific logic can be added here
-    static float demoTimer = 0.0f;
-    demoTimer += deltaTime;
+    mDemoTimer += deltaTime;
     
-    if (mCurrentMode == BURST_DEMO && demoTimer >= 3.0f) {
+    if (mCurrentMode == BURST_DEMO && mDemoTimer >= 3.0f) {
         // Spawn new bursts periodically
         mParticleSystem->SpawnParticleBurst(*mEntityManager, 30, 
                                            mWindowWidth / 2.0f, mWindowHeight / 2.0f);
-        demoTimer = 0.0f;
+        mDemoTimer = 0.0f;
     }
 }
 
@@ -343,6 +570,7 @@ void ParticleGame::PrintInstructions() {
     std::cout << "3: Burst Demo Mode" << std::endl;
     std::cout << "4: Rainbow Demo Mode" << std::endl;
     std::cout << "S: Print Statistics" << std::endl;
+    std::cout << "BACKSPACE: Rewind 1 second" << (mRewindEnabled ? "" : " (needs --rewind)") << std::endl;
     std::cout << "ESC: Exit" << std::endl;
     std::cout << "=====================================\n" << std::endl;
 }
@@ -354,6 +582,10 @@ void ParticleGame::PrintStatistics() {
     std::cout << "Total Spawned: " << mParticleSystem->GetTotalParticlesSpawned() << std::endl;
     std::cout << "Collisions This Frame: " << mCollisionSystem->GetCollisionCount() << std::endl;
     std::cout << "Window Size: " << mWindowWidth << "x" << mWindowHeight << std::endl;
+    if (mRewindEnabled) {
+        std::cout << "Rewind History: " << mRewind.GetDepth() << " frames, " 
+                  << mRewind.GetMemoryUsage() / 1024 << " KB of " << mRewind.GetMaxBytes() / 1024 << " KB" << std::endl;
+    }
     std::cout << "===================================\n" << std::endl;
 }
 
@@ -363,6 +595,12 @@ void ParticleGame::Shutdown() {
 }
 
 void ParticleGame::CleanupSDL() {
+    if (mHeadlessRenderer) {
+        // The headless renderer owns its SDL_Renderer
+        mRenderer = nullptr;
+        mHeadlessRenderer.reset();
+    }
+    
     if (mRenderer) {
         SDL_DestroyRenderer(mRenderer);
         mRenderer = nullptr;
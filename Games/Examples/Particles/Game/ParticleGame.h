@@ -2,11 +2,20 @@
 
 #include "ECS/EntityManager.h"
 #include "ECS/SystemManager.h"
+#include "ECS/RewindBuffer.h"
 #include "ECS/Systems/MovementSystem.h"
 #include "Rendering/RenderSystem.h"
+#include "Rendering/HeadlessRenderer.h"
+#include "Rendering/RenderCommandList.h"
+#include "Rendering/ShapeBatcher.h"
+#include "Input/InputManager.h"
+#include "Input/ActionMap.h"
+#include "Input/InputRecording.h"
 #include "../Systems/CollisionSystem.h"
 #include "../Systems/ParticleSystem.h"
 #include <SDL3/SDL.h>
+#include <string>
+#include <vector>
 
 namespace Lite2D {
 namespace ECS {
@@ -21,10 +30,35 @@ public:
     ~ParticleGame();
     
     // Game lifecycle
-    bool Initialize(int windowWidth = 1920, int windowHeight = 1080);
+    bool Initialize(int windowWidth = 1920, int windowHeight = 1080, bool headless = false);
     void Run();
+    
+    // Fixed-step loop without window, event polling or frame cap (benchmarking / CI).
+    // With a replay loaded, plays the recorded frames and timesteps instead.
+    void RunHeadless(int frameCount, float fixedDeltaTime = 1.0f / 60.0f);
     void Shutdown();
     
+    // Seed for every system's random stream; call before Initialize. Random per run unless set.
+    void SetSeed(uint64_t seed) { mSeed = seed; }
+    uint64_t GetSeed() const { return mSeed; }
+    
+    // Per-frame rewind history (BACKSPACE). Off by default: recording serializes and compares
+    // the whole world every frame and holds up to 64 MB, which would skew frame-time numbers.
+    void EnableRewind(bool enable) { mRewindEnabled = enable; }
+    bool IsRewindEnabled() const { return mRewindEnabled; }
+    
+    // Lockstep hash of all simulation state, printed at the end of headless runs
+    uint64_t ComputeStateHash() const;
+    
+    // Input recording: call StartRecording after Initialize, SaveRecording after the run
+    void StartRecording();
+    bool SaveRecording(const std::string& path);
+    
+    // Loads a recording to replay; call before Initialize, which then takes the
+    // recorded seed and window size so the replay matches the recorded run
+    bool LoadReplay(const std::string& path);
+    bool IsReplaying() const { return mReplay.IsLoaded(); }
+    
     // Game state
     bool IsRunning() const { return mIsRunning; }
     void Stop() { mIsRunning = false; }
@@ -34,14 +68,36 @@ private:
     SDL_Window* mWindow;
     SDL_Renderer* mRenderer;
     
+    // Offscreen target used instead of a window in headless mode
+    std::unique_ptr<HeadlessRenderer> mHeadlessRenderer;
+    bool mHeadless;
+    
     // ECS components
     std::unique_ptr<EntityManager> mEntityManager;
     std::unique_ptr<SystemManager> mSystemManager;
     
+    // Input state fed from live or replayed events; events of the current frame
+    InputManager mInput;
+    ActionMap mActions{mInput};
+    std::vector<SDL_Event> mFrameEvents;
+    InputRecorder mRecorder;
+    InputPlayer mReplay;
+    
+    // Per-frame snapshot history when enabled; BACKSPACE rewinds one second
+    bool mRewindEnabled = false;
+    RewindBuffer mRewind;
+    SnapshotWriter mSnapshotScratch;
+    std::vector<uint8_t> mRewindFrame;
+    
+    // Particle circles batched into one mesh and replayed through the command list
+    ShapeBatcher mParticleShapes;
+    RenderCommandList mCommandList;
+    
     // Game configuration
     int mWindowWidth;
     int mWindowHeight;
     bool mIsRunning;
+    uint64_t mSeed;
     
     // Timing
     float mLastFrameTime;
@@ -56,7 +112,8 @@ private:
     std::shared_ptr<ParticleSystem> mParticleSystem;
     
     // Game loop
-    void HandleEvents();
+    void PollEvents();
+    void HandleEvents(const SDL_Event* events, size_t count);
     void Update(float deltaTime);
     void Render();
     
@@ -70,6 +127,19 @@ private:
     void CleanupECS();
     
     // Input handling
+    enum InputAction {
+        ACTION_QUIT,
+        ACTION_BURST,
+        ACTION_RESET,
+        ACTION_BASIC_DEMO,
+        ACTION_STRESS_TEST,
+        ACTION_BURST_DEMO,
+        ACTION_RAINBOW_DEMO,
+        ACTION_STATISTICS,
+        ACTION_REWIND,
+        ACTION_SPAWN_AT_CURSOR
+    };
+    void ConfigureInput();
     void HandleKeyboardInput();
     void HandleMouseInput(int mouseX, int mouseY, bool leftClick);
     
@@ -86,8 +156,16 @@ private:
         RAINBOW_DEMO
     };
     DemoMode mCurrentMode = BASIC_DEMO;
+    float mDemoTimer = 0.0f;
     void SetDemoMode(DemoMode mode);
     void UpdateDemoMode(float deltaTime);
+    
+    // Rewind: whole-simulation snapshot after every update
+    static constexpr int REWIND_STEP_FRAMES = 60;
+    void RecordRewindFrame();
+    bool RewindFrames(int frames);
+    void SaveRewindState(SnapshotWriter& writer) const;
+    bool LoadRewindState(SnapshotReader& reader, bool checkOnly);
 };
 
 } // namespace ECS
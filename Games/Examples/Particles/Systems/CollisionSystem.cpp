@@ -50,7 +50,7 @@ void CollisionSystem::SetBoundaries(float minX, float minY, float maxX, float ma
 
 void CollisionSystem::UpdateParticleList(EntityManager& entityManager) {
     mParticleEntities.clear();
-    auto entities = entityManager.GetEntitiesWith<Position, Velocity, Particle>();
+    auto entities = entityManager.GetFrameEntitiesWith<Position, Velocity, Particle>();
     
     for (Entity entity : entities) {
         Particle* particle = entityManager.GetComponent<Particle>(entity);
@@ -58,6 +58,8 @@ void CollisionSystem::UpdateParticleList(EntityManager& entityManager) {
             mParticleEntities.push_back(entity);
         }
     }
+    
+    mProcessedEntityCount = mParticleEntities.size();
 }
 
 bool CollisionSystem::CheckParticleCollision(EntityManager& entityManager, Entity entity1, Entity entity2) {
@@ -109,8 +111,8 @@ void CollisionSystem::ResolveParticleCollision(EntityManager& entityManager, Ent
     
     if (distance == 0.0f) {
         // Handle edge case where particles are exactly on top of each other
-        dx = (rand() % 2 == 0) ? 1.0f : -1.0f;
-        dy = (rand() % 2 == 0) ? 1.0f : -1.0f;
+        dx = mRandom.NextBool() ? 1.0f : -1.0f;
+        dy = mRandom.NextBool() ? 1.0f : -1.0f;
         distance = std::sqrt(dx * dx + dy * dy);
     }
     
@@ -9,8 +9,9 @@ void ParticleSystem::Update(EntityManager& entityManager, float deltaTime) {
     if (!mEnabled) return;
     
     // Update particle lifetimes and remove expired ones
-    auto entities = entityManager.GetEntitiesWith<Position, Particle>();
-    for (Entity entity : entities) {
+    entityManager.GetEntitiesWith<Position, Particle>(mQueryScratch);
+    mProcessedEntityCount = mQueryScratch.size();
+    for (Entity entity : mQueryScratch) {
         Particle* particle = entityManager.GetComponent<Particle>(entity);
         if (particle) {
             particle->UpdateLifetime(deltaTime);
@@ -32,7 +33,6 @@ void ParticleSystem::Update(EntityManager& entityManager, float deltaTime) {
 
 void ParticleSystem::Initialize(EntityManager& entityManager) {
     std::cout << "ParticleSystem initialized" << std::endl;
-    mRandomGenerator = std::mt19937(mRandomDevice());
 }
 
 void ParticleSystem::Shutdown(EntityManager& entityManager) {
@@ -42,6 +42,11 @@ void ParticleSystem::Shutdown(EntityManager& entityManager) {
 
 void ParticleSystem::SpawnParticle(EntityManager& entityManager, float x, float y, 
                                   float velX, float velY, float radius, float mass) {
+    if (mPoolingEnabled && !mFreeParticles.empty()) {
+        RespawnPooledParticle(entityManager, x, y, velX, velY, radius, mass);
+        return;
+    }
+    
     Entity entity = entityManager.CreateEntity();
     
     // Add components
@@ -58,6 +63,36 @@ void ParticleSystem::SpawnParticle(EntityManager& entityManager, float x, float
     mTotalParticlesSpawned++;
 }
 
+void ParticleSystem::RespawnPooledParticle(EntityManager& entityManager, float x, float y,
+                                           float velX, float velY, float radius, float mass) {
+    Entity entity = mFreeParticles.back();
+    mFreeParticles.pop_back();
+    
+    // Overwrite the parked components in place
+    Position* position = entityManager.GetComponent<Position>(entity);
+    Velocity* velocity = entityManager.GetComponent<Velocity>(entity);
+    Renderable* renderable = entityManager.GetComponent<Renderable>(entity);
+    Particle* particle = entityManager.GetComponent<Particle>(entity);
+    
+    position->x = x;
+    position->y = y;
+    velocity->x = velX;
+    velocity->y = velY;
+    renderable->visible = true;
+    
+    particle->radius = radius;
+    particle->mass = mass;
+    particle->r = GetRandomUint8(mMinR, mMaxR);
+    particle->g = GetRandomUint8(mMinG, mMaxG);
+    particle->b = GetRandomUint8(mMinB, mMaxB);
+    particle->a = GetRandomUint8(mMinA, mMaxA);
+    particle->collisionCount = 0;
+    particle->maxLifetime = GetRandomFloat(mMinLifetime, mMaxLifetime);
+    particle->ResetLifetime();
+    
+    mTotalParticlesSpawned++;
+}
+
 void ParticleSystem::SpawnRandomParticle(EntityManager& entityManager) {
     float x = GetRandomFloat(mSpawnMinX, mSpawnMaxX);
     float y = GetRandomFloat(mSpawnMinY, mSpawnMaxY);
@@ -70,35 +105,62 @@ void ParticleSystem::SpawnRandomParticle(EntityManager& entityManager) {
 }
 
 void ParticleSystem::SpawnParticleBurst(EntityManager& entityManager, int count, float centerX, float centerY) {
-    for (int i = 0; i < count; ++i) {
+    if (count <= 0) return;
+    
+    // Draw every random attribute of the burst up front in vectorized batches
+    const size_t n = static_cast<size_t>(count);
+    if (mBurstScratch.size() < n * 6) {
+        mBurstScratch.resize(n * 6);
+    }
+    float* angles = mBurstScratch.data();
+    float* distances = angles + n;
+    float* speedsX = distances + n;
+    float* speedsY = speedsX + n;
+    float* radii = speedsY + n;
+    float* masses = radii + n;
+    mRandom.Fill(angles, n, 0.0f, 2.0f * static_cast<float>(M_PI));
+    mRandom.Fill(distances, n, 0.0f, 50.0f);
+    mRandom.Fill(speedsX, n, mMinVelocity, mMaxVelocity);
+    mRandom.Fill(speedsY, n, mMinVelocity, mMaxVelocity);
+    mRandom.Fill(radii, n, mMinRadius, mMaxRadius);
+    mRandom.Fill(masses, n, mMinMass, mMaxMass);
+    
+    for (size_t i = 0; i < n; ++i) {
         // Spawn particles in a circular pattern around the center
-        float angle = GetRandomFloat(0.0f, 2.0f * M_PI);
-        float distance = GetRandomFloat(0.0f, 50.0f);
-        float x = centerX + std::cos(angle) * distance;
-        float y = centerY + std::sin(angle) * distance;
-        
-        float velX = std::cos(angle) * GetRandomFloat(mMinVelocity, mMaxVelocity);
-        float velY = std::sin(angle) * GetRandomFloat(mMinVelocity, mMaxVelocity);
-        
-        float radius = GetRandomFloat(mMinRadius, mMaxRadius);
-        float mass = GetRandomFloat(mMinMass, mMaxMass);
+        float cosAngle = std::cos(angles[i]);
+        float sinAngle = std::sin(angles[i]);
+        float x = centerX + cosAngle * distances[i];
+        float y = centerY + sinAngle * distances[i];
         
-        SpawnParticle(entityManager, x, y, velX, velY, radius, mass);
+        SpawnParticle(entityManager, x, y, cosAngle * speedsX[i], sinAngle * speedsY[i], radii[i], masses[i]);
     }
 }
 
 void ParticleSystem::RemoveExpiredParticles(EntityManager& entityManager) {
-    auto entities = entityManager.GetEntitiesWith<Particle>();
-    std::vector<Entity> toRemove;
+    entityManager.GetEntitiesWith<Particle>(mQueryScratch);
+    mExpiredScratch.clear();
     
-    for (Entity entity : entities) {
+    for (Entity entity : mQueryScratch) {
         Particle* particle = entityManager.GetComponent<Particle>(entity);
         if (particle && particle->IsExpired()) {
-            toRemove.push_back(entity);
+            mExpiredScratch.push_back(entity);
         }
     }
     
-    for (Entity entity : toRemove) {
+    if (mPoolingEnabled) {
+        for (Entity entity : mExpiredScratch) {
+            // Parked particles keep their components but stop moving and drawing
+            entityManager.GetComponent<Particle>(entity)->Deactivate();
+            entityManager.GetComponent<Renderable>(entity)->visible = false;
+            Velocity* velocity = entityManager.GetComponent<Velocity>(entity);
+            velocity->x = 0.0f;
+            velocity->y = 0.0f;
+            mFreeParticles.push_back(entity);
+        }
+        return;
+    }
+    
+    for (Entity entity : mExpiredScratch) {
         entityManager.DestroyEntity(entity);
     }
 }
@@ -108,6 +170,7 @@ void ParticleSystem::ClearAllParticles(EntityManager& entityManager) {
     for (Entity entity : entities) {
         entityManager.DestroyEntity(entity);
     }
+    mFreeParticles.clear();
     mActiveParticleCount = 0;
 }
 
@@ -152,31 +215,68 @@ void ParticleSystem::EnableAutoSpawn(bool enable, float interval) {
     mAutoSpawnTimer = 0.0f;
 }
 
-void ParticleSystem::ResetStatistics() {
-    mActiveParticleCount = 0;
-    mTotalParticlesSpawned = 0;
+void ParticleSystem::HashState(StateHasher& hasher) const {
+    hasher.Add(mAutoSpawnEnabled);
+    hasher.Add(mAutoSpawnTimer);
+    hasher.Add(mMaxParticles);
+    hasher.Add(mTotalParticlesSpawned);
+    hasher.AddBytes(mFreeParticles.data(), mFreeParticles.size() * sizeof(Entity));
 }
 
-float ParticleSystem::GetRandomFloat(float min, float max) {
-    std::uniform_real_distribution<float> distribution(min, max);
-    return distribution(mRandomGenerator);
+void ParticleSystem::WriteSnapshot(SnapshotWriter& writer) const {
+    // Demo modes change the spawn settings at runtime, so they are state too
+    const float ranges[] = { mSpawnMinX, mSpawnMinY, mSpawnMaxX, mSpawnMaxY, mMinVelocity, mMaxVelocity,
+                             mMinRadius, mMaxRadius, mMinMass, mMaxMass, mMinLifetime, mMaxLifetime };
+    const Uint8 colors[] = { mMinR, mMaxR, mMinG, mMaxG, mMinB, mMaxB, mMinA, mMaxA };
+    writer.Write(ranges);
+    writer.Write(colors);
+    writer.Write(mAutoSpawnEnabled);
+    writer.Write(mAutoSpawnInterval);
+    writer.Write(mAutoSpawnTimer);
+    writer.Write(mMaxParticles);
+    writer.Write(mActiveParticleCount);
+    writer.Write(mTotalParticlesSpawned);
+    writer.Write(mPoolingEnabled);
+    writer.WriteVector(mFreeParticles);
 }
 
-int ParticleSystem::GetRandomInt(int min, int max) {
-    std::uniform_int_distribution<int> distribution(min, max);
-    return distribution(mRandomGenerator);
+void ParticleSystem::ReadSnapshot(SnapshotReader& reader) {
+    float ranges[12];
+    Uint8 colors[8];
+    reader.Read(ranges);
+    reader.Read(colors);
+    reader.Read(mAutoSpawnEnabled);
+    reader.Read(mAutoSpawnInterval);
+    reader.Read(mAutoSpawnTimer);
+    reader.Read(mMaxParticles);
+    reader.Read(mActiveParticleCount);
+    reader.Read(mTotalParticlesSpawned);
+    reader.Read(mPoolingEnabled);
+    reader.ReadVector(mFreeParticles, MAX_ENTITIES);
+    if (!reader.IsOk()) return;
+    
+    mSpawnMinX = ranges[0];    mSpawnMinY = ranges[1];
+    mSpawnMaxX = ranges[2];    mSpawnMaxY = ranges[3];
+    mMinVelocity = ranges[4];  mMaxVelocity = ranges[5];
+    mMinRadius = ranges[6];    mMaxRadius = ranges[7];
+    mMinMass = ranges[8];      mMaxMass = ranges[9];
+    mMinLifetime = ranges[10]; mMaxLifetime = ranges[11];
+    mMinR = colors[0]; mMaxR = colors[1];
+    mMinG = colors[2]; mMaxG = colors[3];
+    mMinB = colors[4]; mMaxB = colors[5];
+    mMinA = colors[6]; mMaxA = colors[7];
 }
 
-Uint8 ParticleSystem::GetRandomUint8(Uint8 min, Uint8 max) {
-    std::uniform_int_distribution<Uint8> distribution(min, max);
-    return distribution(mRandomGenerator);
+void ParticleSystem::ResetStatistics() {
+    mActiveParticleCount = 0;
+    mTotalParticlesSpawned = 0;
 }
 
 void ParticleSystem::UpdateStatistics(EntityManager& entityManager) {
-    auto entities = entityManager.GetEntitiesWith<Particle>();
+    entityManager.GetEntitiesWith<Particle>(mQueryScratch);
     mActiveParticleCount = 0;
     
-    for (Entity entity : entities) {
+    for (Entity entity : mQueryScratch) {
         Particle* particle = entityManager.GetComponent<Particle>(entity);
         if (particle && particle->isActive) {
             mActiveParticleCount++;
@@ -7,7 +7,6 @@
 #include "ECS/Components/Renderable.h"
 #include "../Components/Particle.h"
 #include <vector>
-#include <random>
 #include <SDL3/SDL.h>
 
 namespace Lite2D {
@@ -27,6 +26,9 @@ public:
     void Initialize(EntityManager& entityManager) override;
     void Shutdown(EntityManager& entityManager) override;
     const char* GetName() const override { return "ParticleSystem"; }
+    void HashState(StateHasher& hasher) const override;
+    void WriteSnapshot(SnapshotWriter& writer) const override;
+    void ReadSnapshot(SnapshotReader& reader) override;
     
     // Particle management
     void SpawnParticle(EntityManager& entityManager, float x, float y, 
@@ -37,6 +39,12 @@ public:
     void RemoveExpiredParticles(EntityManager& entityManager);
     void ClearAllParticles(EntityManager& entityManager);
     
+    // Pooled mode: expired particles are deactivated and respawned in place instead of
+    // being destroyed and recreated, so spawn and expire never change ECS structure
+    void EnablePooling(bool enable) { mPoolingEnabled = enable; }
+    bool IsPoolingEnabled() const { return mPoolingEnabled; }
+    size_t GetPooledParticleCount() const { return mFreeParticles.size(); }
+    
     // Configuration
     void SetSpawnArea(float minX, float minY, float maxX, float maxY);
     void SetVelocityRange(float minVel, float maxVel);
@@ -80,15 +88,24 @@ private:
     int mActiveParticleCount = 0;
     int mTotalParticlesSpawned = 0;
     
-    // Random number generation
-    std::random_device mRandomDevice;
-    std::mt19937 mRandomGenerator;
+    // Pooling
+    bool mPoolingEnabled = false;
+    std::vector<Entity> mFreeParticles; // Deactivated particle entities ready for reuse
+    
+    // Per-frame scratch, reused so steady-state updates don't allocate
+    std::vector<Entity> mQueryScratch;
+    std::vector<Entity> mExpiredScratch;
+    
+    // Burst spawn attributes, filled in batches from the system's random stream
+    std::vector<float> mBurstScratch;
     
     // Helper functions
-    float GetRandomFloat(float min, float max);
-    int GetRandomInt(int min, int max);
-    Uint8 GetRandomUint8(Uint8 min, Uint8 max);
+    float GetRandomFloat(float min, float max) { return mRandom.Range(min, max); }
+    int GetRandomInt(int min, int max) { return mRandom.Range(min, max); }
+    Uint8 GetRandomUint8(Uint8 min, Uint8 max) { return static_cast<Uint8>(mRandom.Range(static_cast<int>(min), static_cast<int>(max))); }
     void UpdateStatistics(EntityManager& entityManager);
+    void RespawnPooledParticle(EntityManager& entityManager, float x, float y,
+                               float velX, float velY, float radius, float mass);
 };
 
 } // namespace ECS
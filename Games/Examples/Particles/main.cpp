@@ -2,36 +2,103 @@
 #include <SDL3/SDL_main.h>
 #include <iostream>
 #include <exception>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
 
 #include "Game/ParticleGame.h"
+#include "Utils/Trace.h"
 
 int main(int argc, char* argv[]) {
     try {
         // Create and initialize the particle game
         Lite2D::ECS::ParticleGame game;
         
-        // Parse command line arguments for window size
+        // Parse command line arguments for window size and headless mode
+        // Usage: colliding_particles [width height] [--headless [frames]] [--trace file.json] [--seed S]
+        //                            [--record input.bin] [--replay input.bin] [--rewind]
         int windowWidth = 1920;
         int windowHeight = 1080;
+        bool headless = false;
+        int headlessFrames = 600;
+        std::string tracePath;
+        std::string recordPath;
+        std::string replayPath;
         
-        if (argc >= 3) {
-            windowWidth = std::atoi(argv[1]);
-            windowHeight = std::atoi(argv[2]);
+        std::vector<int> sizeArgs;
+        for (int i = 1; i < argc; ++i) {
+            if (std::strcmp(argv[i], "--headless") == 0) {
+                headless = true;
+                if (i + 1 < argc && std::atoi(argv[i + 1]) > 0) {
+                    headlessFrames = std::atoi(argv[++i]);
+                }
+            } else if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+                tracePath = argv[++i];
+            } else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+                recordPath = argv[++i];
+            } else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+                replayPath = argv[++i];
+                headless = true; // Replays are for benchmarking: no window, no frame cap
+            } else if (std::strcmp(argv[i], "--rewind") == 0) {
+                // Replays of sessions that rewound need it too
+                game.EnableRewind(true);
+            } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+                game.SetSeed(std::strtoull(argv[++i], nullptr, 10));
+            } else {
+                sizeArgs.push_back(std::atoi(argv[i]));
+            }
+        }
+        
+        if (sizeArgs.size() >= 2) {
+            windowWidth = sizeArgs[0];
+            windowHeight = sizeArgs[1];
+        }
+        
+        // Seed and size come from the recording
+        if (!replayPath.empty() && !game.LoadReplay(replayPath)) {
+            return -1;
         }
         
         std::cout << "Lite2D Colliding Particles Demo" << std::endl;
-        std::cout << "Window Size: " << windowWidth << "x" << windowHeight << std::endl;
+        std::cout << (headless ? "Framebuffer Size: " : "Window Size: ") 
+                  << windowWidth << "x" << windowHeight << std::endl;
         std::cout << "Initializing..." << std::endl;
         
-        if (!game.Initialize(windowWidth, windowHeight)) {
+        if (!game.Initialize(windowWidth, windowHeight, headless)) {
             std::cerr << "Failed to initialize particle game!" << std::endl;
             return -1;
         }
         
         std::cout << "Starting particle animation..." << std::endl;
         
+        if (!recordPath.empty()) {
+            game.StartRecording();
+        }
+        
+        // Capture a Chrome trace of the whole run when requested
+        if (!tracePath.empty()) {
+            Lite2D::Trace::Start();
+        }
+        
         // Run the game loop
-        game.Run();
+        if (headless) {
+            game.RunHeadless(headlessFrames);
+        } else {
+            game.Run();
+        }
+        
+        if (!recordPath.empty()) {
+            game.SaveRecording(recordPath);
+        }
+        
+        if (!tracePath.empty()) {
+            Lite2D::Trace::Stop();
+            if (Lite2D::Trace::WriteChromeTrace(tracePath)) {
+                std::cout << "Trace written to " << tracePath << " (" << Lite2D::Trace::GetEventCount()
+                          << " events, open in chrome://tracing or ui.perfetto.dev)" << std::endl;
+            }
+        }
         
         std::cout << "Particle animation completed." << std::endl;
         
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "ECS/Component.h"
+#include "ECS/StateHash.h"
+#include "ECS/Snapshot.h"
 
 namespace Lite2D {
 namespace ECS {
@@ -29,6 +31,21 @@ public:
     static const char* GetTypeNameStatic() {
         return "Food";
     }
+    
+    void HashState(StateHasher& hasher) const override {
+        hasher.Add(points);
+        hasher.Add(isActive);
+    }
+    
+    void WriteSnapshot(SnapshotWriter& writer) const override {
+        writer.Write(points);
+        writer.Write(isActive);
+    }
+    
+    void ReadSnapshot(SnapshotReader& reader) override {
+        reader.Read(points);
+        reader.Read(isActive);
+    }
 };
 
 } // namespace ECS
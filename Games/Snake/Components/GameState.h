@@ -1,6 +1,8 @@
 #pragma once
 
 #include "ECS/Component.h"
+#include "ECS/StateHash.h"
+#include "ECS/Snapshot.h"
 
 namespace Lite2D {
 namespace ECS {
@@ -42,6 +44,34 @@ public:
         return "GameState";
     }
     
+    void HashState(StateHasher& hasher) const override {
+        hasher.Add(currentState);
+        hasher.Add(score);
+        hasher.Add(highScore);
+        hasher.Add(level);
+        hasher.Add(gameSpeed);
+    }
+    
+    void WriteSnapshot(SnapshotWriter& writer) const override {
+        writer.Write(static_cast<int32_t>(currentState));
+        writer.Write(score);
+        writer.Write(highScore);
+        writer.Write(level);
+        writer.Write(gameSpeed);
+        writer.Write(isNewHighScore);
+    }
+    
+    void ReadSnapshot(SnapshotReader& reader) override {
+        int32_t state = PLAYING;
+        reader.Read(state);
+        currentState = static_cast<State>(state);
+        reader.Read(score);
+        reader.Read(highScore);
+        reader.Read(level);
+        reader.Read(gameSpeed);
+        reader.Read(isNewHighScore);
+    }
+    
     // Helper functions
     void AddScore(int points) {
         score += points;
@@ -0,0 +1,95 @@
+#include "SnakeBody.h"
+#include "ECS/StateHash.h"
+#include "ECS/Snapshot.h"
+
+namespace Lite2D {
+namespace ECS {
+
+void SnakeBody::PushFront(const Cell& cell) {
+    if (mLength == mCells.size()) {
+        Reserve(mLength + 1);
+    }
+    
+    mFront = (mFront + mCells.size() - 1) % mCells.size();
+    mCells[mFront] = cell;
+    mLength++;
+}
+
+void SnakeBody::PushBack(const Cell& cell) {
+    if (mLength == mCells.size()) {
+        Reserve(mLength + 1);
+    }
+    
+    mCells[(mFront + mLength) % mCells.size()] = cell;
+    mLength++;
+}
+
+SnakeBody::Cell SnakeBody::PopBack() {
+    if (mLength == 0) {
+        return Cell();
+    }
+    
+    Cell tail = Back();
+    mLength--;
+    return tail;
+}
+
+void SnakeBody::Reserve(size_t capacity) {
+    if (capacity <= mCells.size()) return;
+    
+    size_t newCapacity = mCells.empty() ? 16 : mCells.size();
+    while (newCapacity < capacity) {
+        newCapacity *= 2;
+    }
+    
+    // Unwrap into the new storage so the neck sits at index 0 again
+    std::vector<Cell> cells(newCapacity);
+    for (size_t i = 0; i < mLength; ++i) {
+        cells[i] = At(i);
+    }
+    
+    mCells.swap(cells);
+    mFront = 0;
+}
+
+void SnakeBody::HashState(StateHasher& hasher) const {
+    hasher.Add(mLength);
+    for (size_t i = 0; i < mLength; ++i) {
+        const Cell& cell = At(i);
+        hasher.Add(cell.x);
+        hasher.Add(cell.y);
+        hasher.Add(cell.segment);
+    }
+}
+
+void SnakeBody::WriteSnapshot(SnapshotWriter& writer) const {
+    writer.Write(static_cast<uint64_t>(mLength));
+    for (size_t i = 0; i < mLength; ++i) {
+        const Cell& cell = At(i);
+        writer.Write(cell.x);
+        writer.Write(cell.y);
+        writer.Write(cell.segment);
+    }
+}
+
+void SnakeBody::ReadSnapshot(SnapshotReader& reader) {
+    Clear();
+    uint64_t length = 0;
+    if (!reader.Read(length) || length > MAX_ENTITIES) {
+        reader.Fail();
+        return;
+    }
+    
+    // Restored unwrapped, neck at index 0
+    Reserve(static_cast<size_t>(length));
+    for (uint64_t i = 0; i < length; ++i) {
+        Cell cell;
+        reader.Read(cell.x);
+        reader.Read(cell.y);
+        reader.Read(cell.segment);
+        PushBack(cell);
+    }
+}
+
+} // namespace ECS
+} // namespace Lite2D
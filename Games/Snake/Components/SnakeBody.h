@@ -0,0 +1,71 @@
+#pragma once
+
+#include "ECS/Component.h"
+#include "ECS/Entity.h"
+#include <cstddef>
+#include <vector>
+
+namespace Lite2D {
+namespace ECS {
+
+/**
+ * Snake Body component
+ * Lives on the head entity and holds the body as a ring buffer of cells, neck
+ * first. A move step pushes the old head cell at the front and pops the tail,
+ * both O(1); growing just skips the pop. Each cell keeps the segment entity
+ * drawn there, and the popped tail's entity is reused for the new front cell.
+ */
+class SnakeBody : public Component {
+public:
+    struct Cell {
+        float x = 0.0f;
+        float y = 0.0f;
+        Entity segment = INVALID_ENTITY;
+    };
+    
+    SnakeBody() = default;
+    explicit SnakeBody(size_t capacity) { Reserve(capacity); }
+    
+    // Component interface
+    Component* Clone() const override {
+        return new SnakeBody(*this);
+    }
+    
+    const char* GetTypeName() const override {
+        return "SnakeBody";
+    }
+    
+    static const char* GetTypeNameStatic() {
+        return "SnakeBody";
+    }
+    
+    // Cells in body order; the ring's storage layout is not part of the state
+    void HashState(StateHasher& hasher) const override;
+    void WriteSnapshot(SnapshotWriter& writer) const override;
+    void ReadSnapshot(SnapshotReader& reader) override;
+    
+    // Ring operations
+    void PushFront(const Cell& cell);
+    void PushBack(const Cell& cell);
+    Cell PopBack();
+    void Clear() { mFront = 0; mLength = 0; }
+    
+    // Grows storage to hold at least capacity cells (doubling, so growth is amortized)
+    void Reserve(size_t capacity);
+    
+    // Index 0 is the neck (next to the head), GetLength() - 1 the tail
+    const Cell& At(size_t index) const { return mCells[(mFront + index) % mCells.size()]; }
+    const Cell& Front() const { return At(0); }
+    const Cell& Back() const { return At(mLength - 1); }
+    size_t GetLength() const { return mLength; }
+    size_t GetCapacity() const { return mCells.size(); }
+    bool IsEmpty() const { return mLength == 0; }
+
+private:
+    std::vector<Cell> mCells;
+    size_t mFront = 0;
+    size_t mLength = 0;
+};
+
+} // namespace ECS
+} // namespace Lite2D
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "ECS/Component.h"
+#include "ECS/StateHash.h"
+#include "ECS/Snapshot.h"
 
 namespace Lite2D {
 namespace ECS {
@@ -41,6 +43,34 @@ public:
         return "SnakeHead";
     }
     
+    void HashState(StateHasher& hasher) const override {
+        hasher.Add(currentDirection);
+        hasher.Add(nextDirection);
+        hasher.Add(moveTimer);
+        hasher.Add(moveInterval);
+        hasher.Add(segmentsToAdd);
+    }
+    
+    void WriteSnapshot(SnapshotWriter& writer) const override {
+        writer.Write(static_cast<int32_t>(currentDirection));
+        writer.Write(static_cast<int32_t>(nextDirection));
+        writer.Write(moveTimer);
+        writer.Write(moveInterval);
+        writer.Write(segmentsToAdd);
+    }
+    
+    void ReadSnapshot(SnapshotReader& reader) override {
+        int32_t current = RIGHT;
+        int32_t next = RIGHT;
+        reader.Read(current);
+        reader.Read(next);
+        currentDirection = static_cast<Direction>(current);
+        nextDirection = static_cast<Direction>(next);
+        reader.Read(moveTimer);
+        reader.Read(moveInterval);
+        reader.Read(segmentsToAdd);
+    }
+    
     // Helper functions
     void SetDirection(Direction direction) {
         // Prevent reversing into self
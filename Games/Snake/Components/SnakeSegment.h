@@ -1,6 +1,8 @@
 #pragma once
 
 #include "ECS/Component.h"
+#include "ECS/StateHash.h"
+#include "ECS/Snapshot.h"
 
 namespace Lite2D {
 namespace ECS {
@@ -11,7 +13,7 @@ namespace ECS {
  */
 class SnakeSegment : public Component {
 public:
-    int segmentIndex; // Position in the snake (0 = head, 1+ = body)
+    int segmentIndex; // Creation order (1+ = body); current order is the head's SnakeBody ring
     
     SnakeSegment(int index = 0) : segmentIndex(index) {}
     
@@ -27,6 +29,18 @@ public:
     static const char* GetTypeNameStatic() {
         return "SnakeSegment";
     }
+    
+    void HashState(StateHasher& hasher) const override {
+        hasher.Add(segmentIndex);
+    }
+    
+    void WriteSnapshot(SnapshotWriter& writer) const override {
+        writer.Write(segmentIndex);
+    }
+    
+    void ReadSnapshot(SnapshotReader& reader) override {
+        reader.Read(segmentIndex);
+    }
 };
 
 } // namespace ECS
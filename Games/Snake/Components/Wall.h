@@ -1,6 +1,8 @@
 #pragma once
 
 #include "ECS/Component.h"
+#include "ECS/StateHash.h"
+#include "ECS/Snapshot.h"
 
 namespace Lite2D {
 namespace ECS {
@@ -32,6 +34,20 @@ public:
     static const char* GetTypeNameStatic() {
         return "Wall";
     }
+    
+    void HashState(StateHasher& hasher) const override {
+        hasher.Add(wallType);
+    }
+    
+    void WriteSnapshot(SnapshotWriter& writer) const override {
+        writer.Write(static_cast<int32_t>(wallType));
+    }
+    
+    void ReadSnapshot(SnapshotReader& reader) override {
+        int32_t type = BOUNDARY;
+        reader.Read(type);
+        wallType = static_cast<WallType>(type);
+    }
 };
 
 } // namespace ECS
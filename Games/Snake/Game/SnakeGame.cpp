@@ -1,13 +1,17 @@
 #include "SnakeGame.h"
+#include "Utils/AllocationTracker.h"
+#include "Utils/timer.h"
+#include <iomanip>
 #include <iostream>
 #include <memory>
+#include <random>
 
 namespace Lite2D {
 namespace ECS {
 
 SnakeGame::SnakeGame() 
-    : mWindow(nullptr), mRenderer(nullptr), mWindowWidth(800), mWindowHeight(600),
-      mIsRunning(false), mLastFrameTime(0.0f), mGameStateEntity(INVALID_ENTITY),
+    : mWindow(nullptr), mRenderer(nullptr), mHeadless(false), mWindowWidth(800), mWindowHeight(600),
+      mIsRunning(false), mSeed(std::random_device{}()), mLastFrameTime(0.0f), mGameStateEntity(INVALID_ENTITY),
       mSnakeHeadEntity(INVALID_ENTITY) {
 }
 
@@ -15,9 +19,17 @@ SnakeGame::~SnakeGame() {
     Shutdown();
 }
 
-bool SnakeGame::Initialize(int windowWidth, int windowHeight) {
+bool SnakeGame::Initialize(int windowWidth, int windowHeight, bool headless) {
     mWindowWidth = windowWidth;
     mWindowHeight = windowHeight;
+    mHeadless = headless;
+    
+    if (mReplay.IsLoaded()) {
+        // The grid and food placement depend on both; the replay only matches the recorded run with them
+        mSeed = mReplay.GetSeed();
+        mWindowWidth = mReplay.GetViewWidth();
+        mWindowHeight = mReplay.GetViewHeight();
+    }
     
     // Initialize SDL
     if (!InitializeSDL()) {
@@ -39,6 +51,17 @@ bool SnakeGame::Initialize(int windowWidth, int windowHeight) {
 }
 
 bool SnakeGame::InitializeSDL() {
+    if (mHeadless) {
+        // Software renderer on an offscreen surface - no video subsystem or display needed
+        mHeadlessRenderer = std::make_unique<HeadlessRenderer>();
+        if (!mHeadlessRenderer->Initialize(mWindowWidth, mWindowHeight)) {
+            std::cerr << "Headless renderer could not be created! SDL_Error: " << SDL_GetError() << std::endl;
+            return false;
+        }
+        mRenderer = mHeadlessRenderer->GetRendererObject();
+        return true;
+    }
+    
     if (SDL_Init(SDL_INIT_VIDEO) < 0) {
         std::cerr << "SDL could not initialize! SDL_Error: " << SDL_GetError() << std::endl;
         return false;
@@ -71,6 +94,7 @@ bool SnakeGame::InitializeECS() {
     // Create ECS managers
     mEntityManager = std::make_unique<EntityManager>();
     mSystemManager = std::make_unique<SystemManager>();
+    mSystemManager->SetRandomSeed(mSeed); // New food layout every session unless seeded
     
     // Register systems
     mMovementSystem = mSystemManager->RegisterSystem<MovementSystem>();
@@ -106,9 +130,15 @@ bool SnakeGame::InitializeECS() {
     
     mRenderSystem->SetClearColor(20, 20, 40, 255); // Dark blue background
     mRenderSystem->SetRenderOrder(true); // Lower layers first
+    mRenderSystem->SetLayerStatic(3); // Walls never move, draw them from a cached texture
+    mRenderSystem->SetProfilingSource(mSystemManager.get());
     
     mCollisionSystem->SetBoundaries(0, 0, mWindowWidth, mWindowHeight);
     
+    // Collision checks look cells up in the grid the movement system maintains
+    mSnakeMovementSystem->ConfigureGrid(0, 0, mWindowWidth, mWindowHeight);
+    mCollisionSystem->SetOccupancyGrid(&mSnakeMovementSystem->GetOccupancyGrid());
+    
     return true;
 }
 
@@ -136,6 +166,7 @@ void SnakeGame::InitializeGame() {
         mGameLogicSystem->SetSnakeHeadEntity(mSnakeHeadEntity);
     }
     
+    mSnakeMovementSystem->RebuildOccupancy(*mEntityManager);
 }
 
 void SnakeGame::Run() {
@@ -150,30 +181,118 @@ void SnakeGame::Run() {
         std::cout << "  R - Restart (from game over)" << std::endl;
         std::cout << "  Q - Quit to menu" << std::endl;
         std::cout << "  ESC - Exit game" << std::endl;
+        std::cout << "  F3 - Toggle performance overlay" << std::endl;
     }
     
     while (mIsRunning) {
-        HandleEvents();
+        PollEvents();
         
         float currentTime = SDL_GetTicks() / 1000.0f;
         float deltaTime = currentTime - mLastFrameTime;
         mLastFrameTime = currentTime;
         
+        mRecorder.RecordFrame(deltaTime, mFrameEvents.data(), mFrameEvents.size());
+        HandleEvents(mFrameEvents.data(), mFrameEvents.size());
+        
         Update(deltaTime);
         Render();
+        AllocationTracker::MarkFrame();
         
         // Cap frame rate to ~60 FPS
         SDL_Delay(16);
     }
 }
 
-void SnakeGame::HandleEvents() {
+void SnakeGame::RunReplay() {
+    if (!mReplay.IsLoaded()) {
+        std::cerr << "No input recording loaded" << std::endl;
+        return;
+    }
+    
+    std::cout << "Replaying " << mReplay.GetFrameCount() << " recorded frames (" << mReplay.GetEventCount() 
+              << " input events)..." << std::endl;
+    mReplay.Restart();
+    mIsRunning = true;
+    
+    Timer timer;
+    timer.Start();
+    
+    size_t frameCount = 0;
+    float deltaTime = 0.0f;
+    const SDL_Event* events = nullptr;
+    size_t eventCount = 0;
+    while (mIsRunning && mReplay.NextFrame(deltaTime, events, eventCount)) {
+        HandleEvents(events, eventCount);
+        Update(deltaTime);
+        Render();
+        AllocationTracker::MarkFrame();
+        ++frameCount;
+    }
+    mIsRunning = false;
+    
+    double elapsedMs = timer.GetElapsedSeconds() * 1000.0;
+    std::cout << "\n=== Replay Results ===" << std::endl;
+    std::cout << "Frames: " << frameCount << std::endl;
+    std::cout << "Total Time: " << std::fixed << std::setprecision(2) << elapsedMs << "ms" << std::endl;
+    std::cout << "Average Frame Time: " << std::setprecision(3) 
+              << (frameCount > 0 ? elapsedMs / frameCount : 0.0) << "ms" << std::endl;
+    std::cout << "State Hash: " << std::hex << ComputeStateHash() << std::dec << std::endl;
+    std::cout << "======================\n" << std::endl;
+}
+
+uint64_t SnakeGame::ComputeStateHash() const {
+    StateHasher hasher(mSeed);
+    mEntityManager->HashState(hasher);
+    mSystemManager->HashState(hasher);
+    return hasher.GetHash();
+}
+
+void SnakeGame::StartRecording() {
+    mRecorder.Begin(mSeed, mWindowWidth, mWindowHeight);
+    std::cout << "Recording input (seed " << mSeed << ")" << std::endl;
+}
+
+bool SnakeGame::SaveRecording(const std::string& path) {
+    mRecorder.Stop();
+    if (!mRecorder.SaveToFile(path)) {
+        return false;
+    }
+    std::cout << "Input recording written to " << path << " (" << mRecorder.GetFrameCount() << " frames, " 
+              << mRecorder.GetSize() << " bytes, state hash " << std::hex << ComputeStateHash() << std::dec 
+              << ")" << std::endl;
+    return true;
+}
+
+bool SnakeGame::LoadReplay(const std::string& path) {
+    if (!mReplay.LoadFromFile(path)) {
+        std::cerr << "Failed to load input recording: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void SnakeGame::PollEvents() {
+    mFrameEvents.clear();
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
+        mFrameEvents.push_back(event);
+    }
+}
+
+void SnakeGame::HandleEvents(const SDL_Event* events, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const SDL_Event& event = events[i];
         if (event.type == SDL_EVENT_QUIT) {
             mIsRunning = false;
         }
         
+        // F3 toggles the performance overlay (and the profiling that feeds it)
+        if (event.type == SDL_EVENT_KEY_DOWN && event.key.key == SDLK_F3) {
+            bool showOverlay = !mRenderSystem->IsDebugInfoEnabled();
+            mRenderSystem->EnableDebugInfo(showOverlay);
+            mSystemManager->EnableProfiling(showOverlay);
+        }
+        
         // Process input through input system
         mInputSystem->ProcessEvent(event, *mEntityManager);
     }
@@ -197,6 +316,12 @@ void SnakeGame::Shutdown() {
 }
 
 void SnakeGame::CleanupSDL() {
+    if (mHeadlessRenderer) {
+        // The headless renderer owns its SDL_Renderer
+        mRenderer = nullptr;
+        mHeadlessRenderer.reset();
+    }
+    
     if (mRenderer) {
         SDL_DestroyRenderer(mRenderer);
         mRenderer = nullptr;
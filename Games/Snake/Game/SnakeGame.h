@@ -4,12 +4,16 @@
 #include "ECS/SystemManager.h"
 #include "ECS/Systems/MovementSystem.h"
 #include "Rendering/RenderSystem.h"
+#include "Rendering/HeadlessRenderer.h"
+#include "Input/InputRecording.h"
 #include "../Systems/InputSystem.h"
 #include "../Systems/SnakeMovementSystem.h"
 #include "../Systems/CollisionSystem.h"
 #include "../Systems/GameLogicSystem.h"
 #include "../Components/GameState.h"
 #include <SDL3/SDL.h>
+#include <string>
+#include <vector>
 
 namespace Lite2D {
 namespace ECS {
@@ -24,10 +28,25 @@ public:
     ~SnakeGame();
     
     // Game lifecycle
-    bool Initialize(int windowWidth = 800, int windowHeight = 600);
+    bool Initialize(int windowWidth = 800, int windowHeight = 600, bool headless = false);
     void Run();
     void Shutdown();
     
+    // Seed for food placement; call before Initialize. Random per session unless set.
+    void SetSeed(uint64_t seed) { mSeed = seed; }
+    
+    // Input recording: call StartRecording after Initialize, SaveRecording after the run
+    void StartRecording();
+    bool SaveRecording(const std::string& path);
+    
+    // Replays a recording as fast as possible (initialize headless after LoadReplay,
+    // which supplies the seed and window size) and reports timing and the state hash
+    bool LoadReplay(const std::string& path);
+    void RunReplay();
+    
+    // Hash of all simulation state; a replay ends on the recorded run's hash
+    uint64_t ComputeStateHash() const;
+    
     // Game state
     bool IsRunning() const { return mIsRunning; }
     void Stop() { mIsRunning = false; }
@@ -37,6 +56,10 @@ private:
     SDL_Window* mWindow;
     SDL_Renderer* mRenderer;
     
+    // Offscreen target used instead of a window in headless mode
+    std::unique_ptr<HeadlessRenderer> mHeadlessRenderer;
+    bool mHeadless;
+    
     // ECS components
     std::unique_ptr<EntityManager> mEntityManager;
     std::unique_ptr<SystemManager> mSystemManager;
@@ -49,10 +72,16 @@ private:
     int mWindowWidth;
     int mWindowHeight;
     bool mIsRunning;
+    uint64_t mSeed;
     
     // Timing
     float mLastFrameTime;
     
+    // Events of the current frame, polled live or replayed
+    std::vector<SDL_Event> mFrameEvents;
+    InputRecorder mRecorder;
+    InputPlayer mReplay;
+    
     // System references
     std::shared_ptr<MovementSystem> mMovementSystem;
     std::shared_ptr<RenderSystem> mRenderSystem;
@@ -62,7 +91,8 @@ private:
     std::shared_ptr<GameLogicSystem> mGameLogicSystem;
     
     // Game loop
-    void HandleEvents();
+    void PollEvents();
+    void HandleEvents(const SDL_Event* events, size_t count);
     void Update(float deltaTime);
     void Render();
     
@@ -0,0 +1,231 @@
+#include "SnakeSimulation.h"
+#include "ECS/Components/Position.h"
+#include "../Components/Food.h"
+#include "../Components/GameState.h"
+#include "Utils/ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+namespace Lite2D {
+namespace ECS {
+
+SnakeSimulation::SnakeSimulation(int boardWidth, int boardHeight)
+    : mBoardWidth(boardWidth), mBoardHeight(boardHeight) {
+    mEntityManager = std::make_unique<EntityManager>();
+    mSystemManager = std::make_unique<SystemManager>();
+    
+    // Only the gameplay systems, in SnakeGame's update order; no input or rendering
+    mSnakeMovementSystem = mSystemManager->RegisterSystem<SnakeMovementSystem>();
+    mCollisionSystem = mSystemManager->RegisterSystem<CollisionSystem>();
+    mGameLogicSystem = mSystemManager->RegisterSystem<GameLogicSystem>();
+    
+    mSnakeMovementSystem->SetVerbose(false);
+    mCollisionSystem->SetVerbose(false);
+    mGameLogicSystem->SetVerbose(false);
+    
+    mSystemManager->InitializeAllSystems(*mEntityManager);
+    
+    mCollisionSystem->SetBoundaries(0, 0, mBoardWidth, mBoardHeight);
+    mSnakeMovementSystem->ConfigureGrid(0, 0, mBoardWidth, mBoardHeight, CELL_SIZE);
+    mCollisionSystem->SetOccupancyGrid(&mSnakeMovementSystem->GetOccupancyGrid());
+    
+    Reset(1);
+}
+
+SnakeSimulation::~SnakeSimulation() {
+    mSystemManager->ShutdownAllSystems(*mEntityManager);
+}
+
+void SnakeSimulation::Reset(uint32_t seed) {
+    // Fresh entity IDs and pools, so a game never depends on the games this instance played before
+    mEntityManager->Clear();
+    mGameStateEntity = mEntityManager->CreateEntity();
+    mEntityManager->AddComponent(mGameStateEntity, GameState());
+    mSnakeMovementSystem->SetGameStateEntity(mGameStateEntity);
+    mCollisionSystem->SetGameStateEntity(mGameStateEntity);
+    mGameLogicSystem->SetGameStateEntity(mGameStateEntity);
+    
+    // Food placement is the only randomness; each system draws from its own stream of this seed
+    mSystemManager->SetRandomSeed(seed);
+    mGameLogicSystem->StartNewGame(*mEntityManager);
+    
+    mSnakeHeadEntity = mGameLogicSystem->GetSnakeHeadEntity();
+    mSnakeMovementSystem->SetSnakeHeadEntity(mSnakeHeadEntity);
+    mCollisionSystem->SetSnakeHeadEntity(mSnakeHeadEntity);
+    mSnakeMovementSystem->RebuildOccupancy(*mEntityManager);
+    
+    mEntityManager->EndFrame();
+    mSteps = 0;
+}
+
+bool SnakeSimulation::Step(SnakeHead::Direction input) {
+    if (IsGameOver()) return false;
+    
+    SnakeHead* head = mEntityManager->GetComponent<SnakeHead>(mSnakeHeadEntity);
+    GameState* gameState = mEntityManager->GetComponent<GameState>(mGameStateEntity);
+    if (!head || !gameState) return false;
+    
+    head->SetDirection(input);
+    
+    // Exactly one move interval, so every step is one cell regardless of level speed
+    float moveInterval = head->moveInterval / gameState->gameSpeed;
+    head->moveTimer = 0.0f;
+    mSystemManager->UpdateSystems(*mEntityManager, moveInterval);
+    mSteps++;
+    
+    return !IsGameOver();
+}
+
+SnakeGameResult SnakeSimulation::Run(uint32_t seed, const SnakePolicy& policy, int maxSteps) {
+    Reset(seed);
+    
+    while (mSteps < maxSteps && Step(policy(*this))) {
+    }
+    
+    SnakeGameResult result;
+    result.score = GetScore();
+    result.steps = mSteps;
+    result.died = IsGameOver();
+    
+    SnakeBody* body = mEntityManager->GetComponent<SnakeBody>(mSnakeHeadEntity);
+    result.length = body ? body->GetLength() : 0;
+    result.stateHash = ComputeStateHash();
+    return result;
+}
+
+uint64_t SnakeSimulation::ComputeStateHash() const {
+    StateHasher hasher;
+    hasher.Add(mSteps);
+    mEntityManager->HashState(hasher);
+    mSystemManager->HashState(hasher);
+    return hasher.GetHash();
+}
+
+bool SnakeSimulation::IsGameOver() const {
+    GameState* gameState = mEntityManager->GetComponent<GameState>(mGameStateEntity);
+    return !gameState || gameState->currentState == GameState::GAME_OVER;
+}
+
+int SnakeSimulation::GetScore() const {
+    GameState* gameState = mEntityManager->GetComponent<GameState>(mGameStateEntity);
+    return gameState ? gameState->score : 0;
+}
+
+SnakeHead::Direction SnakeSimulation::GetDirection() const {
+    SnakeHead* head = mEntityManager->GetComponent<SnakeHead>(mSnakeHeadEntity);
+    return head ? head->currentDirection : SnakeHead::RIGHT;
+}
+
+void SnakeSimulation::GetHeadPosition(float& x, float& y) const {
+    Position* position = mEntityManager->GetComponent<Position>(mSnakeHeadEntity);
+    x = position ? position->x : 0.0f;
+    y = position ? position->y : 0.0f;
+}
+
+bool SnakeSimulation::GetFoodPosition(float& x, float& y) const {
+    for (Entity entity : mEntityManager->GetFrameEntitiesWith<Food, Position>()) {
+        Food* food = mEntityManager->GetComponent<Food>(entity);
+        if (food->isActive) {
+            Position* position = mEntityManager->GetComponent<Position>(entity);
+            x = position->x;
+            y = position->y;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SnakeSimulation::IsBlocked(float x, float y) const {
+    if (x < 0.0f || y < 0.0f || x >= mBoardWidth || y >= mBoardHeight) {
+        return true;
+    }
+    
+    const OccupancyGrid& grid = mSnakeMovementSystem->GetOccupancyGrid();
+    return grid.HasSnake(x, y) || grid.HasWall(x, y);
+}
+
+SnakeHead::Direction SnakeSimulation::GreedyPolicy(const SnakeSimulation& simulation) {
+    float headX, headY;
+    simulation.GetHeadPosition(headX, headY);
+    
+    float foodX = headX, foodY = headY;
+    simulation.GetFoodPosition(foodX, foodY);
+    
+    float dx = foodX - headX;
+    float dy = foodY - headY;
+    
+    SnakeHead::Direction horizontal = dx < 0.0f ? SnakeHead::LEFT : SnakeHead::RIGHT;
+    SnakeHead::Direction vertical = dy < 0.0f ? SnakeHead::UP : SnakeHead::DOWN;
+    SnakeHead::Direction awayHorizontal = dx < 0.0f ? SnakeHead::RIGHT : SnakeHead::LEFT;
+    SnakeHead::Direction awayVertical = dy < 0.0f ? SnakeHead::DOWN : SnakeHead::UP;
+    
+    SnakeHead::Direction order[4];
+    if (std::abs(dx) >= std::abs(dy)) {
+        order[0] = horizontal; order[1] = vertical; order[2] = awayVertical; order[3] = awayHorizontal;
+    } else {
+        order[0] = vertical; order[1] = horizontal; order[2] = awayHorizontal; order[3] = awayVertical;
+    }
+    
+    SnakeHead::Direction current = simulation.GetDirection();
+    float cellSize = simulation.GetCellSize();
+    
+    for (SnakeHead::Direction direction : order) {
+        // Reversing is ignored by SnakeHead::SetDirection, so it is never a real option
+        SnakeHead probe(current);
+        probe.SetDirection(direction);
+        if (probe.nextDirection != direction) continue;
+        
+        probe.currentDirection = direction;
+        float stepX, stepY;
+        probe.GetDirectionVector(stepX, stepY);
+        
+        if (!simulation.IsBlocked(headX + stepX * cellSize, headY + stepY * cellSize)) {
+            return direction;
+        }
+    }
+    
+    // Boxed in, keep going
+    return current;
+}
+
+SnakeBatchResult SnakeSimulation::RunBatch(size_t gameCount, const SnakePolicy& policy, size_t threadCount,
+                                           uint32_t baseSeed, int maxSteps) {
+    ThreadPool pool(threadCount);
+    std::vector<SnakeGameResult> results(gameCount);
+    
+    auto start = std::chrono::steady_clock::now();
+    
+    // One simulation per chunk, reused for every game in it
+    pool.ParallelFor(gameCount, [&](size_t begin, size_t end, size_t) {
+        SnakeSimulation simulation;
+        for (size_t i = begin; i < end; ++i) {
+            results[i] = simulation.Run(baseSeed + static_cast<uint32_t>(i), policy, maxSteps);
+        }
+    });
+    
+    auto finish = std::chrono::steady_clock::now();
+    
+    SnakeBatchResult batch;
+    batch.games = gameCount;
+    batch.threads = pool.GetThreadCount();
+    batch.seconds = std::chrono::duration<double>(finish - start).count();
+    
+    long long totalScore = 0;
+    StateHasher batchHasher;
+    for (const SnakeGameResult& result : results) {
+        batchHasher.Add(result.stateHash);
+        batch.totalSteps += result.steps;
+        batch.deaths += result.died ? 1 : 0;
+        batch.bestScore = std::max(batch.bestScore, result.score);
+        totalScore += result.score;
+    }
+    batch.averageScore = gameCount > 0 ? static_cast<double>(totalScore) / gameCount : 0.0;
+    batch.stateHash = batchHasher.GetHash();
+    
+    return batch;
+}
+
+} // namespace ECS
+} // namespace Lite2D
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "ECS/EntityManager.h"
+#include "ECS/SystemManager.h"
+#include "ECS/StateHash.h"
+#include "../Systems/SnakeMovementSystem.h"
+#include "../Systems/CollisionSystem.h"
+#include "../Systems/GameLogicSystem.h"
+#include "../Components/SnakeHead.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace Lite2D {
+namespace ECS {
+
+class SnakeSimulation;
+
+// Picks the next direction from the current state. Batch runs call it from
+// several threads at once, so it must not touch shared mutable state.
+using SnakePolicy = std::function<SnakeHead::Direction(const SnakeSimulation& simulation)>;
+
+struct SnakeGameResult {
+    int score = 0;
+    int steps = 0;
+    size_t length = 0;   // Body segments at the end
+    bool died = false;   // False when the step limit ended the game
+    uint64_t stateHash = 0; // Final state; same seed and policy give the same hash
+};
+
+struct SnakeBatchResult {
+    size_t games = 0;
+    size_t totalSteps = 0;
+    size_t deaths = 0;
+    double averageScore = 0.0;
+    int bestScore = 0;
+    double seconds = 0.0;
+    size_t threads = 0;
+    uint64_t stateHash = 0; // Per-game hashes combined in game order, independent of thread count
+    
+    double GetGamesPerSecond() const { return seconds > 0.0 ? games / seconds : 0.0; }
+    double GetStepsPerSecond() const { return seconds > 0.0 ? totalSteps / seconds : 0.0; }
+};
+
+/**
+ * Headless Snake Simulation
+ * One game instance without a window or renderer, driven at a fixed step: every
+ * Step() moves the snake exactly one cell, with collisions and scoring handled by
+ * the same systems SnakeGame uses. Food placement is seeded, so a seed plus a
+ * deterministic policy always replays the same game.
+ */
+class SnakeSimulation {
+public:
+    SnakeSimulation(int boardWidth = 800, int boardHeight = 600);
+    ~SnakeSimulation();
+    
+    // Delete copy constructor and assignment operator
+    SnakeSimulation(const SnakeSimulation&) = delete;
+    SnakeSimulation& operator=(const SnakeSimulation&) = delete;
+    
+    // Starts a new game, reusing this instance's entities and systems
+    void Reset(uint32_t seed);
+    
+    // Applies the input and advances one move. Returns false once the game is over.
+    bool Step(SnakeHead::Direction input);
+    
+    // Plays a full game from Reset(seed) until death or maxSteps
+    SnakeGameResult Run(uint32_t seed, const SnakePolicy& policy, int maxSteps = 10000);
+    
+    // State queries for policies
+    bool IsGameOver() const;
+    int GetScore() const;
+    int GetSteps() const { return mSteps; }
+    SnakeHead::Direction GetDirection() const;
+    void GetHeadPosition(float& x, float& y) const;
+    bool GetFoodPosition(float& x, float& y) const;
+    bool IsBlocked(float x, float y) const; // Off the board, wall or snake body
+    float GetCellSize() const { return CELL_SIZE; }
+    
+    // Lockstep hash of the game state (entities, components, systems, steps)
+    uint64_t ComputeStateHash() const;
+    
+    // Built-in bot: heads for the food along the longer axis first, never into a blocked cell
+    static SnakeHead::Direction GreedyPolicy(const SnakeSimulation& simulation);
+    
+    // Plays gameCount games across threadCount threads (0 = all cores). Game i uses
+    // seed baseSeed + i, so results do not depend on the thread count.
+    static SnakeBatchResult RunBatch(size_t gameCount, const SnakePolicy& policy, size_t threadCount = 0,
+                                     uint32_t baseSeed = 1, int maxSteps = 10000);
+
+private:
+    static constexpr float CELL_SIZE = 20.0f;
+    
+    int mBoardWidth;
+    int mBoardHeight;
+    int mSteps = 0;
+    
+    std::unique_ptr<EntityManager> mEntityManager;
+    std::unique_ptr<SystemManager> mSystemManager;
+    std::shared_ptr<SnakeMovementSystem> mSnakeMovementSystem;
+    std::shared_ptr<CollisionSystem> mCollisionSystem;
+    std::shared_ptr<GameLogicSystem> mGameLogicSystem;
+    
+    Entity mGameStateEntity = INVALID_ENTITY;
+    Entity mSnakeHeadEntity = INVALID_ENTITY;
+};
+
+} // namespace ECS
+} // namespace Lite2D
@@ -3,7 +3,6 @@
 #include "ECS/Components/Renderable.h"
 #include "../Components/SnakeSegment.h"
 #include <iostream>
-#include <random>
 #include <cmath>
 
 namespace Lite2D {
@@ -47,11 +46,15 @@ void CollisionSystem::Update(EntityManager& entityManager, float deltaTime) {
 }
 
 void CollisionSystem::Initialize(EntityManager& entityManager) {
-    std::cout << "CollisionSystem initialized" << std::endl;
+    if (mVerbose) {
+        std::cout << "CollisionSystem initialized" << std::endl;
+    }
 }
 
 void CollisionSystem::Shutdown(EntityManager& entityManager) {
-    std::cout << "CollisionSystem shutdown" << std::endl;
+    if (mVerbose) {
+        std::cout << "CollisionSystem shutdown" << std::endl;
+    }
 }
 
 void CollisionSystem::SetBoundaries(float minX, float minY, float maxX, float maxY) {
@@ -63,68 +66,31 @@ void CollisionSystem::SetBoundaries(float minX, float minY, float maxX, float ma
 
 bool CollisionSystem::CheckSnakeFoodCollision(EntityManager& entityManager) {
     Position* headPos = entityManager.GetComponent<Position>(mSnakeHeadEntity);
-    if (!headPos) return false;
+    if (!headPos || !mOccupancy) return false;
     
-    // Check collision with all food entities
-    auto foodEntities = entityManager.GetEntitiesWith<Food>();
+    Entity foodEntity = mOccupancy->GetFood(headPos->x, headPos->y);
+    if (foodEntity == INVALID_ENTITY) return false;
     
-    for (Entity foodEntity : foodEntities) {
-        Food* food = entityManager.GetComponent<Food>(foodEntity);
-        Position* foodPos = entityManager.GetComponent<Position>(foodEntity);
-        
-        if (!food || !foodPos || !food->isActive) continue;
-        
-        if (IsPositionEqual(headPos->x, headPos->y, foodPos->x, foodPos->y)) {
-            HandleFoodCollision(entityManager, foodEntity);
-            return true;
-        }
-    }
+    Food* food = entityManager.GetComponent<Food>(foodEntity);
+    if (!food || !food->isActive) return false;
     
-    return false;
+    HandleFoodCollision(entityManager, foodEntity);
+    return true;
 }
 
 bool CollisionSystem::CheckSnakeWallCollision(EntityManager& entityManager) {
     Position* headPos = entityManager.GetComponent<Position>(mSnakeHeadEntity);
-    if (!headPos) return false;
+    if (!headPos || !mOccupancy) return false;
     
-    // Check collision with all wall entities
-    auto wallEntities = entityManager.GetEntitiesWith<Wall>();
-    
-    for (Entity wallEntity : wallEntities) {
-        Position* wallPos = entityManager.GetComponent<Position>(wallEntity);
-        
-        if (!wallPos) continue;
-        
-        if (IsPositionEqual(headPos->x, headPos->y, wallPos->x, wallPos->y)) {
-            return true;
-        }
-    }
-    
-    return false;
+    return mOccupancy->HasWall(headPos->x, headPos->y);
 }
 
 bool CollisionSystem::CheckSnakeSelfCollision(EntityManager& entityManager) {
     Position* headPos = entityManager.GetComponent<Position>(mSnakeHeadEntity);
-    if (!headPos) return false;
-    
-    // Check collision with snake body segments (not head)
-    auto segments = entityManager.GetEntitiesWith<SnakeSegment>();
-    
-    for (Entity segment : segments) {
-        SnakeSegment* snakeSegment = entityManager.GetComponent<SnakeSegment>(segment);
-        Position* segmentPos = entityManager.GetComponent<Position>(segment);
-        
-        if (!snakeSegment || !segmentPos) continue;
-        
-        // Skip the head (segment index 0 is reserved for head)
-        if (snakeSegment->segmentIndex <= 0) continue;
-        
-        if (IsPositionEqual(headPos->x, headPos->y, segmentPos->x, segmentPos->y)) {
-            return true;
-        }
-    }
+    if (!headPos || !mOccupancy) return false;
     
-    return false;
+    // The head has no SnakeSegment, so any snake occupancy in its cell is the body
+    return mOccupancy->HasSnake(headPos->x, headPos->y);
 }
 
 bool CollisionSystem::CheckSnakeBoundaryCollision(EntityManager& entityManager) {
@@ -151,18 +117,25 @@ void CollisionSystem::HandleFoodCollision(EntityManager& entityManager, Entity f
         // Deactivate food
         food->isActive = false;
         
-        // Tell snake movement system to grow
-        // This would typically be done through a message/event system
-        // For now, we'll directly call the grow function
-        // In a real implementation, you'd use an event bus
+        // Grow by one segment on the next move step
+        SnakeHead* head = entityManager.GetComponent<SnakeHead>(mSnakeHeadEntity);
+        if (head) {
+            head->segmentsToAdd++;
+        }
         
         // Destroy the food entity
+        Position* foodPos = entityManager.GetComponent<Position>(foodEntity);
+        if (mOccupancy && foodPos) {
+            mOccupancy->ClearFood(foodPos->x, foodPos->y);
+        }
         entityManager.DestroyEntity(foodEntity);
         
         // Spawn new food
         SpawnNewFood(entityManager);
         
-        std::cout << "Snake ate food! Score: " << gameState->score << std::endl;
+        if (mVerbose) {
+            std::cout << "Snake ate food! Score: " << gameState->score << std::endl;
+        }
     }
 }
 
@@ -174,7 +147,9 @@ void CollisionSystem::HandleWallCollision(EntityManager& entityManager) {
     
     if (gameState) {
         gameState->currentState = GameState::GAME_OVER;
-        std::cout << "Game Over! Snake hit a wall. Final Score: " << gameState->score << std::endl;
+        if (mVerbose) {
+            std::cout << "Game Over! Snake hit a wall. Final Score: " << gameState->score << std::endl;
+        }
     }
 }
 
@@ -186,7 +161,9 @@ void CollisionSystem::HandleSelfCollision(EntityManager& entityManager) {
     
     if (gameState) {
         gameState->currentState = GameState::GAME_OVER;
-        std::cout << "Game Over! Snake hit itself. Final Score: " << gameState->score << std::endl;
+        if (mVerbose) {
+            std::cout << "Game Over! Snake hit itself. Final Score: " << gameState->score << std::endl;
+        }
     }
 }
 
@@ -198,14 +175,12 @@ void CollisionSystem::HandleBoundaryCollision(EntityManager& entityManager) {
     
     if (gameState) {
         gameState->currentState = GameState::GAME_OVER;
-        std::cout << "Game Over! Snake hit boundary. Final Score: " << gameState->score << std::endl;
+        if (mVerbose) {
+            std::cout << "Game Over! Snake hit boundary. Final Score: " << gameState->score << std::endl;
+        }
     }
 }
 
-bool CollisionSystem::IsPositionEqual(float x1, float y1, float x2, float y2, float tolerance) {
-    return (std::abs(x1 - x2) < tolerance && std::abs(y1 - y2) < tolerance);
-}
-
 void CollisionSystem::SpawnNewFood(EntityManager& entityManager) {
     // Create new food entity
     Entity foodEntity = entityManager.CreateEntity();
@@ -215,22 +190,29 @@ void CollisionSystem::SpawnNewFood(EntityManager& entityManager) {
     float foodX = GetRandomPosition(mMinX + GRID_SIZE, mMaxX - GRID_SIZE, GRID_SIZE);
     float foodY = GetRandomPosition(mMinY + GRID_SIZE, mMaxY - GRID_SIZE, GRID_SIZE);
     
+    // Avoid dropping food onto the snake or a wall (bounded, a full board keeps the last pick)
+    for (int attempt = 0; mOccupancy && attempt < 64 && !mOccupancy->IsFree(foodX, foodY); ++attempt) {
+        foodX = GetRandomPosition(mMinX + GRID_SIZE, mMaxX - GRID_SIZE, GRID_SIZE);
+        foodY = GetRandomPosition(mMinY + GRID_SIZE, mMaxY - GRID_SIZE, GRID_SIZE);
+    }
+    
     // Add components
     entityManager.AddComponent(foodEntity, Position(foodX, foodY));
     entityManager.AddComponent(foodEntity, Renderable(true, 2)); // Food on layer 2
     entityManager.AddComponent(foodEntity, Food(10, true));
     
-    std::cout << "New food spawned at (" << foodX << ", " << foodY << ")" << std::endl;
+    if (mOccupancy) {
+        mOccupancy->SetFood(foodX, foodY, foodEntity);
+    }
+    
+    if (mVerbose) {
+        std::cout << "New food spawned at (" << foodX << ", " << foodY << ")" << std::endl;
+    }
 }
 
 float CollisionSystem::GetRandomPosition(float min, float max, float gridSize) {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    
     int steps = static_cast<int>((max - min) / gridSize);
-    std::uniform_int_distribution<> dis(0, steps - 1);
-    
-    return min + (dis(gen) * gridSize);
+    return min + (mRandom.Range(0, steps - 1) * gridSize);
 }
 
 } // namespace ECS
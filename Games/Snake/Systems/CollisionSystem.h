@@ -6,6 +6,7 @@
 #include "../Components/Food.h"
 #include "../Components/Wall.h"
 #include "../Components/GameState.h"
+#include "OccupancyGrid.h"
 
 namespace Lite2D {
 namespace ECS {
@@ -25,16 +26,24 @@ public:
     void Shutdown(EntityManager& entityManager) override;
     const char* GetName() const override { return "CollisionSystem"; }
     
+    // Console messages (init, score, game over); off for batch simulation
+    void SetVerbose(bool verbose) { mVerbose = verbose; }
+    
     // Collision detection
     void SetSnakeHeadEntity(Entity snakeHead) { mSnakeHeadEntity = snakeHead; }
     void SetGameStateEntity(Entity gameStateEntity) { mGameStateEntity = gameStateEntity; }
     
     // Game boundaries
     void SetBoundaries(float minX, float minY, float maxX, float maxY);
+    
+    // Board occupancy maintained by SnakeMovementSystem; required for food, wall and self checks
+    void SetOccupancyGrid(OccupancyGrid* grid) { mOccupancy = grid; }
 
 private:
+    bool mVerbose = true;
     Entity mSnakeHeadEntity = INVALID_ENTITY;
     Entity mGameStateEntity = INVALID_ENTITY;
+    OccupancyGrid* mOccupancy = nullptr;
     
     float mMinX = 0.0f, mMinY = 0.0f, mMaxX = 800.0f, mMaxY = 600.0f;
     
@@ -51,7 +60,6 @@ private:
     void HandleBoundaryCollision(EntityManager& entityManager);
     
     // Utility
-    bool IsPositionEqual(float x1, float y1, float x2, float y2, float tolerance = 1.0f);
     void SpawnNewFood(EntityManager& entityManager);
     float GetRandomPosition(float min, float max, float gridSize);
 };
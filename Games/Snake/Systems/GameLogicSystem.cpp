@@ -3,6 +3,7 @@
 #include "ECS/Components/Renderable.h"
 #include "../Components/SnakeHead.h"
 #include "../Components/SnakeSegment.h"
+#include "../Components/SnakeBody.h"
 #include "../Components/Food.h"
 #include "../Components/Wall.h"
 #include <iostream>
@@ -37,11 +38,15 @@ void GameLogicSystem::Update(EntityManager& entityManager, float deltaTime) {
 }
 
 void GameLogicSystem::Initialize(EntityManager& entityManager) {
-    std::cout << "GameLogicSystem initialized" << std::endl;
+    if (mVerbose) {
+        std::cout << "GameLogicSystem initialized" << std::endl;
+    }
 }
 
 void GameLogicSystem::Shutdown(EntityManager& entityManager) {
-    std::cout << "GameLogicSystem shutdown" << std::endl;
+    if (mVerbose) {
+        std::cout << "GameLogicSystem shutdown" << std::endl;
+    }
 }
 
 void GameLogicSystem::StartNewGame(EntityManager& entityManager) {
@@ -57,11 +62,20 @@ void GameLogicSystem::StartNewGame(EntityManager& entityManager) {
     GameState* gameState = entityManager.GetComponent<GameState>(mGameStateEntity);
     if (gameState) {
         gameState->currentState = GameState::PLAYING;
-        std::cout << "New game started!" << std::endl;
+        if (mVerbose) {
+            std::cout << "New game started!" << std::endl;
+        }
     }
 }
 
 void GameLogicSystem::ResetGame(EntityManager& entityManager) {
+    // Destroy the previous snake head (StartNewGame creates a new one)
+    auto heads = entityManager.GetEntitiesWith<SnakeHead>();
+    for (Entity head : heads) {
+        entityManager.DestroyEntity(head);
+    }
+    mSnakeHeadEntity = INVALID_ENTITY;
+    
     // Destroy all snake segments
     auto segments = entityManager.GetEntitiesWith<SnakeSegment>();
     for (Entity segment : segments) {
@@ -108,15 +122,21 @@ void GameLogicSystem::InitializeSnake(EntityManager& entityManager) {
     entityManager.AddComponent(mSnakeHeadEntity, Renderable(true, 1)); // Head on layer 1
     entityManager.AddComponent(mSnakeHeadEntity, SnakeHead(SnakeHead::RIGHT, INITIAL_MOVE_INTERVAL));
     
-    // Create initial snake body
+    // Create initial snake body, neck first in the head's ring
+    SnakeBody body(INITIAL_BODY_CAPACITY);
     for (int i = 1; i <= INITIAL_SNAKE_LENGTH; ++i) {
+        float x = 200.0f - (i * GRID_SIZE);
         Entity segment = entityManager.CreateEntity();
-        entityManager.AddComponent(segment, Position(200.0f - (i * GRID_SIZE), 200.0f));
+        entityManager.AddComponent(segment, Position(x, 200.0f));
         entityManager.AddComponent(segment, Renderable(true, 0)); // Body on layer 0
         entityManager.AddComponent(segment, SnakeSegment(i));
+        body.PushBack({x, 200.0f, segment});
     }
+    entityManager.AddComponent(mSnakeHeadEntity, body);
     
-    std::cout << "Snake initialized with " << INITIAL_SNAKE_LENGTH + 1 << " segments" << std::endl;
+    if (mVerbose) {
+        std::cout << "Snake initialized with " << INITIAL_SNAKE_LENGTH + 1 << " segments" << std::endl;
+    }
 }
 
 void GameLogicSystem::InitializeFood(EntityManager& entityManager) {
@@ -126,14 +146,18 @@ void GameLogicSystem::InitializeFood(EntityManager& entityManager) {
     entityManager.AddComponent(foodEntity, Renderable(true, 2)); // Food on layer 2
     entityManager.AddComponent(foodEntity, Food(10, true));
     
-    std::cout << "Food initialized" << std::endl;
+    if (mVerbose) {
+        std::cout << "Food initialized" << std::endl;
+    }
 }
 
 void GameLogicSystem::InitializeWalls(EntityManager& entityManager) {
     // For now, we'll rely on boundary checking instead of creating wall entities
     // In a more complex version, you could create actual wall entities here
     
-    std::cout << "Walls initialized (boundary checking enabled)" << std::endl;
+    if (mVerbose) {
+        std::cout << "Walls initialized (boundary checking enabled)" << std::endl;
+    }
 }
 
 void GameLogicSystem::CheckLevelProgression(EntityManager& entityManager) {
@@ -154,8 +178,10 @@ void GameLogicSystem::CheckLevelProgression(EntityManager& entityManager) {
             }
         }
         
-        std::cout << "Level up! Now at level " << gameState->level 
-                  << " (Score: " << gameState->score << ")" << std::endl;
+        if (mVerbose) {
+            std::cout << "Level up! Now at level " << gameState->level 
+                      << " (Score: " << gameState->score << ")" << std::endl;
+        }
     }
 }
 
@@ -23,9 +23,13 @@ public:
     void Shutdown(EntityManager& entityManager) override;
     const char* GetName() const override { return "GameLogicSystem"; }
     
+    // Console messages (init, score, game over); off for batch simulation
+    void SetVerbose(bool verbose) { mVerbose = verbose; }
+    
     // Game management
     void SetGameStateEntity(Entity gameStateEntity) { mGameStateEntity = gameStateEntity; }
     void SetSnakeHeadEntity(Entity snakeHeadEntity) { mSnakeHeadEntity = snakeHeadEntity; }
+    Entity GetSnakeHeadEntity() const { return mSnakeHeadEntity; }
     
     // Game actions
     void StartNewGame(EntityManager& entityManager);
@@ -34,6 +38,7 @@ public:
     void ResumeGame();
 
 private:
+    bool mVerbose = true;
     Entity mGameStateEntity = INVALID_ENTITY;
     Entity mSnakeHeadEntity = INVALID_ENTITY;
     
@@ -47,6 +52,7 @@ private:
     static constexpr float GRID_SIZE = 20.0f;
     static constexpr float INITIAL_MOVE_INTERVAL = 0.2f;
     static constexpr int INITIAL_SNAKE_LENGTH = 3;
+    static constexpr size_t INITIAL_BODY_CAPACITY = 64;
     static constexpr int SCORE_PER_LEVEL = 50;
 };
 
@@ -19,14 +19,14 @@ void InputSystem::Shutdown(EntityManager& entityManager) {
     std::cout << "InputSystem shutdown" << std::endl;
 }
 
-void InputSystem::ProcessEvent(SDL_Event& event, EntityManager& entityManager) {
+void InputSystem::ProcessEvent(const SDL_Event& event, EntityManager& entityManager) {
     if (event.type == SDL_EVENT_KEY_DOWN) {
         HandleSnakeMovement(event, entityManager);
         HandleGameControls(event, entityManager);
     }
 }
 
-void InputSystem::HandleSnakeMovement(SDL_Event& event, EntityManager& entityManager) {
+void InputSystem::HandleSnakeMovement(const SDL_Event& event, EntityManager& entityManager) {
     if (mSnakeHeadEntity == INVALID_ENTITY) return;
     
     SnakeHead* snakeHead = entityManager.GetComponent<SnakeHead>(mSnakeHeadEntity);
@@ -49,7 +49,7 @@ void InputSystem::HandleSnakeMovement(SDL_Event& event, EntityManager& entityMan
     }
 }
 
-void InputSystem::HandleGameControls(SDL_Event& event, EntityManager& entityManager) {
+void InputSystem::HandleGameControls(const SDL_Event& event, EntityManager& entityManager) {
     if (mGameStateEntity == INVALID_ENTITY) return;
     
     GameState* gameState = entityManager.GetComponent<GameState>(mGameStateEntity);
@@ -25,7 +25,7 @@ public:
     const char* GetName() const override { return "InputSystem"; }
     
     // Input handling
-    void ProcessEvent(SDL_Event& event, EntityManager& entityManager);
+    void ProcessEvent(const SDL_Event& event, EntityManager& entityManager);
     
     // Game controls
     void SetSnakeHeadEntity(Entity snakeHead) { mSnakeHeadEntity = snakeHead; }
@@ -36,8 +36,8 @@ private:
     Entity mGameStateEntity = INVALID_ENTITY;
     
     // Input processing helpers
-    void HandleSnakeMovement(SDL_Event& event, EntityManager& entityManager);
-    void HandleGameControls(SDL_Event& event, EntityManager& entityManager);
+    void HandleSnakeMovement(const SDL_Event& event, EntityManager& entityManager);
+    void HandleGameControls(const SDL_Event& event, EntityManager& entityManager);
     SnakeHead::Direction GetDirectionFromKey(SDL_Keycode key);
 };
 
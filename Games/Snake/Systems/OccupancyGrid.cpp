@@ -0,0 +1,93 @@
+#include "OccupancyGrid.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Lite2D {
+namespace ECS {
+
+void OccupancyGrid::Configure(float minX, float minY, float maxX, float maxY, float cellSize) {
+    mMinX = minX;
+    mMinY = minY;
+    mCellSize = cellSize > 0.0f ? cellSize : 1.0f;
+    mColumns = std::max(0, static_cast<int>(std::ceil((maxX - minX) / mCellSize)));
+    mRows = std::max(0, static_cast<int>(std::ceil((maxY - minY) / mCellSize)));
+    mCells.assign(static_cast<size_t>(mColumns) * mRows, Cell());
+}
+
+void OccupancyGrid::Clear() {
+    mCells.assign(mCells.size(), Cell());
+}
+
+int OccupancyGrid::CellIndex(float x, float y) const {
+    // Positions sit on cell corners; round so float drift cannot push one into the neighbour
+    int column = static_cast<int>(std::floor((x - mMinX) / mCellSize + 0.5f));
+    int row = static_cast<int>(std::floor((y - mMinY) / mCellSize + 0.5f));
+    
+    if (column < 0 || row < 0 || column >= mColumns || row >= mRows) {
+        return -1;
+    }
+    return row * mColumns + column;
+}
+
+void OccupancyGrid::AddSnake(float x, float y) {
+    int index = CellIndex(x, y);
+    if (index >= 0) {
+        mCells[index].snake++;
+    }
+}
+
+void OccupancyGrid::RemoveSnake(float x, float y) {
+    int index = CellIndex(x, y);
+    if (index >= 0 && mCells[index].snake > 0) {
+        mCells[index].snake--;
+    }
+}
+
+void OccupancyGrid::MoveSnake(float fromX, float fromY, float toX, float toY) {
+    RemoveSnake(fromX, fromY);
+    AddSnake(toX, toY);
+}
+
+bool OccupancyGrid::HasSnake(float x, float y) const {
+    int index = CellIndex(x, y);
+    return index >= 0 && mCells[index].snake > 0;
+}
+
+void OccupancyGrid::SetFood(float x, float y, Entity food) {
+    int index = CellIndex(x, y);
+    if (index >= 0) {
+        mCells[index].food = food;
+    }
+}
+
+void OccupancyGrid::ClearFood(float x, float y) {
+    SetFood(x, y, INVALID_ENTITY);
+}
+
+Entity OccupancyGrid::GetFood(float x, float y) const {
+    int index = CellIndex(x, y);
+    return index >= 0 ? mCells[index].food : INVALID_ENTITY;
+}
+
+void OccupancyGrid::SetWall(float x, float y, bool wall) {
+    int index = CellIndex(x, y);
+    if (index >= 0) {
+        mCells[index].wall = wall;
+    }
+}
+
+bool OccupancyGrid::HasWall(float x, float y) const {
+    int index = CellIndex(x, y);
+    return index >= 0 && mCells[index].wall;
+}
+
+bool OccupancyGrid::IsFree(float x, float y) const {
+    int index = CellIndex(x, y);
+    if (index < 0) return false;
+    
+    const Cell& cell = mCells[index];
+    return cell.snake == 0 && !cell.wall && cell.food == INVALID_ENTITY;
+}
+
+} // namespace ECS
+} // namespace Lite2D
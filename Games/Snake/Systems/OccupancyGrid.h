@@ -0,0 +1,67 @@
+#pragma once
+
+#include "ECS/Entity.h"
+#include <cstdint>
+#include <vector>
+
+namespace Lite2D {
+namespace ECS {
+
+/**
+ * Occupancy Grid for the Snake board
+ * One cell per grid square recording what is in it, so collision checks are a
+ * single lookup instead of a scan over every segment, wall and food entity.
+ * Growth fills the vacated neck cell, so segments never share a square in
+ * normal play. Snake cells are still reference counted: a snake that runs into
+ * itself overlaps for the step before the collision ends the game, and
+ * removing one of two segments must leave the square occupied.
+ */
+class OccupancyGrid {
+public:
+    OccupancyGrid() = default;
+    
+    // Board layout in world units, cells are cellSize x cellSize starting at (minX, minY)
+    void Configure(float minX, float minY, float maxX, float maxY, float cellSize);
+    void Clear();
+    
+    // Snake body segments
+    void AddSnake(float x, float y);
+    void RemoveSnake(float x, float y);
+    void MoveSnake(float fromX, float fromY, float toX, float toY);
+    bool HasSnake(float x, float y) const;
+    
+    // Food and walls (one per cell)
+    void SetFood(float x, float y, Entity food);
+    void ClearFood(float x, float y);
+    Entity GetFood(float x, float y) const;
+    
+    void SetWall(float x, float y, bool wall = true);
+    bool HasWall(float x, float y) const;
+    
+    // True when nothing occupies the cell (outside the board counts as occupied)
+    bool IsFree(float x, float y) const;
+    
+    int GetColumns() const { return mColumns; }
+    int GetRows() const { return mRows; }
+    float GetCellSize() const { return mCellSize; }
+
+private:
+    struct Cell {
+        uint16_t snake = 0;
+        bool wall = false;
+        Entity food = INVALID_ENTITY;
+    };
+    
+    std::vector<Cell> mCells;
+    int mColumns = 0;
+    int mRows = 0;
+    float mMinX = 0.0f;
+    float mMinY = 0.0f;
+    float mCellSize = 20.0f;
+    
+    // Index of the cell containing (x, y), or -1 when it is off the board
+    int CellIndex(float x, float y) const;
+};
+
+} // namespace ECS
+} // namespace Lite2D
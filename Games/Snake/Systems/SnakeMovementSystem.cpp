@@ -1,7 +1,8 @@
 #include "SnakeMovementSystem.h"
 #include "ECS/Components/Position.h"
 #include "ECS/Components/Renderable.h"
-#include <algorithm>
+#include "../Components/Food.h"
+#include "../Components/Wall.h"
 #include <iostream>
 
 namespace Lite2D {
@@ -38,45 +39,33 @@ void SnakeMovementSystem::Update(EntityManager& entityManager, float deltaTime)
         // Update direction
         head->currentDirection = head->nextDirection;
         
-        // Store current head position for body segments
         Position* headPos = entityManager.GetComponent<Position>(mSnakeHeadEntity);
-        if (headPos) {
-            PositionHistory history;
-            history.x = headPos->x;
-            history.y = headPos->y;
-            history.timestamp = head->moveTimer;
-            mPositionHistory.push_back(history);
-            
-            // Limit history size
-            if (mPositionHistory.size() > MAX_HISTORY_SIZE) {
-                mPositionHistory.erase(mPositionHistory.begin());
-            }
-        }
+        if (!headPos) return;
+        
+        // The body follows into the cell the head is leaving
+        float previousX = headPos->x;
+        float previousY = headPos->y;
         
         // Move the snake
         MoveSnakeHead(entityManager, head);
-        MoveSnakeBody(entityManager, head);
         
-        // Add new segments if needed
-        while (head->segmentsToAdd > 0) {
-            // Find the last segment position to add new segment
-            if (!mPositionHistory.empty()) {
-                auto lastPos = mPositionHistory.back();
-                AddSnakeSegment(entityManager, lastPos.x, lastPos.y, -1);
-                head->segmentsToAdd--;
-            } else {
-                break;
-            }
+        SnakeBody* body = entityManager.GetComponent<SnakeBody>(mSnakeHeadEntity);
+        if (body) {
+            MoveSnakeBody(entityManager, head, *body, previousX, previousY);
         }
     }
 }
 
 void SnakeMovementSystem::Initialize(EntityManager& entityManager) {
-    std::cout << "SnakeMovementSystem initialized" << std::endl;
+    if (mVerbose) {
+        std::cout << "SnakeMovementSystem initialized" << std::endl;
+    }
 }
 
 void SnakeMovementSystem::Shutdown(EntityManager& entityManager) {
-    std::cout << "SnakeMovementSystem shutdown" << std::endl;
+    if (mVerbose) {
+        std::cout << "SnakeMovementSystem shutdown" << std::endl;
+    }
 }
 
 void SnakeMovementSystem::MoveSnakeHead(EntityManager& entityManager, SnakeHead* head) {
@@ -86,49 +75,46 @@ void SnakeMovementSystem::MoveSnakeHead(EntityManager& entityManager, SnakeHead*
     float dirX, dirY;
     head->GetDirectionVector(dirX, dirY);
     
-    // Move head by grid size (assuming 20x20 grid)
-    const float GRID_SIZE = 20.0f;
+    // Move head by one grid cell
     headPos->x += dirX * GRID_SIZE;
     headPos->y += dirY * GRID_SIZE;
 }
 
-void SnakeMovementSystem::MoveSnakeBody(EntityManager& entityManager, SnakeHead* head) {
-    // Get all snake segments
-    auto segments = entityManager.GetEntitiesWith<SnakeSegment>();
-    
-    // Sort segments by index (head = 0, body = 1, 2, 3...)
-    std::sort(segments.begin(), segments.end(), 
-        [&entityManager](Entity a, Entity b) {
-            SnakeSegment* segA = entityManager.GetComponent<SnakeSegment>(a);
-            SnakeSegment* segB = entityManager.GetComponent<SnakeSegment>(b);
-            if (!segA || !segB) return false;
-            return segA->segmentIndex < segB->segmentIndex;
-        });
-    
-    // Move each body segment to the position of the previous segment
-    // Use the position history to track where each segment should move
-    for (size_t i = 0; i < segments.size() && i < mPositionHistory.size(); ++i) {
-        Position* segmentPos = entityManager.GetComponent<Position>(segments[i]);
-        if (!segmentPos) continue;
-        
-        // Each segment follows the position that was recorded 'i' steps ago
-        // The most recent position (size()-1) goes to the first segment after head
-        // The second most recent (size()-2) goes to the second segment, etc.
-        size_t historyIndex = mPositionHistory.size() - 1 - i;
-        if (historyIndex < mPositionHistory.size()) {
-            segmentPos->x = mPositionHistory[historyIndex].x;
-            segmentPos->y = mPositionHistory[historyIndex].y;
-        }
+void SnakeMovementSystem::MoveSnakeBody(EntityManager& entityManager, SnakeHead* head, SnakeBody& body,
+                                        float x, float y) {
+    // Growing: a new segment fills the vacated cell and the tail stays put
+    if (head->segmentsToAdd > 0) {
+        Entity segment = AddSnakeSegment(entityManager, x, y, static_cast<int>(body.GetLength()) + 1);
+        body.PushFront({x, y, segment});
+        head->segmentsToAdd--;
+        return;
     }
+    
+    if (body.IsEmpty()) return;
+    
+    // Otherwise the tail segment jumps to the front; nothing in between moves
+    SnakeBody::Cell tail = body.PopBack();
+    mOccupancy.MoveSnake(tail.x, tail.y, x, y);
+    
+    Position* segmentPos = entityManager.GetComponent<Position>(tail.segment);
+    if (segmentPos) {
+        segmentPos->x = x;
+        segmentPos->y = y;
+    }
+    
+    body.PushFront({x, y, tail.segment});
 }
 
-void SnakeMovementSystem::AddSnakeSegment(EntityManager& entityManager, float x, float y, int segmentIndex) {
+Entity SnakeMovementSystem::AddSnakeSegment(EntityManager& entityManager, float x, float y, int segmentIndex) {
     Entity newSegment = entityManager.CreateEntity();
     
     // Add components
     entityManager.AddComponent(newSegment, Position(x, y));
     entityManager.AddComponent(newSegment, Renderable(true, 0)); // Body segments on layer 0
     entityManager.AddComponent(newSegment, SnakeSegment(segmentIndex));
+    
+    mOccupancy.AddSnake(x, y);
+    return newSegment;
 }
 
 void SnakeMovementSystem::GrowSnake(EntityManager& entityManager) {
@@ -140,5 +126,31 @@ void SnakeMovementSystem::GrowSnake(EntityManager& entityManager) {
     head->segmentsToAdd++;
 }
 
+void SnakeMovementSystem::ConfigureGrid(float minX, float minY, float maxX, float maxY, float cellSize) {
+    mOccupancy.Configure(minX, minY, maxX, maxY, cellSize);
+}
+
+void SnakeMovementSystem::RebuildOccupancy(EntityManager& entityManager) {
+    mOccupancy.Clear();
+    
+    for (Entity segment : entityManager.GetFrameEntitiesWith<SnakeSegment, Position>()) {
+        Position* position = entityManager.GetComponent<Position>(segment);
+        mOccupancy.AddSnake(position->x, position->y);
+    }
+    
+    for (Entity wall : entityManager.GetFrameEntitiesWith<Wall, Position>()) {
+        Position* position = entityManager.GetComponent<Position>(wall);
+        mOccupancy.SetWall(position->x, position->y);
+    }
+    
+    for (Entity food : entityManager.GetFrameEntitiesWith<Food, Position>()) {
+        Food* foodComponent = entityManager.GetComponent<Food>(food);
+        Position* position = entityManager.GetComponent<Position>(food);
+        if (foodComponent->isActive) {
+            mOccupancy.SetFood(position->x, position->y, food);
+        }
+    }
+}
+
 } // namespace ECS
 } // namespace Lite2D
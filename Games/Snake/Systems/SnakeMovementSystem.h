@@ -4,7 +4,9 @@
 #include "ECS/EntityManager.h"
 #include "../Components/SnakeHead.h"
 #include "../Components/SnakeSegment.h"
+#include "../Components/SnakeBody.h"
 #include "../Components/GameState.h"
+#include "OccupancyGrid.h"
 
 namespace Lite2D {
 namespace ECS {
@@ -24,30 +26,36 @@ public:
     void Shutdown(EntityManager& entityManager) override;
     const char* GetName() const override { return "SnakeMovementSystem"; }
     
+    // Console messages (init, score, game over); off for batch simulation
+    void SetVerbose(bool verbose) { mVerbose = verbose; }
+    
     // Snake management
     void SetSnakeHeadEntity(Entity snakeHead) { mSnakeHeadEntity = snakeHead; }
     void SetGameStateEntity(Entity gameStateEntity) { mGameStateEntity = gameStateEntity; }
     
     // Snake growth
     void GrowSnake(EntityManager& entityManager);
+    
+    // Board occupancy, kept current as segments move. Collision checks read it
+    // instead of scanning entities.
+    void ConfigureGrid(float minX, float minY, float maxX, float maxY, float cellSize = GRID_SIZE);
+    void RebuildOccupancy(EntityManager& entityManager); // Full rescan, after a new game is set up
+    OccupancyGrid& GetOccupancyGrid() { return mOccupancy; }
+    const OccupancyGrid& GetOccupancyGrid() const { return mOccupancy; }
 
 private:
+    bool mVerbose = true;
     Entity mSnakeHeadEntity = INVALID_ENTITY;
     Entity mGameStateEntity = INVALID_ENTITY;
     
     // Movement helpers
     void MoveSnakeHead(EntityManager& entityManager, SnakeHead* head);
-    void MoveSnakeBody(EntityManager& entityManager, SnakeHead* head);
-    void AddSnakeSegment(EntityManager& entityManager, float x, float y, int segmentIndex);
+    void MoveSnakeBody(EntityManager& entityManager, SnakeHead* head, SnakeBody& body, float x, float y);
+    Entity AddSnakeSegment(EntityManager& entityManager, float x, float y, int segmentIndex);
     
-    // Position tracking for body movement
-    struct PositionHistory {
-        float x, y;
-        float timestamp;
-    };
+    static constexpr float GRID_SIZE = 20.0f;
     
-    std::vector<PositionHistory> mPositionHistory;
-    static constexpr int MAX_HISTORY_SIZE = 1000; // Prevent unlimited growth
+    OccupancyGrid mOccupancy;
 };
 
 } // namespace ECS
@@ -1,24 +1,100 @@
 #include <iostream>
+#include <iomanip>
+#include <cstring>
+#include <cstdlib>
+#include <string>
 #include "Game/SnakeGame.h"
+#include "Game/SnakeSimulation.h"
 
 using namespace Lite2D::ECS;
 
-int main() {
+// Batch mode: plays games with the built-in bot across all cores, no window
+static int RunHeadless(size_t gameCount, size_t threadCount, uint32_t seed) {
+    std::cout << "Running " << gameCount << " headless games..." << std::endl;
+    
+    SnakeBatchResult result = SnakeSimulation::RunBatch(gameCount, SnakeSimulation::GreedyPolicy, threadCount, seed);
+    
+    std::cout << "\n=== Headless Batch Results ===" << std::endl;
+    std::cout << "Games: " << result.games << " (" << result.threads << " threads)" << std::endl;
+    std::cout << "Total Time: " << std::fixed << std::setprecision(2) << result.seconds * 1000.0 << "ms" << std::endl;
+    std::cout << "Throughput: " << std::setprecision(0) << result.GetGamesPerSecond() << " games/sec, "
+              << result.GetStepsPerSecond() << " steps/sec" << std::endl;
+    std::cout << "Average Score: " << std::setprecision(1) << result.averageScore
+              << " (best " << result.bestScore << ")" << std::endl;
+    std::cout << "Deaths: " << result.deaths << "/" << result.games << std::endl;
+    std::cout << "State Hash: " << std::hex << result.stateHash << std::dec << std::endl;
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    // Usage: snake_game [--headless [games]] [--threads count] [--seed value]
+    //                   [--record input.bin] [--replay input.bin]
+    bool headless = false;
+    size_t headlessGames = 10000;
+    size_t threadCount = 0;
+    uint32_t seed = 1;
+    bool seedSet = false;
+    std::string recordPath;
+    std::string replayPath;
+    
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--headless") == 0) {
+            headless = true;
+            if (i + 1 < argc && std::atoi(argv[i + 1]) > 0) {
+                headlessGames = static_cast<size_t>(std::atoi(argv[++i]));
+            }
+        } else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threadCount = static_cast<size_t>(std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            seedSet = true;
+        } else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            recordPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replayPath = argv[++i];
+        }
+    }
+    
+    if (headless) {
+        return RunHeadless(headlessGames, threadCount, seed);
+    }
+    
+    // Recorded session played back without a window, seed and size from the recording
+    if (!replayPath.empty()) {
+        SnakeGame game;
+        if (!game.LoadReplay(replayPath) || !game.Initialize(800, 600, true)) {
+            return -1;
+        }
+        game.RunReplay();
+        return 0;
+    }
+    
     std::cout << "=== Lite2D Snake Game ===" << std::endl;
     std::cout << "A demonstration of the Lite2D ECS Game Engine" << std::endl;
     std::cout << "=========================" << std::endl;
     
     // Create and initialize game
     SnakeGame game;
+    if (seedSet) {
+        game.SetSeed(seed);
+    }
     
     if (!game.Initialize(800, 600)) {
         std::cerr << "Failed to initialize Snake Game!" << std::endl;
         return -1;
     }
     
+    if (!recordPath.empty()) {
+        game.StartRecording();
+    }
+    
     // Run the game
     game.Run();
     
+    if (!recordPath.empty()) {
+        game.SaveRecording(recordPath);
+    }
+    
     // Game will shutdown automatically when done
     std::cout << "Thanks for playing!" << std::endl;
     
@@ -0,0 +1,202 @@
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <filesystem>
+#include <vector>
+#include "ECS/EntityManager.h"
+#include "ECS/Snapshot.h"
+#include "ECS/RewindBuffer.h"
+#include "ECS/WorldScheduler.h"
+#include "ECS/Systems/MovementSystem.h"
+#include "Utils/ThreadPool.h"
+#include "ECS/Components/Position.h"
+#include "ECS/Components/Velocity.h"
+#include "ECS/Components/Renderable.h"
+
+using namespace Lite2D::ECS;
+
+// Entity create/destroy round trip
+static void BM_CreateDestroyEntities(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    EntityManager entityManager;
+    std::vector<Entity> entities;
+    entities.reserve(count);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            entities.push_back(entityManager.CreateEntity());
+        }
+        for (Entity entity : entities) {
+            entityManager.DestroyEntity(entity);
+        }
+        entities.clear();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_CreateDestroyEntities)->Arg(100)->Arg(1000)->Arg(9000);
+
+// Add then remove one component on every entity
+static void BM_AddRemoveComponent(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    EntityManager entityManager;
+    entityManager.RegisterComponentType<Position>();
+
+    std::vector<Entity> entities;
+    for (size_t i = 0; i < count; ++i) {
+        entities.push_back(entityManager.CreateEntity());
+    }
+
+    for (auto _ : state) {
+        for (Entity entity : entities) {
+            entityManager.AddComponent(entity, Position(1.0f, 2.0f));
+        }
+        for (Entity entity : entities) {
+            entityManager.RemoveComponent<Position>(entity);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_AddRemoveComponent)->Arg(100)->Arg(1000)->Arg(9000);
+
+// Two-component query over 9000 entities where range(0)% match
+static void BM_QueryDensity(benchmark::State& state) {
+    const size_t count = 9000;
+    const size_t densityPercent = static_cast<size_t>(state.range(0));
+    EntityManager entityManager;
+
+    for (size_t i = 0; i < count; ++i) {
+        Entity entity = entityManager.CreateEntity();
+        entityManager.AddComponent(entity, Position(0.0f, 0.0f));
+        if ((i % 100) < densityPercent) {
+            entityManager.AddComponent(entity, Velocity(1.0f, 1.0f));
+        }
+    }
+
+    size_t matches = 0;
+    for (auto _ : state) {
+        auto entities = entityManager.GetEntitiesWith<Position, Velocity>();
+        matches = entities.size();
+        benchmark::DoNotOptimize(entities.data());
+    }
+
+    state.counters["matches"] = static_cast<double>(matches);
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_QueryDensity)->Arg(1)->Arg(10)->Arg(50)->Arg(100);
+
+// One scheduler step over many small worlds (16 moving entities each), all cores
+static void BM_WorldSchedulerStep(benchmark::State& state) {
+    const int worldCount = static_cast<int>(state.range(0));
+    ThreadPool threadPool;
+    WorldScheduler scheduler(threadPool);
+
+    for (int i = 0; i < worldCount; ++i) {
+        World& world = scheduler.CreateWorld(static_cast<uint32_t>(i));
+        world.AddSystem<MovementSystem>();
+
+        EntityManager& entityManager = world.GetEntityManager();
+        for (int e = 0; e < 16; ++e) {
+            Entity entity = entityManager.CreateEntity();
+            entityManager.AddComponent(entity, Position(0.0f, 0.0f));
+            entityManager.AddComponent(entity, Velocity(1.0f, 1.0f));
+        }
+    }
+
+    for (auto _ : state) {
+        scheduler.StepAll(0.016f);
+    }
+
+    state.counters["threads"] = static_cast<double>(threadPool.GetThreadCount());
+    state.SetItemsProcessed(state.iterations() * worldCount);
+}
+BENCHMARK(BM_WorldSchedulerStep)->Arg(64)->Arg(4096)->Unit(benchmark::kMicrosecond);
+
+// Snapshot of a full world (MAX_ENTITIES - 1 entities, three components each): range(0) 0 = save, 1 = load
+static void BM_Snapshot(benchmark::State& state) {
+    const bool load = state.range(0) != 0;
+    EntityManager entityManager;
+    for (Entity i = 1; i < MAX_ENTITIES; ++i) {
+        Entity entity = entityManager.CreateEntity();
+        entityManager.AddComponent(entity, Position(static_cast<float>(i), 0.0f));
+        entityManager.AddComponent(entity, Velocity(1.0f, 1.0f));
+        entityManager.AddComponent(entity, Renderable(true, 1));
+    }
+
+    SnapshotWriter writer;
+    entityManager.SaveSnapshot(writer);
+
+    for (auto _ : state) {
+        if (load) {
+            SnapshotReader reader(writer.GetData(), writer.GetSize());
+            benchmark::DoNotOptimize(entityManager.LoadSnapshot(reader));
+        } else {
+            writer.Clear();
+            entityManager.SaveSnapshot(writer);
+            benchmark::DoNotOptimize(writer.GetData());
+        }
+    }
+
+    state.counters["bytes"] = static_cast<double>(writer.GetSize());
+    state.SetBytesProcessed(state.iterations() * writer.GetSize());
+}
+BENCHMARK(BM_Snapshot)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+// Loading that world from a file: range(0) 0 = read into a buffer then parse, 1 = parse the mapped file
+static void BM_SnapshotLoadFile(benchmark::State& state) {
+    const bool mapped = state.range(0) != 0;
+    EntityManager entityManager;
+    for (Entity i = 1; i < MAX_ENTITIES; ++i) {
+        Entity entity = entityManager.CreateEntity();
+        entityManager.AddComponent(entity, Position(static_cast<float>(i), 0.0f));
+        entityManager.AddComponent(entity, Velocity(1.0f, 1.0f));
+        entityManager.AddComponent(entity, Renderable(true, 1));
+    }
+
+    const std::string path = (std::filesystem::temp_directory_path() / "lite2d_bench_snapshot.bin").string();
+    entityManager.SaveSnapshot(path);
+
+    std::vector<uint8_t> data;
+    for (auto _ : state) {
+        if (mapped) {
+            benchmark::DoNotOptimize(entityManager.LoadSnapshot(path));
+        } else {
+            ReadSnapshotFile(path, data);
+            SnapshotReader reader(data.data(), data.size());
+            benchmark::DoNotOptimize(entityManager.LoadSnapshot(reader));
+        }
+    }
+
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_SnapshotLoadFile)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+// Recording one frame of rewind history for a 9,999-entity world where every Position moved
+static void BM_RewindRecord(benchmark::State& state) {
+    World world(1);
+    world.AddSystem<MovementSystem>();
+    EntityManager& entityManager = world.GetEntityManager();
+    for (Entity i = 1; i < MAX_ENTITIES; ++i) {
+        Entity entity = entityManager.CreateEntity();
+        entityManager.AddComponent(entity, Position(static_cast<float>(i), 0.0f));
+        entityManager.AddComponent(entity, Velocity(1.0f, 1.0f));
+        entityManager.AddComponent(entity, Renderable(true, 1));
+    }
+
+    RewindBuffer rewind;
+    SnapshotWriter frame;
+    for (auto _ : state) {
+        state.PauseTiming();
+        world.Step(0.016f);
+        state.ResumeTiming();
+
+        frame.Clear();
+        world.SaveSnapshot(frame);
+        rewind.Push(frame);
+    }
+
+    state.counters["dirty_pages"] = static_cast<double>(rewind.GetLastDirtyPageCount());
+    state.counters["pages"] = static_cast<double>(rewind.GetLastPageCount());
+    state.counters["frames"] = static_cast<double>(rewind.GetDepth());
+}
+BENCHMARK(BM_RewindRecord)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include "ECS/EntityManager.h"
+#include "ECS/Components/Position.h"
+#include "ECS/Components/Renderable.h"
+#include "Rendering/HeadlessRenderer.h"
+#include "Rendering/RenderSystem.h"
+#include "Rendering/SpriteGeometry.h"
+
+using namespace Lite2D::ECS;
+
+// Full RenderSystem frame into an offscreen target: collect, sort, build vertices, submit.
+// Args: entity count, worker threads
+static void BM_RenderSystemUpdate(benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+    HeadlessRenderer headlessRenderer;
+    if (!headlessRenderer.Initialize(320, 240)) {
+        state.SkipWithError("Failed to create headless renderer");
+        return;
+    }
+
+    EntityManager entityManager;
+    RenderSystem renderSystem(headlessRenderer.GetRendererObject());
+    renderSystem.SetWorkerThreads(static_cast<size_t>(state.range(1)));
+
+    for (int i = 0; i < count; ++i) {
+        Entity entity = entityManager.CreateEntity();
+        entityManager.AddComponent(entity, Position(static_cast<float>(i % 320), static_cast<float>((i / 320) % 240)));
+        entityManager.AddComponent(entity, Renderable(true, i % 4));
+    }
+
+    for (auto _ : state) {
+        renderSystem.Update(entityManager, 0.016f);
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+// 1000 entities single-threaded, then 9000 across 1, 2, 4 and every hardware thread
+static void RenderThreadSweep(benchmark::internal::Benchmark* benchmark) {
+    benchmark->Args({1000, 1});
+    for (int64_t threads : {1, 2, 4}) {
+        benchmark->Args({9000, threads});
+    }
+    const int64_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    if (hardwareThreads != 1 && hardwareThreads != 2 && hardwareThreads != 4) {
+        benchmark->Args({9000, hardwareThreads});
+    }
+}
+BENCHMARK(BM_RenderSystemUpdate)->Apply(RenderThreadSweep)->Unit(benchmark::kMicrosecond);
+
+// Render-item to vertex building alone (RenderSystem's per-thread builder), without rasterization
+static void BM_BuildRenderGeometry(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    std::vector<Position> positions;
+    std::vector<Renderable> renderables;
+    for (size_t i = 0; i < count; ++i) {
+        positions.emplace_back(static_cast<float>(i % 800), static_cast<float>((i / 800) % 600));
+        renderables.emplace_back(true, static_cast<int>(i * 4 / count));
+    }
+
+    SpriteChunk chunk;
+    for (auto _ : state) {
+        chunk.Clear();
+        BuildSpriteChunk(positions.data(), renderables.data(), count, 0.0f, 0.0f, true, chunk);
+        benchmark::DoNotOptimize(chunk.geometry.GetVertices());
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_BuildRenderGeometry)->Arg(1000)->Arg(100000);
@@ -0,0 +1,244 @@
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "ECS/EntityManager.h"
+#include "ECS/Systems/MovementSystem.h"
+#include "ECS/Systems/EmitterSystem.h"
+#include "ECS/Components/Emitter.h"
+#include "Particles/ParticleBuffer.h"
+#include "Utils/Random.h"
+#include "Input/InputManager.h"
+#include "Input/ActionMap.h"
+#include "ECS/Components/Position.h"
+#include "ECS/Components/Velocity.h"
+#include "Systems/CollisionSystem.h"
+#include "Systems/ParticleSystem.h"
+
+using namespace Lite2D::ECS;
+
+// MovementSystem over N moving entities
+static void BM_MovementSystem(benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+    EntityManager entityManager;
+    MovementSystem movementSystem;
+    movementSystem.SetBoundaries(0, 0, 800, 600);
+    movementSystem.EnableBoundaryClamping(true);
+    movementSystem.SetMaxSpeed(200.0f);
+
+    for (int i = 0; i < count; ++i) {
+        Entity entity = entityManager.CreateEntity();
+        entityManager.AddComponent(entity, Position(static_cast<float>(i % 800), static_cast<float>(i % 600)));
+        entityManager.AddComponent(entity, Velocity(static_cast<float>(i % 50), static_cast<float>((i + 1) % 50)));
+    }
+
+    for (auto _ : state) {
+        movementSystem.Update(entityManager, 0.016f);
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_MovementSystem)->Arg(100)->Arg(1000)->Arg(9000);
+
+// Particle-to-particle collision detection and response
+static void BM_ParticleCollision(benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+    EntityManager entityManager;
+    CollisionSystem collisionSystem;
+    collisionSystem.SetBoundaries(0, 0, 1920, 1080);
+
+    // Deterministic grid placement with some overlap
+    for (int i = 0; i < count; ++i) {
+        Entity entity = entityManager.CreateEntity();
+        float x = 20.0f + (i % 80) * 23.0f;
+        float y = 20.0f + ((i / 80) % 45) * 23.0f;
+        entityManager.AddComponent(entity, Position(x, y));
+        entityManager.AddComponent(entity, Velocity(static_cast<float>(i % 7) - 3.0f, static_cast<float>(i % 5) - 2.0f));
+        entityManager.AddComponent(entity, Particle(12.0f, 1.0f));
+    }
+
+    for (auto _ : state) {
+        collisionSystem.Update(entityManager, 0.016f);
+    }
+
+    state.counters["collisions"] = collisionSystem.GetCollisionCount();
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ParticleCollision)->Arg(100)->Arg(500)->Arg(1000);
+
+// One simulated second at 60 Hz spawning 10k particles/sec with a 0.5s lifetime
+// (~5000 alive). Arg: 0 = create/destroy entities, 1 = pooled
+static void BM_ParticleSpawnChurn(benchmark::State& state) {
+    const bool pooled = state.range(0) != 0;
+    const int framesPerSecond = 60;
+    const int spawnsPerSecond = 10000;
+    const float deltaTime = 1.0f / framesPerSecond;
+
+    EntityManager entityManager;
+    ParticleSystem particleSystem;
+    particleSystem.EnablePooling(pooled);
+    particleSystem.SetLifetimeRange(0.5f, 0.5f);
+
+    // Reach steady state before timing
+    auto RunSecond = [&]() {
+        for (int frame = 0; frame < framesPerSecond; ++frame) {
+            for (int i = 0; i < spawnsPerSecond / framesPerSecond; ++i) {
+                particleSystem.SpawnRandomParticle(entityManager);
+            }
+            particleSystem.Update(entityManager, deltaTime);
+        }
+    };
+    RunSecond();
+
+    for (auto _ : state) {
+        RunSecond();
+    }
+
+    state.counters["alive"] = particleSystem.GetActiveParticleCount();
+    state.counters["entities"] = static_cast<double>(entityManager.GetEntityCount());
+    state.SetItemsProcessed(state.iterations() * (spawnsPerSecond / framesPerSecond) * framesPerSecond);
+}
+BENCHMARK(BM_ParticleSpawnChurn)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+// One 10k-particle burst from the pooled ParticleSystem, recycled into the pool each iteration
+static void BM_ParticleBurst(benchmark::State& state) {
+    const int burstSize = 10000;
+
+    EntityManager entityManager;
+    ParticleSystem particleSystem;
+    particleSystem.EnablePooling(true);
+    particleSystem.SetLifetimeRange(0.01f, 0.01f);
+    particleSystem.SetRandomSeed(1);
+
+    // First burst creates the entities; later ones respawn pooled particles
+    particleSystem.SpawnParticleBurst(entityManager, burstSize, 960.0f, 540.0f);
+    particleSystem.Update(entityManager, 1.0f);
+
+    for (auto _ : state) {
+        particleSystem.SpawnParticleBurst(entityManager, burstSize, 960.0f, 540.0f);
+        state.PauseTiming();
+        particleSystem.Update(entityManager, 1.0f);
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * burstSize);
+}
+BENCHMARK(BM_ParticleBurst)->Unit(benchmark::kMicrosecond);
+
+// 10k uniform floats. Arg: 0 = std::mt19937 + distribution, 1 = Random scalar, 2 = Random::Fill
+static void BM_RandomFloats(benchmark::State& state) {
+    const size_t count = 10000;
+    std::vector<float> values(count);
+    std::mt19937 generator(1);
+    Lite2D::Random random(1);
+
+    for (auto _ : state) {
+        switch (state.range(0)) {
+        case 0: {
+            std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+            for (float& value : values) value = distribution(generator);
+            break;
+        }
+        case 1:
+            for (float& value : values) value = random.NextFloat();
+            break;
+        default:
+            random.Fill(values.data(), count);
+            break;
+        }
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_RandomFloats)->Arg(0)->Arg(1)->Arg(2);
+
+// SoA particle integration and compaction alone
+static void BM_ParticleBufferUpdate(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    Lite2D::ParticleBuffer buffer(count);
+    for (size_t i = 0; i < count; ++i) {
+        buffer.Add(static_cast<float>(i % 1920), static_cast<float>(i % 1080), 10.0f, -20.0f, 1.0e6f);
+    }
+
+    for (auto _ : state) {
+        buffer.Update(1.0f / 60.0f, 0.0f, 98.0f);
+        buffer.RemoveExpired();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ParticleBufferUpdate)->Arg(10000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+// One 60 Hz EmitterSystem frame at a steady ~1M live particles (500k/s, 2s lifetime)
+static void BM_EmitterSystemFrame(benchmark::State& state) {
+    EntityManager entityManager;
+    EmitterSystem emitterSystem;
+
+    Entity entity = entityManager.CreateEntity();
+    entityManager.AddComponent(entity, Position(960.0f, 540.0f));
+    Emitter emitter(500000.0f, 1100000);
+    emitter.lifetimeMin = 2.0f;
+    emitter.lifetimeMax = 2.0f;
+    emitter.accelerationY = 98.0f;
+    entityManager.AddComponent(entity, emitter);
+
+    const float deltaTime = 1.0f / 60.0f;
+    for (int frame = 0; frame < 130; ++frame) {
+        emitterSystem.Update(entityManager, deltaTime);
+    }
+
+    for (auto _ : state) {
+        emitterSystem.Update(entityManager, deltaTime);
+    }
+
+    state.counters["particles"] = static_cast<double>(emitterSystem.GetParticleCount());
+    state.SetItemsProcessed(state.iterations() * emitterSystem.GetParticleCount());
+}
+BENCHMARK(BM_EmitterSystemFrame)->Unit(benchmark::kMillisecond);
+
+// One frame of input handling: a few key and button events, 32 queries, Update().
+// Arg: 0 = direct key queries, 1 = through an ActionMap with two bindings per action
+static void BM_InputFrame(benchmark::State& state) {
+    const bool mapped = state.range(0) != 0;
+    const SDL_Scancode keys[] = { SDL_SCANCODE_W, SDL_SCANCODE_A, SDL_SCANCODE_S, SDL_SCANCODE_D,
+                                  SDL_SCANCODE_SPACE, SDL_SCANCODE_ESCAPE, SDL_SCANCODE_1, SDL_SCANCODE_R };
+
+    InputManager input;
+    ActionMap actions(input);
+    for (size_t i = 0; i < 8; ++i) {
+        actions.BindKey(i, keys[i]);
+        actions.BindKey(i, keys[(i + 1) % 8]);
+    }
+    actions.BindMouseButton(0, SDL_BUTTON_LEFT);
+
+    SDL_Event events[4];
+    std::memset(events, 0, sizeof(events));
+    events[0].type = SDL_EVENT_KEY_DOWN;
+    events[0].key.scancode = SDL_SCANCODE_W;
+    events[1].type = SDL_EVENT_KEY_UP;
+    events[1].key.scancode = SDL_SCANCODE_W;
+    events[2].type = SDL_EVENT_MOUSE_BUTTON_DOWN;
+    events[2].button.button = SDL_BUTTON_LEFT;
+    events[2].button.down = true;
+    events[3].type = SDL_EVENT_MOUSE_BUTTON_UP;
+    events[3].button.button = SDL_BUTTON_LEFT;
+
+    size_t frame = 0;
+    for (auto _ : state) {
+        input.FeedEvent(events[frame % 4]);
+        input.FeedEvent(events[(frame + 2) % 4]);
+        int hits = 0;
+        for (int query = 0; query < 4; ++query) {
+            for (size_t i = 0; i < 8; ++i) {
+                hits += mapped ? actions.IsHeld(i) : input.IsKeyHeld(keys[i]);
+            }
+        }
+        benchmark::DoNotOptimize(hits);
+        input.Update();
+        ++frame;
+    }
+    state.SetItemsProcessed(state.iterations() * 32);
+}
+BENCHMARK(BM_InputFrame)->Arg(0)->Arg(1);
@@ -0,0 +1,214 @@
+#!/usr/bin/env python3
+"""
+Lite2D benchmark regression gate
+
+Compares a lite2d_bench JSON run against the checked-in baseline and exits
+non-zero when a benchmark got slower. Pure standard library, runs offline.
+
+A benchmark counts as a regression when all hold:
+  - its median CPU time is more than --threshold slower than the baseline median
+  - its fastest repetition is also more than --threshold slower than the
+    baseline's fastest (a busy machine inflates medians, rarely the minimum)
+  - with enough repetitions on both sides, a one-sided Mann-Whitney U test
+    says the slowdown is significant at --alpha (noise alone cannot fail it)
+
+A baseline benchmark that is absent from the run, or that reported an error,
+also fails the gate: a benchmark that stopped running must not pass silently.
+Pass --allow-missing when the run deliberately covers only part of the
+baseline (e.g. a narrower --benchmark_filter).
+
+The baseline holds absolute times, so it is only meaningful on the machine
+that recorded it. When the run's host, CPU count or clock differ from the
+baseline's, a warning says to regenerate the baseline on this machine.
+
+Usage:
+  compare.py baseline.json current.json [--threshold 0.25] [--alpha 0.05] [--allow-missing]
+  compare.py --update baseline.json current.json   # replace the baseline
+"""
+
+import argparse
+import json
+import math
+import shutil
+import statistics
+import sys
+
+MIN_SAMPLES_FOR_TEST = 3
+
+
+def load_samples(path):
+    """Map benchmark name -> list of per-repetition CPU times in nanoseconds.
+
+    Also returns benchmark name -> error message for runs that reported an
+    error, since those carry no usable time."""
+    with open(path) as f:
+        data = json.load(f)
+
+    scale = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+    samples = {}
+    errors = {}
+    for bench in data.get("benchmarks", []):
+        # Skip mean/median/stddev aggregates, the raw repetitions are used instead
+        if bench.get("run_type", "iteration") != "iteration":
+            continue
+        name = bench.get("run_name", bench["name"])
+        if bench.get("error_occurred"):
+            errors[name] = bench.get("error_message", "error")
+            continue
+        cpu = bench["cpu_time"] * scale.get(bench.get("time_unit", "ns"), 1.0)
+        samples.setdefault(name, []).append(cpu)
+    return samples, errors
+
+
+def load_machine(path):
+    """The parts of the benchmark context that decide absolute timings."""
+    with open(path) as f:
+        context = json.load(f).get("context", {})
+    return {key: context.get(key) for key in ("host_name", "num_cpus", "mhz_per_cpu")}
+
+
+def mann_whitney_p(baseline, current):
+    """One-sided p-value that current is stochastically larger than baseline.
+
+    Normal approximation with tie correction, good enough for the 5-20
+    repetitions the gate uses."""
+    n1, n2 = len(baseline), len(current)
+    combined = sorted([(v, 0) for v in baseline] + [(v, 1) for v in current])
+
+    # Average ranks over ties
+    ranks = [0.0] * len(combined)
+    tie_term = 0.0
+    i = 0
+    while i < len(combined):
+        j = i
+        while j + 1 < len(combined) and combined[j + 1][0] == combined[i][0]:
+            j += 1
+        rank = (i + j) / 2.0 + 1.0
+        for k in range(i, j + 1):
+            ranks[k] = rank
+        ties = j - i + 1
+        tie_term += ties ** 3 - ties
+        i = j + 1
+
+    rank_sum_current = sum(r for r, (_, group) in zip(ranks, combined) if group == 1)
+    u = rank_sum_current - n2 * (n2 + 1) / 2.0
+
+    n = n1 + n2
+    mean = n1 * n2 / 2.0
+    variance = n1 * n2 / 12.0 * ((n + 1) - tie_term / (n * (n - 1)))
+    if variance <= 0:
+        return 1.0
+
+    z = (u - mean - 0.5) / math.sqrt(variance)  # continuity correction
+    return 0.5 * math.erfc(z / math.sqrt(2.0))
+
+
+def format_time(ns):
+    for unit, factor in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if ns >= factor:
+            return "%.2f %s" % (ns / factor, unit)
+    return "%.0f ns" % ns
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare lite2d_bench JSON against a baseline")
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=0.25,
+                        help="allowed relative slowdown of the median (default 0.25 = 25%%)")
+    parser.add_argument("--alpha", type=float, default=0.05,
+                        help="significance level for the Mann-Whitney U test (default 0.05)")
+    parser.add_argument("--update", action="store_true",
+                        help="copy current over baseline instead of comparing")
+    parser.add_argument("--allow-missing", action="store_true",
+                        help="do not fail on baseline benchmarks that are missing or errored in the run")
+    args = parser.parse_args()
+
+    if args.update:
+        shutil.copyfile(args.current, args.baseline)
+        print("Baseline updated: %s" % args.baseline)
+        return 0
+
+    baseline, _ = load_samples(args.baseline)
+    current, errors = load_samples(args.current)
+
+    baseline_machine = load_machine(args.baseline)
+    current_machine = load_machine(args.current)
+    if baseline_machine != current_machine:
+        print("WARNING: the baseline was recorded on another machine")
+        for key in sorted(baseline_machine):
+            if baseline_machine[key] != current_machine[key]:
+                print("  %s: baseline %s, current %s" % (key, baseline_machine[key], current_machine[key]))
+        print("Absolute times are not comparable; regenerate the baseline here with --update")
+        print("")
+
+    regressions = []
+    print("%-36s %12s %12s %8s %8s  %s" % ("Benchmark", "Baseline", "Current", "Change", "p", "Result"))
+    print("-" * 90)
+
+    for name in sorted(current):
+        if name in errors:
+            continue
+        if name not in baseline:
+            print("%-36s %12s %12s %8s %8s  %s" % (name, "-", format_time(statistics.median(current[name])),
+                                                   "-", "-", "NEW"))
+            continue
+
+        base_median = statistics.median(baseline[name])
+        curr_median = statistics.median(current[name])
+        change = (curr_median - base_median) / base_median if base_median > 0 else 0.0
+
+        enough = len(baseline[name]) >= MIN_SAMPLES_FOR_TEST and len(current[name]) >= MIN_SAMPLES_FOR_TEST
+        p = mann_whitney_p(baseline[name], current[name]) if enough else None
+
+        base_min = min(baseline[name])
+        min_change = (min(current[name]) - base_min) / base_min if base_min > 0 else 0.0
+
+        slower = change > args.threshold and min_change > args.threshold
+        significant = p is None or p < args.alpha
+        if slower and significant:
+            result = "REGRESSION"
+            regressions.append(name)
+        elif change > args.threshold:
+            result = "noise"
+        elif change < -args.threshold:
+            result = "faster"
+        else:
+            result = "ok"
+
+        print("%-36s %12s %12s %+7.1f%% %8s  %s" % (name, format_time(base_median), format_time(curr_median),
+                                                    change * 100.0, "-" if p is None else "%.3f" % p, result))
+
+    # A benchmark that errored on any repetition is not compared, its remaining samples are not trustworthy
+    missing = sorted((set(baseline) - set(current)) | set(errors))
+    for name in missing:
+        base = format_time(statistics.median(baseline[name])) if name in baseline else "-"
+        result = "ERROR: " + errors[name] if name in errors else "MISSING"
+        print("%-36s %12s %12s %8s %8s  %s" % (name, base, "-", "-", "-", result))
+
+    print("")
+    failed = False
+    if regressions:
+        print("%d benchmark(s) regressed beyond %.0f%%:" % (len(regressions), args.threshold * 100.0))
+        for name in regressions:
+            print("  " + name)
+        failed = True
+
+    if missing:
+        if args.allow_missing:
+            print("%d benchmark(s) missing from the run or errored, allowed by --allow-missing" % len(missing))
+        else:
+            print("%d benchmark(s) missing from the run or errored (pass --allow-missing to accept):" % len(missing))
+            for name in missing:
+                print("  " + name)
+            failed = True
+
+    if failed:
+        return 1
+
+    print("No benchmark regressions")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -26,15 +26,15 @@ echo "Configuring CMake..."
 cmake .. -DCMAKE_BUILD_TYPE=Debug
 
 echo "Building ECS tests..."
-make ecs_tests
+make -j$(nproc) ecs_unit_tests ecs_performance_tests ecs_integration_tests rendering_tests snake_tests
 
 echo ""
 echo "Running ECS tests..."
 echo "===================="
 
 # Run the tests
-if [ -f "bin/ecs_tests" ]; then
-    ./bin/ecs_tests --gtest_output=xml:test_results.xml
+if [ -f "bin/ecs_unit_tests" ]; then
+    ./bin/ecs_unit_tests --gtest_output=xml:test_results.xml
     echo ""
     echo "Test results saved to build/test_results.xml"
 else
@@ -46,5 +46,38 @@ echo ""
 echo "Running tests with CTest..."
 ctest --output-on-failure
 
+cd ..
+
+# Benchmark regression gate (set LITE2D_BENCH_GATE=0 to skip)
+# Benchmarks need an optimized build, so they get their own build directory
+if [ "${LITE2D_BENCH_GATE:-1}" != "0" ]; then
+    echo ""
+    echo "Running benchmark regression gate..."
+    echo "===================================="
+
+    cmake -S . -B build-bench -DCMAKE_BUILD_TYPE=Release > /dev/null
+
+    # Only a missing Google Benchmark skips the gate; a suite that fails to build fails it
+    if ! grep -q '^benchmark_DIR:PATH=' build-bench/CMakeCache.txt ||
+       grep -q '^benchmark_DIR:PATH=.*NOTFOUND' build-bench/CMakeCache.txt; then
+        echo "Google Benchmark not installed, skipping"
+    else
+        if ! cmake --build build-bench --target lite2d_bench -j$(nproc); then
+            echo "Error: lite2d_bench failed to build"
+            exit 1
+        fi
+
+        # ECS, physics, snapshot/rewind, particle and input paths; render timings depend too much on the renderer backend
+        ./build-bench/bin/lite2d_bench \
+            --benchmark_filter='BM_(CreateDestroyEntities|AddRemoveComponent|QueryDensity|MovementSystem|ParticleCollision|Snapshot|Rewind|ParticleBurst|InputFrame)' \
+            --benchmark_repetitions=5 \
+            --benchmark_enable_random_interleaving=true \
+            --benchmark_out=build-bench/lite2d_bench.json \
+            --benchmark_out_format=json > /dev/null
+
+        python3 benchmarks/compare.py benchmarks/baseline.json build-bench/lite2d_bench.json
+    fi
+fi
+
 echo ""
 echo "=== All tests completed ==="
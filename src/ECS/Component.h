@@ -3,6 +3,10 @@
 namespace Lite2D {
 namespace ECS {
 
+class StateHasher;
+class SnapshotWriter;
+class SnapshotReader;
+
 /**
  * Base Component interface
  * All components must inherit from this class
@@ -16,6 +20,15 @@ public:
     
     // Component type identification
     virtual const char* GetTypeName() const = 0;
+    
+    // Feed every field that affects the simulation to the lockstep state hash.
+    // Components that don't override this are hashed by which entities hold them only.
+    virtual void HashState(StateHasher& hasher) const {}
+    
+    // Binary snapshot of the component's fields, read back into a default-constructed
+    // instance. Components that don't override these are restored default-constructed.
+    virtual void WriteSnapshot(SnapshotWriter& writer) const {}
+    virtual void ReadSnapshot(SnapshotReader& reader) {}
 };
 
 } // namespace ECS
@@ -2,7 +2,11 @@
 
 #include "IComponentArray.h"
 #include "Component.h"
-#include <array>
+#include "StateHash.h"
+#include "Snapshot.h"
+#include <algorithm>
+#include <type_traits>
+#include <vector>
 #include <iostream>
 
 namespace Lite2D {
@@ -18,34 +22,45 @@ public:
     // Type traits
     static_assert(std::is_base_of_v<Component, T>, "Component must inherit from Component base class");
     
-    ComponentArray() {
-        // Initialize sparse array with unused slot marker
-        // Use MAX_ENTITIES as the unused slot marker since entities are 1 to MAX_ENTITIES-1
-        mEntityToIndex.fill(MAX_ENTITIES);
-        mIndexToEntity.fill(INVALID_ENTITY);
-    }
+    ComponentArray() = default;
     
     // Add component to entity
     void InsertData(Entity entity, Component* component) override {
-        if (mEntityToIndex[entity] != MAX_ENTITIES) {
+        // Sparse map grows to the highest entity ID seen, not MAX_ENTITIES
+        if (entity >= mEntityToIndex.size()) {
+            if (entity >= MAX_ENTITIES) {
+                return;
+            }
+            mEntityToIndex.resize(entity + 1, MAX_ENTITIES);
+        }
+        
+        MarkChanged(entity);
+        
+        Entity& index = mEntityToIndex[entity];
+        if (index != MAX_ENTITIES) {
             // Entity already has this component, update it
-            mComponentArray[mEntityToIndex[entity]] = *static_cast<T*>(component);
+            mComponentArray[index] = *static_cast<T*>(component);
             return;
         }
         
-        // Put new entry at end
-        size_t newIndex = mSize;
-        mEntityToIndex[entity] = newIndex;
-        mIndexToEntity[newIndex] = entity;
-        mComponentArray[newIndex] = *static_cast<T*>(component);
+        // Put new entry at end, reusing a slot left by an earlier removal if there is one
+        index = static_cast<Entity>(mSize);
+        if (mSize < mComponentArray.size()) {
+            mComponentArray[mSize] = *static_cast<T*>(component);
+            mIndexToEntity[mSize] = entity;
+        } else {
+            mComponentArray.push_back(*static_cast<T*>(component));
+            mIndexToEntity.push_back(entity);
+        }
         mSize++;
     }
     
     // Remove component from entity
     void RemoveData(Entity entity) override {
-        if (mEntityToIndex[entity] == MAX_ENTITIES) {
+        if (!HasData(entity)) {
             return; // Entity doesn't have this component
         }
+        MarkChanged(entity);
         
         // Copy element at end into deleted element's place to maintain density
         size_t indexOfRemovedEntity = mEntityToIndex[entity];
@@ -54,7 +69,7 @@ public:
         
         // Update map to point to moved spot
         Entity entityOfLastElement = mIndexToEntity[indexOfLastElement];
-        mEntityToIndex[entityOfLastElement] = indexOfRemovedEntity;
+        mEntityToIndex[entityOfLastElement] = static_cast<Entity>(indexOfRemovedEntity);
         mIndexToEntity[indexOfRemovedEntity] = entityOfLastElement;
         
         mEntityToIndex[entity] = MAX_ENTITIES;
@@ -64,22 +79,17 @@ public:
     
     // Get component from entity
     Component* GetData(Entity entity) override {
-        if (mEntityToIndex[entity] == MAX_ENTITIES) {
-            return nullptr;
-        }
-        return &mComponentArray[mEntityToIndex[entity]];
+        return GetComponent(entity);
     }
     
     // Check if entity has this component
     bool HasData(Entity entity) const override {
-        return mEntityToIndex[entity] != MAX_ENTITIES;
+        return entity < mEntityToIndex.size() && mEntityToIndex[entity] != MAX_ENTITIES;
     }
     
     // Called when entity is destroyed
     void EntityDestroyed(Entity entity) override {
-        if (mEntityToIndex[entity] != MAX_ENTITIES) {
-            RemoveData(entity);
-        }
+        RemoveData(entity);
     }
     
     // Get component type name
@@ -87,35 +97,186 @@ public:
         return T::GetTypeNameStatic();
     }
     
-    // Get typed component (for performance)
+    // Get typed component (for performance). Adding a component of this type may
+    // reallocate the packed array, so do not hold the pointer across insertions.
+    // With change tracking on, the mutable overload counts as a write.
     T* GetComponent(Entity entity) {
-        if (mEntityToIndex[entity] == MAX_ENTITIES) {
+        if (!HasData(entity)) {
+            return nullptr;
+        }
+        
+        MarkChanged(entity);
+        return &mComponentArray[mEntityToIndex[entity]];
+    }
+    
+    const T* GetComponent(Entity entity) const {
+        if (!HasData(entity)) {
             return nullptr;
         }
         
         return &mComponentArray[mEntityToIndex[entity]];
     }
     
-    // Get all components for iteration
+    // Get all components for iteration (counts as a write to every one of them)
     T* GetComponents() {
+        MarkAllChanged();
         return mComponentArray.data();
     }
     
+    // Change tracking, off by default. While on, every insert, removal and mutable
+    // access stamps the entity with a new pool version, so a consumer that keeps the
+    // version it last saw can tell which entities may have been written without
+    // comparing their fields. Turning it on counts as a change to every entity.
+    void SetChangeTracking(bool enable) {
+        if (enable == mTrackChanges) return;
+        mTrackChanges = enable;
+        mChangeVersions.clear();
+        mChangeVersions.shrink_to_fit();
+        if (enable) {
+            mChangeVersions.resize(mEntityToIndex.size(), 0);
+            mBulkChangeVersion = ++mChangeVersion;
+        }
+    }
+    bool IsChangeTracking() const { return mTrackChanges; }
+    
+    // Latest version handed out; unchanged means nothing was written since
+    uint64_t GetChangeVersion() const { return mChangeVersion; }
+    
+    // Version of the entity's last write (only meaningful while tracking)
+    uint64_t GetChangeVersion(Entity entity) const {
+        uint64_t version = entity < mChangeVersions.size() ? mChangeVersions[entity] : 0;
+        return std::max(version, mBulkChangeVersion);
+    }
+    
     // Get current size
-    size_t GetSize() const { return mSize; }
+    size_t GetSize() const override { return mSize; }
+    
+    // Dense order matters: it is the order systems iterate in
+    void HashState(StateHasher& hasher) const override {
+        hasher.Add(mSize);
+        for (size_t i = 0; i < mSize; ++i) {
+            hasher.Add(mIndexToEntity[i]);
+            mComponentArray[i].T::HashState(hasher); // Static call, T is the exact type
+        }
+    }
+    
+    void Clear() override {
+        MarkAllChanged();
+        std::fill(mEntityToIndex.begin(), mEntityToIndex.end(), MAX_ENTITIES);
+        std::fill(mIndexToEntity.begin(), mIndexToEntity.begin() + mSize, INVALID_ENTITY);
+        mSize = 0;
+    }
+    
+    // Layout: uint64 size, index-to-entity block, entity-to-index block, then the
+    // components' fields in dense order. Components hold a vtable pointer, so the
+    // packed array itself can't go out as one block; the static calls below inline
+    // into a copy loop instead.
+    void WriteSnapshot(SnapshotWriter& writer) const override {
+        writer.Write(static_cast<uint64_t>(mSize));
+        writer.WriteBytes(mIndexToEntity.data(), mSize * sizeof(Entity));
+        writer.WriteVector(mEntityToIndex);
+        for (size_t i = 0; i < mSize; ++i) {
+            mComponentArray[i].T::WriteSnapshot(writer);
+        }
+    }
+    
+    bool ReadSnapshot(SnapshotReader& reader) override {
+        if constexpr (!std::is_default_constructible_v<T>) {
+            std::cerr << "Snapshot: " << T::GetTypeNameStatic() << " has no default constructor" << std::endl;
+            reader.Fail();
+            return false;
+        } else {
+            Clear();
+            
+            uint64_t count = 0;
+            if (!reader.Read(count) || count > MAX_ENTITIES) {
+                reader.Fail();
+                return false;
+            }
+            
+            mIndexToEntity.resize(static_cast<size_t>(count));
+            reader.ReadBytes(mIndexToEntity.data(), mIndexToEntity.size() * sizeof(Entity));
+            reader.ReadVector(mEntityToIndex, MAX_ENTITIES);
+            if (!reader.IsOk()) {
+                mEntityToIndex.clear();
+                mIndexToEntity.clear();
+                return false;
+            }
+            
+            // Both maps must agree, or later lookups would index out of range: every slot
+            // points at an entity that points back, and no other entity points anywhere
+            bool consistent = true;
+            for (size_t i = 0; i < mIndexToEntity.size() && consistent; ++i) {
+                Entity entity = mIndexToEntity[i];
+                consistent = entity < mEntityToIndex.size() && mEntityToIndex[entity] == i;
+            }
+            size_t mapped = 0;
+            for (size_t i = 0; i < mEntityToIndex.size() && consistent; ++i) {
+                if (mEntityToIndex[i] != MAX_ENTITIES) {
+                    consistent = mEntityToIndex[i] < count;
+                    ++mapped;
+                }
+            }
+            if (!consistent || mapped != count) {
+                mEntityToIndex.clear();
+                mIndexToEntity.clear();
+                reader.Fail();
+                return false;
+            }
+            
+            // Slots kept from before are overwritten in place, which makes reloading a
+            // same-sized world (a restart) cheaper than constructing every component again.
+            // Components without ReadSnapshot were saved without data and restart from T().
+            constexpr bool readsFields = !std::is_same_v<decltype(&T::ReadSnapshot),
+                                                         void (Component::*)(SnapshotReader&)>;
+            const size_t size = mIndexToEntity.size();
+            const size_t reused = std::min(size, mComponentArray.size());
+            mComponentArray.resize(size);
+            for (size_t i = 0; i < size; ++i) {
+                if constexpr (readsFields) {
+                    mComponentArray[i].T::ReadSnapshot(reader);
+                } else if (i < reused) {
+                    mComponentArray[i] = T();
+                }
+            }
+            mSize = size;
+            return reader.IsOk();
+        }
+    }
 
 private:
-    // Packed array of components (of type T)
-    std::array<T, MAX_ENTITIES> mComponentArray;
+    // Packed array of components (of type T). Grows to the most components ever held
+    // at once; slots past mSize are kept for reuse rather than destroyed.
+    std::vector<T> mComponentArray;
     
-    // Map from entity ID to array index
-    std::array<Entity, MAX_ENTITIES> mEntityToIndex;
+    // Map from entity ID to array index (MAX_ENTITIES = no component)
+    std::vector<Entity> mEntityToIndex;
     
     // Map from array index to entity ID
-    std::array<Entity, MAX_ENTITIES> mIndexToEntity;
+    std::vector<Entity> mIndexToEntity;
     
     // Total size of valid entries in the array
     size_t mSize = 0;
+    
+    // Per-entity-ID write versions, kept only while tracking
+    bool mTrackChanges = false;
+    uint64_t mChangeVersion = 0;
+    uint64_t mBulkChangeVersion = 0; // Clear, load or raw array access: everything changed
+    std::vector<uint64_t> mChangeVersions;
+    
+    void MarkChanged(Entity entity) {
+        if (!mTrackChanges) return;
+        if (entity >= mChangeVersions.size()) {
+            mChangeVersions.resize(entity + 1, 0);
+        }
+        mChangeVersions[entity] = ++mChangeVersion;
+    }
+    
+    void MarkAllChanged() {
+        if (mTrackChanges) {
+            mBulkChangeVersion = ++mChangeVersion;
+        }
+    }
 };
 
 } // namespace ECS
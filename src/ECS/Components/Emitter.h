@@ -0,0 +1,126 @@
+#pragma once
+
+#include "../Component.h"
+#include "../StateHash.h"
+#include "../Snapshot.h"
+#include <SDL3/SDL.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace Lite2D {
+namespace ECS {
+
+/**
+ * Emitter component - spawns lightweight particles at the entity's Position
+ * The particles themselves are not entities; EmitterSystem keeps them in a
+ * ParticleBuffer per emitter, so counts are not limited by MAX_ENTITIES.
+ */
+class Emitter : public Component {
+public:
+    // Largest buffer a snapshot may ask for (6 floats each, ~96 MB)
+    static constexpr size_t MAX_PARTICLES = 4 * 1024 * 1024;
+    
+    float rate;                 // Particles per second while emitting
+    float lifetimeMin, lifetimeMax;
+    float speedMin, speedMax;
+    float direction;            // Radians, 0 = +x
+    float spread;               // Full cone angle in radians (2*pi = all directions)
+    float accelerationX, accelerationY; // e.g. gravity
+    float offsetX, offsetY;     // Spawn point relative to Position
+    float size;                 // Particle quad size in pixels
+    SDL_Color startColor, endColor;
+    size_t maxParticles;        // Buffer capacity
+    int layer;                  // Render layer, same ordering as Renderable::layer
+    uint32_t seed;              // Spawn randomness is deterministic per emitter
+    bool emitting;
+    int burst;                  // One-shot particles to spawn next update, reset to 0 by the system
+    
+    Emitter(float rate = 100.0f, size_t maxParticles = 10000, int layer = 0)
+        : rate(rate), lifetimeMin(1.0f), lifetimeMax(2.0f), speedMin(50.0f), speedMax(100.0f),
+          direction(0.0f), spread(6.2831853f), accelerationX(0.0f), accelerationY(0.0f),
+          offsetX(0.0f), offsetY(0.0f), size(2.0f), startColor{255, 255, 255, 255},
+          endColor{255, 255, 255, 0}, maxParticles(maxParticles), layer(layer), seed(1),
+          emitting(true), burst(0) {}
+    
+    // Component interface
+    Component* Clone() const override {
+        return new Emitter(*this);
+    }
+    
+    const char* GetTypeName() const override {
+        return "Emitter";
+    }
+    
+    static const char* GetTypeNameStatic() {
+        return "Emitter";
+    }
+    
+    void HashState(StateHasher& hasher) const override {
+        hasher.Add(rate);
+        hasher.Add(lifetimeMin);
+        hasher.Add(lifetimeMax);
+        hasher.Add(speedMin);
+        hasher.Add(speedMax);
+        hasher.Add(direction);
+        hasher.Add(spread);
+        hasher.Add(accelerationX);
+        hasher.Add(accelerationY);
+        hasher.Add(offsetX);
+        hasher.Add(offsetY);
+        hasher.Add(maxParticles);
+        hasher.Add(seed);
+        hasher.Add(emitting);
+        hasher.Add(burst);
+    }
+    
+    void WriteSnapshot(SnapshotWriter& writer) const override {
+        writer.Write(rate);
+        writer.Write(lifetimeMin);
+        writer.Write(lifetimeMax);
+        writer.Write(speedMin);
+        writer.Write(speedMax);
+        writer.Write(direction);
+        writer.Write(spread);
+        writer.Write(accelerationX);
+        writer.Write(accelerationY);
+        writer.Write(offsetX);
+        writer.Write(offsetY);
+        writer.Write(size);
+        writer.Write(startColor);
+        writer.Write(endColor);
+        writer.Write(static_cast<uint64_t>(maxParticles));
+        writer.Write(layer);
+        writer.Write(seed);
+        writer.Write(emitting);
+        writer.Write(burst);
+    }
+    
+    void ReadSnapshot(SnapshotReader& reader) override {
+        reader.Read(rate);
+        reader.Read(lifetimeMin);
+        reader.Read(lifetimeMax);
+        reader.Read(speedMin);
+        reader.Read(speedMax);
+        reader.Read(direction);
+        reader.Read(spread);
+        reader.Read(accelerationX);
+        reader.Read(accelerationY);
+        reader.Read(offsetX);
+        reader.Read(offsetY);
+        reader.Read(size);
+        reader.Read(startColor);
+        reader.Read(endColor);
+        uint64_t capacity = 0;
+        if (reader.Read(capacity) && capacity > MAX_PARTICLES) {
+            reader.Fail();
+        }
+        maxParticles = static_cast<size_t>(capacity);
+        reader.Read(layer);
+        reader.Read(seed);
+        reader.Read(emitting);
+        reader.Read(burst);
+    }
+};
+
+} // namespace ECS
+} // namespace Lite2D
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "../Component.h"
+#include "../StateHash.h"
+#include "../Snapshot.h"
 
 namespace Lite2D {
 namespace ECS {
@@ -26,6 +28,21 @@ public:
     static const char* GetTypeNameStatic() {
         return "Position";
     }
+    
+    void HashState(StateHasher& hasher) const override {
+        hasher.Add(x);
+        hasher.Add(y);
+    }
+    
+    void WriteSnapshot(SnapshotWriter& writer) const override {
+        writer.Write(x);
+        writer.Write(y);
+    }
+    
+    void ReadSnapshot(SnapshotReader& reader) override {
+        reader.Read(x);
+        reader.Read(y);
+    }
 };
 
 } // namespace ECS
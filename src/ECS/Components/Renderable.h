@@ -1,6 +1,8 @@
 #pragma once
 
 #include "../Component.h"
+#include "../StateHash.h"
+#include "../Snapshot.h"
 
 namespace Lite2D {
 namespace ECS {
@@ -27,6 +29,21 @@ public:
     static const char* GetTypeNameStatic() {
         return "Renderable";
     }
+    
+    void HashState(StateHasher& hasher) const override {
+        hasher.Add(visible);
+        hasher.Add(layer);
+    }
+    
+    void WriteSnapshot(SnapshotWriter& writer) const override {
+        writer.Write(visible);
+        writer.Write(layer);
+    }
+    
+    void ReadSnapshot(SnapshotReader& reader) override {
+        reader.Read(visible);
+        reader.Read(layer);
+    }
 };
 
 } // namespace ECS
@@ -1,27 +1,38 @@
 #include "EntityManager.h"
+#include "Utils/MappedFile.h"
 #include <algorithm>
+#include <iostream>
 #include <vector>
 
 namespace Lite2D {
 namespace ECS {
 
-EntityManager::EntityManager() 
-    : mLivingEntityCount(0), mNextComponentType(0) {
-    // Initialize the queue with all possible entity IDs
-    for (Entity entity = 1; entity < MAX_ENTITIES; ++entity) {
-        mAvailableEntities.push_back(entity);
-    }
+EntityManager::EntityManager(size_t frameArenaCapacity) 
+    : mNextEntity(1), mLivingEntityCount(0), mNextComponentType(0), mFrameArena(frameArenaCapacity) {
 }
 
 Entity EntityManager::CreateEntity() {
-    if (mAvailableEntities.empty()) {
+    Entity id;
+    
+    // Recycle destroyed IDs first so the ID range (and every per-ID table) stays compact
+    if (!mAvailableEntities.empty()) {
+        id = mAvailableEntities.front();
+        mAvailableEntities.pop_front();
+    } else if (mNextEntity < MAX_ENTITIES) {
+        id = mNextEntity++;
+    } else {
         // No more entities available
         return INVALID_ENTITY;
     }
     
-    // Take an ID from the front of the queue
-    Entity id = mAvailableEntities.front();
-    mAvailableEntities.erase(mAvailableEntities.begin());
+    if (id >= mEntityAlive.size()) {
+        mEntityAlive.resize(id + 1, 0);
+        mEntitySignatures.resize(id + 1);
+    }
+    if (id >= mEntityGenerations.size()) {
+        mEntityGenerations.resize(id + 1, 0); // Outlives Clear(), so it can be the longer table
+    }
+    mEntityAlive[id] = 1;
     
     // Add to active entities list for performance optimization
     mActiveEntities.push_back(id);
@@ -44,6 +55,8 @@ void EntityManager::DestroyEntity(Entity entity) {
     
     // Invalidate the destroyed entity's signature
     mEntitySignatures[entity].reset();
+    mEntityAlive[entity] = 0;
+    mEntityGenerations[entity]++;
     
     // Notify each component array that an entity has been destroyed
     // If it has a component for that entity, it will remove it
@@ -60,21 +73,240 @@ void EntityManager::DestroyEntity(Entity entity) {
 }
 
 bool EntityManager::IsValid(Entity entity) const {
-    // Check if entity ID is within valid range
-    if (entity == INVALID_ENTITY || entity >= MAX_ENTITIES) {
+    // Check if entity ID is within the issued range and currently alive
+    return entity != INVALID_ENTITY && entity < mEntityAlive.size() && mEntityAlive[entity] != 0;
+}
+
+void EntityManager::HashState(StateHasher& hasher) const {
+    // ID allocation and active order decide future IDs and query order, so they are state too
+    hasher.Add(mNextEntity);
+    hasher.Add(mLivingEntityCount);
+    hasher.AddBytes(mActiveEntities.data(), mActiveEntities.size() * sizeof(Entity));
+    hasher.Add(mAvailableEntities.size());
+    for (Entity entity : mAvailableEntities) {
+        hasher.Add(entity);
+    }
+    
+    hasher.Add(mNextComponentType);
+    for (ComponentType type = 0; type < mNextComponentType; ++type) {
+        const IComponentArray* pool = mComponentArrays[type].get();
+        if (!pool) continue;
+        hasher.AddString(pool->GetComponentTypeName());
+        pool->HashState(hasher);
+    }
+}
+
+// Layout (native endianness):
+//   uint32 magic, uint32 version, uint32 nextEntity, uint64 livingCount
+//   alive flags, active entities (uint64 count + block each)
+//   uint64 count + that many uint64 signature words
+//   uint64 count + free-list IDs, oldest first
+//   uint32 poolCount, then per pool: name, uint8 type index, pool data
+void EntityManager::SaveSnapshot(SnapshotWriter& writer) const {
+    writer.Write(SNAPSHOT_MAGIC);
+    writer.Write(SNAPSHOT_VERSION);
+    writer.Write(mNextEntity);
+    writer.Write(static_cast<uint64_t>(mLivingEntityCount));
+    writer.WriteVector(mEntityAlive);
+    writer.WriteVector(mActiveEntities);
+    
+    static_assert(MAX_COMPONENT_TYPES <= 64, "Signatures are stored as one 64-bit word");
+    writer.Write(static_cast<uint64_t>(mEntitySignatures.size()));
+    for (const auto& signature : mEntitySignatures) {
+        writer.Write(static_cast<uint64_t>(signature.to_ullong()));
+    }
+    
+    writer.Write(static_cast<uint64_t>(mAvailableEntities.size()));
+    for (Entity entity : mAvailableEntities) {
+        writer.Write(entity);
+    }
+    
+    uint32_t poolCount = 0;
+    for (ComponentType type = 0; type < mNextComponentType; ++type) {
+        if (mComponentArrays[type]) poolCount++;
+    }
+    writer.Write(poolCount);
+    for (ComponentType type = 0; type < mNextComponentType; ++type) {
+        const IComponentArray* pool = mComponentArrays[type].get();
+        if (!pool) continue;
+        writer.WriteString(pool->GetComponentTypeName());
+        writer.Write(type);
+        pool->WriteSnapshot(writer);
+    }
+}
+
+bool EntityManager::LoadSnapshot(SnapshotReader& reader) {
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    if (!reader.Read(magic) || magic != SNAPSHOT_MAGIC || !reader.Read(version) || version != SNAPSHOT_VERSION) {
+        std::cerr << "Snapshot: not a version " << SNAPSHOT_VERSION << " entity snapshot" << std::endl;
+        return false;
+    }
+    
+    // Every current ID is freed, whatever the snapshot reuses
+    for (uint32_t& generation : mEntityGenerations) {
+        generation++;
+    }
+    
+    // Registered pools stay (their types can't be recreated from a name), their contents go
+    for (auto& componentArray : mComponentArrays) {
+        if (componentArray) {
+            componentArray->Clear();
+        }
+    }
+    
+    // Drops the partial state on any failure below
+    auto fail = [this](const char* reason) {
+        std::cerr << "Snapshot: " << reason << std::endl;
+        mEntitySignatures.clear();
+        mEntityAlive.clear();
+        mActiveEntities.clear();
+        mAvailableEntities.clear();
+        mNextEntity = 1;
+        mLivingEntityCount = 0;
+        for (auto& componentArray : mComponentArrays) {
+            if (componentArray) {
+                componentArray->Clear();
+            }
+        }
         return false;
+    };
+    
+    uint64_t livingCount = 0;
+    reader.Read(mNextEntity);
+    reader.Read(livingCount);
+    reader.ReadVector(mEntityAlive, MAX_ENTITIES);
+    reader.ReadVector(mActiveEntities, MAX_ENTITIES);
+    if (!reader.IsOk() || mNextEntity == 0 || mNextEntity > MAX_ENTITIES || livingCount != mActiveEntities.size()) {
+        return fail("corrupt entity tables");
+    }
+    mLivingEntityCount = static_cast<size_t>(livingCount);
+    
+    uint64_t signatureCount = 0;
+    if (!reader.Read(signatureCount) || signatureCount != mEntityAlive.size()) {
+        return fail("corrupt signatures");
     }
+    std::vector<uint64_t> signatureWords(static_cast<size_t>(signatureCount));
+    reader.ReadBytes(signatureWords.data(), signatureWords.size() * sizeof(uint64_t));
     
-    // Check if entity is in the available entities list
-    // If it's available, it means it's not currently in use
-    auto it = std::find(mAvailableEntities.begin(), mAvailableEntities.end(), entity);
-    return it == mAvailableEntities.end();
+    uint64_t availableCount = 0;
+    if (!reader.Read(availableCount) || availableCount > MAX_ENTITIES) {
+        return fail("corrupt free list");
+    }
+    mAvailableEntities.clear();
+    for (uint64_t i = 0; i < availableCount; ++i) {
+        Entity entity = INVALID_ENTITY;
+        reader.Read(entity);
+        mAvailableEntities.push_back(entity);
+    }
+    
+    // Saved type index -> registered type index; identical when both sides registered in the same order
+    std::array<ComponentType, MAX_COMPONENT_TYPES> typeRemap;
+    bool identityRemap = true;
+    uint32_t poolCount = 0;
+    if (!reader.Read(poolCount) || poolCount > MAX_COMPONENT_TYPES) {
+        return fail("corrupt pool table");
+    }
+    std::string typeName;
+    uint64_t savedTypeMask = 0;
+    uint64_t loadedTypeMask = 0;
+    for (uint32_t i = 0; i < poolCount; ++i) {
+        ComponentType savedType = 0;
+        if (!reader.ReadString(typeName) || !reader.Read(savedType) || savedType >= MAX_COMPONENT_TYPES ||
+            (savedTypeMask >> savedType) & 1) {
+            return fail("corrupt pool header");
+        }
+        
+        IComponentArray* pool = nullptr;
+        ComponentType localType = 0;
+        for (ComponentType type = 0; type < mNextComponentType; ++type) {
+            if (mComponentArrays[type] && typeName == mComponentArrays[type]->GetComponentTypeName()) {
+                pool = mComponentArrays[type].get();
+                localType = type;
+                break;
+            }
+        }
+        if (!pool) {
+            std::cerr << "Snapshot: component type " << typeName << " is not registered" << std::endl;
+            return fail("unknown component type");
+        }
+        if ((loadedTypeMask >> localType) & 1) {
+            return fail("component type saved twice");
+        }
+        if (!pool->ReadSnapshot(reader)) {
+            return fail("corrupt component pool");
+        }
+        
+        typeRemap[savedType] = localType;
+        identityRemap = identityRemap && savedType == localType;
+        savedTypeMask |= uint64_t(1) << savedType;
+        loadedTypeMask |= uint64_t(1) << localType;
+    }
+    if (!reader.IsOk()) {
+        return fail("truncated snapshot");
+    }
+    
+    mEntitySignatures.resize(signatureWords.size());
+    for (size_t entity = 0; entity < signatureWords.size(); ++entity) {
+        uint64_t word = signatureWords[entity];
+        if ((word & ~savedTypeMask) != 0) {
+            return fail("signature references a missing pool");
+        }
+        if (identityRemap) {
+            mEntitySignatures[entity] = std::bitset<MAX_COMPONENT_TYPES>(word);
+            continue;
+        }
+        std::bitset<MAX_COMPONENT_TYPES> signature;
+        for (ComponentType savedType = 0; savedType < MAX_COMPONENT_TYPES; ++savedType) {
+            if ((word >> savedType) & 1) {
+                signature.set(typeRemap[savedType]);
+            }
+        }
+        mEntitySignatures[entity] = signature;
+    }
+    
+    // Every per-ID table must cover every live ID
+    for (Entity entity : mActiveEntities) {
+        if (entity == INVALID_ENTITY || entity >= mEntityAlive.size() || entity >= mEntitySignatures.size() ||
+            !mEntityAlive[entity]) {
+            return fail("active entity out of range");
+        }
+    }
+    if (mEntityGenerations.size() < mEntityAlive.size()) {
+        mEntityGenerations.resize(mEntityAlive.size(), 0);
+    }
+    for (Entity entity : mAvailableEntities) {
+        if (entity == INVALID_ENTITY || entity >= mNextEntity) {
+            return fail("free entity out of range");
+        }
+    }
+    
+    mFrameArena.Reset();
+    return true;
+}
+
+bool EntityManager::SaveSnapshot(const std::string& path) const {
+    SnapshotWriter writer;
+    SaveSnapshot(writer);
+    return writer.SaveToFile(path);
+}
+
+bool EntityManager::LoadSnapshot(const std::string& path) {
+    // Parse straight out of the page cache instead of reading the file into a buffer first
+    MappedFile file;
+    if (!file.Open(path)) {
+        return false;
+    }
+    SnapshotReader reader(file.GetData(), file.GetSize());
+    return LoadSnapshot(reader);
 }
 
 void EntityManager::Clear() {
-    // Clear all signatures
-    for (auto& signature : mEntitySignatures) {
-        signature.reset();
+    // Release all per-entity tables. Generations stay, since the IDs will be handed out again.
+    mEntitySignatures.clear();
+    mEntityAlive.clear();
+    for (uint32_t& generation : mEntityGenerations) {
+        generation++;
     }
     
     // Clear all component arrays
@@ -87,24 +319,29 @@ void EntityManager::Clear() {
     // Clear active entities list
     mActiveEntities.clear();
     
-    // Reset available entities queue
+    // Reset entity IDs
     mAvailableEntities.clear();
-    for (Entity entity = 1; entity < MAX_ENTITIES; ++entity) {
-        mAvailableEntities.push_back(entity);
-    }
+    mNextEntity = 1;
     
     mLivingEntityCount = 0;
     mNextComponentType = 0;
+    mFrameArena.Reset();
     mComponentTypes.clear();
     mComponentNames.clear();
 }
 
 void EntityManager::SetSignature(Entity entity, std::bitset<MAX_COMPONENT_TYPES> signature) {
+    if (entity >= MAX_ENTITIES) {
+        return;
+    }
+    if (entity >= mEntitySignatures.size()) {
+        mEntitySignatures.resize(entity + 1);
+    }
     mEntitySignatures[entity] = signature;
 }
 
 std::bitset<MAX_COMPONENT_TYPES> EntityManager::GetSignature(Entity entity) const {
-    return mEntitySignatures[entity];
+    return entity < mEntitySignatures.size() ? mEntitySignatures[entity] : std::bitset<MAX_COMPONENT_TYPES>();
 }
 
 } // namespace ECS
@@ -4,10 +4,14 @@
 #include "Component.h"
 #include "IComponentArray.h"
 #include "ComponentArray.h"
+#include "Snapshot.h"
+#include "Utils/FrameArena.h"
 #include <array>
+#include <deque>
 #include <unordered_map>
 #include <typeindex>
 #include <memory>
+#include <string>
 #include <bitset>
 #include <vector>
 #include <algorithm>
@@ -26,7 +30,9 @@ class ComponentArray;
  */
 class EntityManager {
 public:
-    EntityManager();
+    // Storage starts empty and grows with the entities actually created, so an
+    // idle manager costs a few KB (frameArenaCapacity is reserved on first use)
+    explicit EntityManager(size_t frameArenaCapacity = FrameArena::DEFAULT_CAPACITY);
     ~EntityManager() = default;
     
     // Delete copy constructor and assignment operator
@@ -38,6 +44,12 @@ public:
     void DestroyEntity(Entity entity);
     bool IsValid(Entity entity) const;
     
+    // Bumped whenever the ID is freed (destroy, Clear, snapshot load), so ID plus
+    // generation tells a recycled ID apart from the entity that held it before
+    uint32_t GetGeneration(Entity entity) const {
+        return entity < mEntityGenerations.size() ? mEntityGenerations[entity] : 0;
+    }
+    
     // Component management
     template<typename T>
     void AddComponent(Entity entity, T component);
@@ -48,6 +60,11 @@ public:
     template<typename T>
     T* GetComponent(Entity entity);
     
+    // Read-only access; unlike the mutable overload it never counts as a write for
+    // pools with change tracking on (ComponentArray::SetChangeTracking)
+    template<typename T>
+    const T* GetComponent(Entity entity) const;
+    
     template<typename T>
     bool HasComponent(Entity entity) const;
     
@@ -55,6 +72,19 @@ public:
     template<typename... Components>
     std::vector<Entity> GetEntitiesWith();
     
+    // Fills a caller-owned vector instead, reusing its capacity (no allocation once warmed up)
+    template<typename... Components, typename Allocator>
+    void GetEntitiesWith(std::vector<Entity, Allocator>& outEntities);
+    
+    // Query into frame arena memory, valid until the next EndFrame()
+    template<typename... Components>
+    ArenaVector<Entity> GetFrameEntitiesWith();
+    
+    // Per-frame transient memory for systems. SystemManager::UpdateSystems calls
+    // EndFrame() when it finishes, releasing the whole frame's allocations at once.
+    FrameArena& GetFrameArena() { return mFrameArena; }
+    void EndFrame() { mFrameArena.Reset(); }
+    
     // Component signature helper
     template<typename... Components>
     std::bitset<MAX_COMPONENT_TYPES> GetComponentSignature();
@@ -63,13 +93,31 @@ public:
     size_t GetEntityCount() const { return mLivingEntityCount; }
     void Clear();
     
-    // Component type registration
+    // Lockstep state hash: entity ID allocation, active order and every component pool in type order
+    void HashState(StateHasher& hasher) const;
+    
+    // Binary snapshot of every entity table and component pool. Loading replaces the
+    // current contents; pools are matched by component type name, so every type in
+    // the snapshot must be registered first (RegisterComponentType, or any earlier use).
+    // On malformed data LoadSnapshot returns false and leaves the manager empty.
+    void SaveSnapshot(SnapshotWriter& writer) const;
+    bool LoadSnapshot(SnapshotReader& reader);
+    bool SaveSnapshot(const std::string& path) const;
+    bool LoadSnapshot(const std::string& path);
+    
+    // Component type registration (no-op if T is already registered)
     template<typename T>
     void RegisterComponentType();
     
     // Get component array for iteration (advanced usage)
     template<typename T>
     ComponentArray<T>* GetComponentArray();
+    
+    // Type-erased pool access by registration index, for diagnostics
+    size_t GetComponentTypeCount() const { return mNextComponentType; }
+    const IComponentArray* GetComponentPool(ComponentType type) const {
+        return type < MAX_COMPONENT_TYPES ? mComponentArrays[type].get() : nullptr;
+    }
 
 private:
     // Array of component type arrays
@@ -82,12 +130,21 @@ private:
     // Map from array index to component type name
     std::unordered_map<ComponentType, const char*> mComponentNames;
     
-    // Array of signatures where the index corresponds to the entity ID
+    // Signatures indexed by entity ID, grown to the highest ID handed out
     // Each signature tells us which components the entity has
-    std::array<std::bitset<MAX_COMPONENT_TYPES>, MAX_ENTITIES> mEntitySignatures;
+    std::vector<std::bitset<MAX_COMPONENT_TYPES>> mEntitySignatures;
+    
+    // Liveness by entity ID, for O(1) IsValid
+    std::vector<uint8_t> mEntityAlive;
+    
+    // Reuse count by entity ID; not part of snapshots or the state hash
+    std::vector<uint32_t> mEntityGenerations;
+    
+    // Destroyed IDs, reused oldest first before any new ID is issued
+    std::deque<Entity> mAvailableEntities;
     
-    // Queue of unused entity IDs
-    std::vector<Entity> mAvailableEntities;
+    // Next never-used entity ID
+    Entity mNextEntity;
     
     // Active entities list - ONLY contains living entities (major performance optimization)
     std::vector<Entity> mActiveEntities;
@@ -98,6 +155,9 @@ private:
     // Next component type to be assigned
     ComponentType mNextComponentType;
     
+    // Transient per-frame allocations (queries, scratch lists)
+    FrameArena mFrameArena;
+    
     // Helper functions
     template<typename T>
     ComponentType GetComponentType();
@@ -111,6 +171,10 @@ template<typename T>
 void EntityManager::RegisterComponentType() {
     const char* typeName = typeid(T).name();
     
+    if (mComponentTypes.count(std::type_index(typeid(T))) != 0) {
+        return;
+    }
+    
     // Register this component type
     mComponentTypes.insert({std::type_index(typeid(T)), mNextComponentType});
     mComponentNames.insert({mNextComponentType, typeName});
@@ -148,9 +212,9 @@ void EntityManager::AddComponent(Entity entity, T component) {
     mComponentArrays[componentType]->InsertData(entity, &component);
     
     // Set this bit to signify that the entity has this component
-    std::bitset<MAX_COMPONENT_TYPES> signature = GetSignature(entity);
-    signature.set(componentType);
-    SetSignature(entity, signature);
+    if (entity < mEntitySignatures.size()) {
+        mEntitySignatures[entity].set(componentType);
+    }
 }
 
 template<typename T>
@@ -160,9 +224,9 @@ void EntityManager::RemoveComponent(Entity entity) {
     mComponentArrays[componentType]->RemoveData(entity);
     
     // Unset this bit to signify that the entity doesn't have this component
-    std::bitset<MAX_COMPONENT_TYPES> signature = GetSignature(entity);
-    signature.set(componentType, false);
-    SetSignature(entity, signature);
+    if (entity < mEntitySignatures.size()) {
+        mEntitySignatures[entity].reset(componentType);
+    }
 }
 
 template<typename T>
@@ -178,6 +242,18 @@ T* EntityManager::GetComponent(Entity entity) {
     return componentArray->GetComponent(entity);
 }
 
+template<typename T>
+const T* EntityManager::GetComponent(Entity entity) const {
+    // Looked up without registering, so an unknown type has no components
+    auto it = mComponentTypes.find(std::type_index(typeid(T)));
+    if (it == mComponentTypes.end() || !mComponentArrays[it->second]) {
+        return nullptr;
+    }
+    
+    auto componentArray = static_cast<const ComponentArray<T>*>(mComponentArrays[it->second].get());
+    return componentArray->GetComponent(entity);
+}
+
 template<typename T>
 bool EntityManager::HasComponent(Entity entity) const {
     // Check if the entity has a component of type T
@@ -188,6 +264,20 @@ bool EntityManager::HasComponent(Entity entity) const {
 template<typename... Components>
 std::vector<Entity> EntityManager::GetEntitiesWith() {
     std::vector<Entity> matchingEntities;
+    GetEntitiesWith<Components...>(matchingEntities);
+    return matchingEntities;
+}
+
+template<typename... Components>
+ArenaVector<Entity> EntityManager::GetFrameEntitiesWith() {
+    ArenaVector<Entity> matchingEntities{ArenaAllocator<Entity>(mFrameArena)};
+    GetEntitiesWith<Components...>(matchingEntities);
+    return matchingEntities;
+}
+
+template<typename... Components, typename Allocator>
+void EntityManager::GetEntitiesWith(std::vector<Entity, Allocator>& matchingEntities) {
+    matchingEntities.clear();
     matchingEntities.reserve(mActiveEntities.size()); // Pre-allocate for performance
     
     // Create a signature that matches all the required components
@@ -197,15 +287,13 @@ std::vector<Entity> EntityManager::GetEntitiesWith() {
     // MAJOR PERFORMANCE OPTIMIZATION: Only iterate through active entities
     // This changes complexity from O(MAX_ENTITIES) to O(active_entities)
     for (Entity entity : mActiveEntities) {
-        std::bitset<MAX_COMPONENT_TYPES> entitySignature = GetSignature(entity);
+        const std::bitset<MAX_COMPONENT_TYPES>& entitySignature = mEntitySignatures[entity];
         
         // Check if entity has all required components
         if ((entitySignature & requiredSignature) == requiredSignature) {
             matchingEntities.push_back(entity);
         }
     }
-    
-    return matchingEntities;
 }
 
 template<typename T>
@@ -1,12 +1,16 @@
 #pragma once
 
 #include "Entity.h"
+#include <cstddef>
 
 namespace Lite2D {
 namespace ECS {
 
 // Forward declaration
 class Component;
+class StateHasher;
+class SnapshotWriter;
+class SnapshotReader;
 
 /**
  * Interface for component storage arrays
@@ -33,6 +37,20 @@ public:
     
     // Get component type name
     virtual const char* GetComponentTypeName() const = 0;
+    
+    // Number of components currently stored
+    virtual size_t GetSize() const = 0;
+    
+    // Dense entity order plus each component's HashState, for lockstep checks
+    virtual void HashState(StateHasher& hasher) const = 0;
+    
+    // Remove every component, keeping storage for reuse
+    virtual void Clear() = 0;
+    
+    // Binary snapshot: index maps as blocks, then each component's fields.
+    // ReadSnapshot replaces the contents and returns false on malformed data.
+    virtual void WriteSnapshot(SnapshotWriter& writer) const = 0;
+    virtual bool ReadSnapshot(SnapshotReader& reader) = 0;
 };
 
 } // namespace ECS
@@ -0,0 +1,98 @@
+#include "Lockstep.h"
+#include <algorithm>
+
+namespace Lite2D {
+namespace ECS {
+
+Lockstep::Lockstep(World& world, float fixedDeltaTime)
+    : mWorld(world), mFixedDeltaTime(fixedDeltaTime) {
+}
+
+int Lockstep::Advance(double elapsedSeconds, int maxTicks) {
+    mAccumulator += elapsedSeconds;
+    
+    int ticks = 0;
+    while (mAccumulator >= mFixedDeltaTime && ticks < maxTicks) {
+        Tick();
+        mAccumulator -= mFixedDeltaTime;
+        ticks++;
+    }
+    
+    // Too far behind (e.g. after a breakpoint): drop the backlog rather than spiral
+    if (ticks == maxTicks) {
+        mAccumulator = std::min(mAccumulator, static_cast<double>(mFixedDeltaTime));
+    }
+    return ticks;
+}
+
+void Lockstep::Tick() {
+    if (mInput) {
+        mInput(mWorld, mTick);
+    }
+    
+    mWorld.Step(mFixedDeltaTime);
+    mTick++;
+    
+    if (mHashInterval != 0 && mTick % mHashInterval == 0) {
+        mTrace.push_back({mTick, mWorld.ComputeStateHash()});
+    }
+    
+    if (mRewind) {
+        RecordRewindFrame();
+    }
+}
+
+void Lockstep::EnableRewind(size_t maxBytes) {
+    if (maxBytes == 0) {
+        mRewind.reset();
+        return;
+    }
+    
+    mRewind = std::make_unique<RewindBuffer>(maxBytes);
+    RecordRewindFrame();
+}
+
+bool Lockstep::Rewind(uint64_t ticks) {
+    if (!mRewind || ticks > mTick || !mRewind->ReadFrame(static_cast<size_t>(ticks), mRewindFrame)) {
+        return false;
+    }
+    
+    // The history is only consumed once the frame has loaded
+    SnapshotReader reader(mRewindFrame.data(), mRewindFrame.size());
+    if (!mWorld.LoadSnapshot(reader)) {
+        return false;
+    }
+    mRewind->Rewind(static_cast<size_t>(ticks));
+    
+    mTick -= ticks;
+    mAccumulator = 0.0;
+    while (!mTrace.empty() && mTrace.back().tick > mTick) {
+        mTrace.pop_back();
+    }
+    return true;
+}
+
+void Lockstep::RecordRewindFrame() {
+    mSnapshotScratch.Clear();
+    mWorld.SaveSnapshot(mSnapshotScratch);
+    mRewind->Push(mSnapshotScratch);
+}
+
+void Lockstep::Run(uint64_t tickCount) {
+    for (uint64_t i = 0; i < tickCount; ++i) {
+        Tick();
+    }
+}
+
+int64_t Lockstep::FindDivergence(const std::vector<TickHash>& reference, const std::vector<TickHash>& trace) {
+    const size_t count = std::min(reference.size(), trace.size());
+    for (size_t i = 0; i < count; ++i) {
+        if (reference[i].tick != trace[i].tick || reference[i].hash != trace[i].hash) {
+            return static_cast<int64_t>(reference[i].tick);
+        }
+    }
+    return -1;
+}
+
+} // namespace ECS
+} // namespace Lite2D
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "World.h"
+#include "RewindBuffer.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Lite2D {
+namespace ECS {
+
+/**
+ * Lockstep
+ * Drives a World in fixed ticks so that the same seed and inputs give a
+ * bit-identical run: constant timestep, systems in registration order, seeded
+ * per-system random streams and inputs applied by tick number. After every
+ * hashed tick the world's state hash goes into a trace; comparing traces from
+ * two runs (a reference and a parallel or SIMD variant, or a replay) finds the
+ * first tick where they diverged. Build with LITE2D_STRICT_FLOAT (the default)
+ * so the compiler doesn't fuse or reorder float math differently between paths.
+ */
+class Lockstep {
+public:
+    // Applies this tick's inputs to the world before it steps
+    using InputFunction = std::function<void(World& world, uint64_t tick)>;
+    
+    struct TickHash {
+        uint64_t tick;  // Ticks completed when the hash was taken
+        uint64_t hash;
+    };
+    
+    explicit Lockstep(World& world, float fixedDeltaTime = 1.0f / 60.0f);
+    
+    void SetInput(InputFunction input) { mInput = std::move(input); }
+    
+    // Hash every interval ticks (0 = never, default every tick)
+    void SetHashInterval(uint32_t interval) { mHashInterval = interval; }
+    
+    // Runs the whole ticks covered by elapsed real time, at most maxTicks; the
+    // remainder carries over. Returns the number of ticks run.
+    int Advance(double elapsedSeconds, int maxTicks = 8);
+    
+    // Exactly one fixed step
+    void Tick();
+    void Run(uint64_t tickCount);
+    
+    uint64_t GetTick() const { return mTick; }
+    float GetFixedDeltaTime() const { return mFixedDeltaTime; }
+    
+    // Fraction of a tick left in the accumulator, for render interpolation
+    float GetInterpolationAlpha() const { return static_cast<float>(mAccumulator / mFixedDeltaTime); }
+    
+    const std::vector<TickHash>& GetHashTrace() const { return mTrace; }
+    uint64_t GetLastHash() const { return mTrace.empty() ? 0 : mTrace.back().hash; }
+    void ClearTrace() { mTrace.clear(); }
+    
+    // Snapshot the world after every tick into a rewind history of at most maxBytes
+    // (0 turns it off). The current state is recorded right away as the oldest frame.
+    void EnableRewind(size_t maxBytes = RewindBuffer::DEFAULT_MAX_BYTES);
+    
+    // Restores the world as it was ticks ticks ago and drops later hashes from the
+    // trace; running again re-simulates those ticks. Fails if the history is shorter
+    // or the frame no longer loads (e.g. a system was added since), in which case the
+    // world, the tick and the history are left as they were.
+    bool Rewind(uint64_t ticks);
+    const RewindBuffer* GetRewindBuffer() const { return mRewind.get(); }
+    
+    // Tick of the first entry where the traces disagree, or -1 if one is a prefix of the other
+    static int64_t FindDivergence(const std::vector<TickHash>& reference, const std::vector<TickHash>& trace);
+
+private:
+    World& mWorld;
+    float mFixedDeltaTime;
+    double mAccumulator = 0.0;
+    uint64_t mTick = 0;
+    uint32_t mHashInterval = 1;
+    InputFunction mInput;
+    std::vector<TickHash> mTrace;
+    std::unique_ptr<RewindBuffer> mRewind;
+    SnapshotWriter mSnapshotScratch;
+    std::vector<uint8_t> mRewindFrame;
+    
+    void RecordRewindFrame();
+};
+
+} // namespace ECS
+} // namespace Lite2D
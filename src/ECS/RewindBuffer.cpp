@@ -0,0 +1,158 @@
+#include "RewindBuffer.h"
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace Lite2D {
+namespace ECS {
+
+RewindBuffer::RewindBuffer(size_t maxBytes, size_t pageSize)
+    : mMaxBytes(maxBytes), mPageSize(std::max(pageSize, size_t(64))) {
+}
+
+void RewindBuffer::Push(const uint8_t* data, size_t size) {
+    const size_t pageCount = (mNewest.size() + mPageSize - 1) / mPageSize;
+    mLastPages = (size + mPageSize - 1) / mPageSize;
+    
+    if (!mHasFrame) {
+        mNewest.assign(data, data + size);
+        mHasFrame = true;
+        mLastDirtyPages = mLastPages;
+        DropOldestOverBudget();
+        return;
+    }
+    
+    // Old contents of every page of the newest frame that the new frame doesn't reproduce
+    Delta delta = AcquireDelta();
+    delta.frameSize = mNewest.size();
+    for (size_t page = 0; page < pageCount; ++page) {
+        const size_t offset = page * mPageSize;
+        const size_t length = std::min(mPageSize, mNewest.size() - offset);
+        const size_t newLength = size > offset ? std::min(mPageSize, size - offset) : 0;
+        if (length == newLength && std::memcmp(mNewest.data() + offset, data + offset, length) == 0) {
+            continue;
+        }
+        delta.pages.push_back(static_cast<uint32_t>(page));
+        delta.bytes.insert(delta.bytes.end(), mNewest.data() + offset, mNewest.data() + offset + length);
+    }
+    
+    // Dirty pages of the new frame: changed ones, plus growth past the old end (pages
+    // cut off by shrinking are in the delta but no longer part of the frame)
+    mLastDirtyPages = (mLastPages > pageCount ? mLastPages - pageCount : 0) +
+        static_cast<size_t>(std::count_if(delta.pages.begin(), delta.pages.end(),
+                                          [this](uint32_t page) { return page < mLastPages; }));
+    
+    // Only the changed pages and any growth need copying into the newest frame
+    const size_t oldSize = mNewest.size();
+    mNewest.resize(size);
+    for (uint32_t page : delta.pages) {
+        const size_t offset = static_cast<size_t>(page) * mPageSize;
+        if (offset < size) {
+            std::memcpy(mNewest.data() + offset, data + offset, std::min(mPageSize, size - offset));
+        }
+    }
+    const size_t grownFrom = pageCount * mPageSize;
+    if (size > grownFrom && size > oldSize) {
+        std::memcpy(mNewest.data() + grownFrom, data + grownFrom, size - grownFrom);
+    }
+    
+    mDeltaMemory += delta.GetMemoryUsage();
+    mDeltas.push_back(std::move(delta));
+    DropOldestOverBudget();
+}
+
+bool RewindBuffer::Rewind(size_t frames) {
+    if (frames > mDeltas.size()) {
+        return false;
+    }
+    
+    for (size_t i = 0; i < frames; ++i) {
+        Delta& delta = mDeltas.back();
+        ApplyDelta(delta, mNewest);
+        mDeltaMemory -= delta.GetMemoryUsage();
+        RecycleDelta(std::move(delta));
+        mDeltas.pop_back();
+    }
+    UpdateMemoryUsage();
+    return true;
+}
+
+bool RewindBuffer::ReadFrame(size_t frames, std::vector<uint8_t>& frame) const {
+    if (!mHasFrame || frames > mDeltas.size()) {
+        return false;
+    }
+    
+    frame.assign(mNewest.begin(), mNewest.end());
+    for (size_t i = 0; i < frames; ++i) {
+        ApplyDelta(mDeltas[mDeltas.size() - 1 - i], frame);
+    }
+    return true;
+}
+
+void RewindBuffer::Clear() {
+    mNewest.clear();
+    mNewest.shrink_to_fit();
+    mDeltas.clear();
+    mSpareDeltas.clear();
+    mHasFrame = false;
+    mDeltaMemory = 0;
+    mSpareMemory = 0;
+    mLastDirtyPages = 0;
+    mLastPages = 0;
+    UpdateMemoryUsage();
+}
+
+RewindBuffer::Delta RewindBuffer::AcquireDelta() {
+    if (mSpareDeltas.empty()) {
+        return Delta();
+    }
+    
+    Delta delta = std::move(mSpareDeltas.back());
+    mSpareDeltas.pop_back();
+    mSpareMemory -= delta.GetMemoryUsage();
+    return delta;
+}
+
+void RewindBuffer::RecycleDelta(Delta&& delta) {
+    // Reuse only while the budget allows; otherwise the storage is freed
+    const size_t memory = delta.GetMemoryUsage();
+    if (mSpareDeltas.size() >= MAX_SPARE_DELTAS ||
+        mNewest.capacity() + mDeltaMemory + mSpareMemory + memory > mMaxBytes) {
+        return;
+    }
+    
+    delta.pages.clear();
+    delta.bytes.clear();
+    mSpareMemory += memory;
+    mSpareDeltas.push_back(std::move(delta));
+}
+
+void RewindBuffer::ApplyDelta(const Delta& delta, std::vector<uint8_t>& frame) const {
+    frame.resize(delta.frameSize);
+    
+    const uint8_t* source = delta.bytes.data();
+    for (uint32_t page : delta.pages) {
+        const size_t offset = static_cast<size_t>(page) * mPageSize;
+        const size_t length = std::min(mPageSize, delta.frameSize - offset);
+        std::memcpy(frame.data() + offset, source, length);
+        source += length;
+    }
+}
+
+void RewindBuffer::DropOldestOverBudget() {
+    // Spare storage goes first, then history from the oldest end
+    while (mNewest.capacity() + mDeltaMemory + mSpareMemory > mMaxBytes && !mSpareDeltas.empty()) {
+        mSpareMemory -= mSpareDeltas.back().GetMemoryUsage();
+        mSpareDeltas.pop_back();
+    }
+    while (mNewest.capacity() + mDeltaMemory > mMaxBytes && !mDeltas.empty()) {
+        Delta& oldest = mDeltas.front();
+        mDeltaMemory -= oldest.GetMemoryUsage();
+        RecycleDelta(std::move(oldest));
+        mDeltas.pop_front();
+    }
+    UpdateMemoryUsage();
+}
+
+} // namespace ECS
+} // namespace Lite2D
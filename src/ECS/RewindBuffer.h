@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Snapshot.h"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace Lite2D {
+namespace ECS {
+
+/**
+ * Rewind Buffer
+ * Bounded history of per-frame snapshots for rewind and re-simulation. Only the
+ * newest frame is kept whole. Each Push() compares the new frame with it page by
+ * page and keeps just the pages that changed, as a reverse delta that turns the
+ * newest frame back into the one before. Rewinding N frames applies the N newest
+ * deltas. Pools nobody wrote to cost nothing.
+ *
+ * Limitation: dirtiness comes from serializing the whole frame and comparing it,
+ * and pools sit back to back rather than at fixed offsets. A pool that changes
+ * size (an entity created or destroyed) shifts every later byte, so every page
+ * after it is stored for that frame. Spawn-heavy frames cost close to a full copy.
+ *
+ * When the history outgrows maxBytes the oldest deltas are dropped, so memory stays
+ * bounded at the cost of how far back one can go. GetMemoryUsage() reports it all.
+ */
+class RewindBuffer {
+public:
+    static constexpr size_t DEFAULT_MAX_BYTES = 64 * 1024 * 1024;
+    static constexpr size_t DEFAULT_PAGE_SIZE = 4096;
+
+    explicit RewindBuffer(size_t maxBytes = DEFAULT_MAX_BYTES, size_t pageSize = DEFAULT_PAGE_SIZE);
+
+    // Records the next frame
+    void Push(const uint8_t* data, size_t size);
+    void Push(const SnapshotWriter& frame) { Push(frame.GetData(), frame.GetSize()); }
+
+    // Drops the newest frames; the frame that is then newest is the one to load.
+    // Fails (changing nothing) if fewer than frames older frames are stored.
+    bool Rewind(size_t frames);
+
+    // The frame Rewind(frames) would leave newest, copied out without dropping
+    // anything, so a caller can load it first and only commit once that worked
+    bool ReadFrame(size_t frames, std::vector<uint8_t>& frame) const;
+
+    // Newest frame, whole
+    const uint8_t* GetNewestData() const { return mNewest.data(); }
+    size_t GetNewestSize() const { return mNewest.size(); }
+    bool IsEmpty() const { return !mHasFrame; }
+
+    // How many frames back Rewind can go
+    size_t GetDepth() const { return mDeltas.size(); }
+
+    void Clear();
+
+    // Memory held by the newest frame, the deltas and recycled delta storage
+    size_t GetMemoryUsage() const { return mMemoryUsage; }
+    size_t GetMaxBytes() const { return mMaxBytes; }
+    size_t GetPageSize() const { return mPageSize; }
+
+    // Pages that changed in the last Push, out of how many the frame had
+    size_t GetLastDirtyPageCount() const { return mLastDirtyPages; }
+    size_t GetLastPageCount() const { return mLastPages; }
+
+private:
+    // Old contents of the pages that changed, and the old frame size
+    struct Delta {
+        size_t frameSize = 0;
+        std::vector<uint32_t> pages;
+        std::vector<uint8_t> bytes;
+
+        size_t GetMemoryUsage() const { return sizeof(Delta) + pages.capacity() * sizeof(uint32_t) + bytes.capacity(); }
+    };
+
+    // Emptied deltas kept (within maxBytes) so steady-state pushes reuse their storage
+    static constexpr size_t MAX_SPARE_DELTAS = 2;
+
+    size_t mMaxBytes;
+    size_t mPageSize;
+    bool mHasFrame = false;
+    std::vector<uint8_t> mNewest;
+    std::deque<Delta> mDeltas;
+    std::vector<Delta> mSpareDeltas;
+    size_t mDeltaMemory = 0;
+    size_t mSpareMemory = 0;
+    size_t mMemoryUsage = 0;
+    size_t mLastDirtyPages = 0;
+    size_t mLastPages = 0;
+
+    Delta AcquireDelta();
+    void RecycleDelta(Delta&& delta);
+    void ApplyDelta(const Delta& delta, std::vector<uint8_t>& frame) const;
+    void DropOldestOverBudget();
+    void UpdateMemoryUsage() { mMemoryUsage = mNewest.capacity() + mDeltaMemory + mSpareMemory; }
+};
+
+} // namespace ECS
+} // namespace Lite2D
@@ -0,0 +1,56 @@
+#include "Snapshot.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+namespace Lite2D {
+namespace ECS {
+
+void SnapshotWriter::Grow(size_t required) {
+    mBuffer.resize(std::max({required, mBuffer.size() * 2, size_t(4096)}));
+}
+
+void SnapshotWriter::WriteString(const char* text) {
+    const uint32_t length = text ? static_cast<uint32_t>(std::strlen(text)) : 0;
+    Write(length);
+    WriteBytes(text, length);
+}
+
+bool SnapshotWriter::SaveToFile(const std::string& path) const {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) {
+        std::cerr << "Failed to open snapshot file for writing: " << path << std::endl;
+        return false;
+    }
+
+    out.write(reinterpret_cast<const char*>(mBuffer.data()), static_cast<std::streamsize>(mSize));
+    return static_cast<bool>(out);
+}
+
+bool SnapshotReader::ReadString(std::string& text) {
+    uint32_t length = 0;
+    if (!Read(length) || length > GetRemaining()) {
+        mFailed = true;
+        return false;
+    }
+
+    text.assign(reinterpret_cast<const char*>(mData + mOffset), length);
+    mOffset += length;
+    return true;
+}
+
+bool ReadSnapshotFile(const std::string& path, std::vector<uint8_t>& data) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        std::cerr << "Failed to open snapshot file: " << path << std::endl;
+        return false;
+    }
+
+    const std::streamsize size = in.tellg();
+    in.seekg(0);
+    data.resize(static_cast<size_t>(size));
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(data.data()), size));
+}
+
+} // namespace ECS
+} // namespace Lite2D
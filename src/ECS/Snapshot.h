@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Lite2D {
+namespace ECS {
+
+// "L2DS" in the first four bytes; a byte-swapped magic means the file came from the other endianness
+constexpr uint32_t SNAPSHOT_MAGIC = 0x5344324C;
+constexpr uint32_t SNAPSHOT_VERSION = 1;
+
+/**
+ * Snapshot Writer
+ * Appends values and contiguous blocks to a growable byte buffer in native
+ * byte order. Write fixed-width types (uint32_t, not size_t) so the layout is
+ * the same on every platform. Clear() keeps the buffer for the next snapshot.
+ */
+class SnapshotWriter {
+public:
+    SnapshotWriter() = default;
+
+    // Trivially copyable values without padding
+    template<typename T>
+    void Write(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "Write fields one by one");
+        WriteBytes(&value, sizeof(T));
+    }
+
+    void WriteBytes(const void* data, size_t size) {
+        if (mSize + size > mBuffer.size()) {
+            Grow(mSize + size);
+        }
+        if (size > 0) {
+            std::memcpy(mBuffer.data() + mSize, data, size);
+        }
+        mSize += size;
+    }
+
+    // Element count followed by the elements as one block
+    template<typename T>
+    void WriteVector(const std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable elements can be written as a block");
+        Write(static_cast<uint64_t>(values.size()));
+        WriteBytes(values.data(), values.size() * sizeof(T));
+    }
+
+    void WriteString(const char* text);
+
+    void Reserve(size_t size) { if (size > mBuffer.size()) mBuffer.resize(size); }
+    void Clear() { mSize = 0; }
+
+    const uint8_t* GetData() const { return mBuffer.data(); }
+    size_t GetSize() const { return mSize; }
+
+    bool SaveToFile(const std::string& path) const;
+
+private:
+    std::vector<uint8_t> mBuffer;
+    size_t mSize = 0;
+
+    void Grow(size_t required);
+};
+
+/**
+ * Snapshot Reader
+ * Reads back what a SnapshotWriter wrote from memory it does not own. Reads
+ * past the end fail instead of overrunning; after the first failure every
+ * read fails, so callers can check IsOk() once at the end.
+ */
+class SnapshotReader {
+public:
+    SnapshotReader(const void* data, size_t size)
+        : mData(static_cast<const uint8_t*>(data)), mSize(size) {}
+
+    template<typename T>
+    bool Read(T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "Read fields one by one");
+        return ReadBytes(&value, sizeof(T));
+    }
+
+    bool ReadBytes(void* out, size_t size) {
+        if (mFailed || size > mSize - mOffset) {
+            mFailed = true;
+            return false;
+        }
+        if (size > 0) {
+            std::memcpy(out, mData + mOffset, size);
+        }
+        mOffset += size;
+        return true;
+    }
+
+    // Next size bytes in place, without copying; nullptr (and failed) if fewer remain
+    const uint8_t* ReadView(size_t size) {
+        if (mFailed || size > mSize - mOffset) {
+            mFailed = true;
+            return nullptr;
+        }
+        const uint8_t* view = mData + mOffset;
+        mOffset += size;
+        return view;
+    }
+
+    // Counterpart of WriteVector; fails on more than maxCount elements
+    template<typename T>
+    bool ReadVector(std::vector<T>& values, size_t maxCount) {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable elements can be read as a block");
+        uint64_t count = 0;
+        if (!Read(count) || count > maxCount || count * sizeof(T) > mSize - mOffset) {
+            mFailed = true;
+            return false;
+        }
+        values.resize(static_cast<size_t>(count));
+        return ReadBytes(values.data(), values.size() * sizeof(T));
+    }
+
+    bool ReadString(std::string& text);
+
+    // Marks the snapshot invalid, e.g. when a value is out of range
+    void Fail() { mFailed = true; }
+    bool IsOk() const { return !mFailed; }
+
+    size_t GetOffset() const { return mOffset; }
+    size_t GetRemaining() const { return mSize - mOffset; }
+
+private:
+    const uint8_t* mData;
+    size_t mSize;
+    size_t mOffset = 0;
+    bool mFailed = false;
+};
+
+// Reads a whole snapshot file into memory. To parse a file without copying it,
+// point a SnapshotReader at a MappedFile instead (EntityManager::LoadSnapshot(path) does).
+bool ReadSnapshotFile(const std::string& path, std::vector<uint8_t>& data);
+
+} // namespace ECS
+} // namespace Lite2D
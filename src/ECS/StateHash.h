@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace Lite2D {
+namespace ECS {
+
+/**
+ * State Hasher
+ * Streaming 64-bit hash of simulation state for lockstep divergence checks.
+ * Values are hashed by bit pattern, so 0.0f and -0.0f (or two NaNs) differ:
+ * the question is whether two runs are bit-identical, not whether they are close.
+ * Not cryptographic; one multiply-rotate per 8 bytes keeps per-frame hashing cheap.
+ */
+class StateHasher {
+public:
+    explicit StateHasher(uint64_t seed = 0) : mHash(seed ^ 0x9E3779B97F4A7C15ull) {}
+
+    // Scalars and enums, widened to one 64-bit word each
+    template<typename T>
+    void Add(T value) {
+        static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>, "Hash fields one by one");
+        if constexpr (std::is_floating_point_v<T>) {
+            // Bit pattern, not value
+            if constexpr (sizeof(T) == sizeof(uint32_t)) {
+                uint32_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                Mix(bits);
+            } else {
+                uint64_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                Mix(bits);
+            }
+        } else {
+            Mix(static_cast<uint64_t>(value));
+        }
+    }
+
+    // Raw memory without padding, e.g. float arrays
+    void AddBytes(const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        Mix(size);
+        for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t), bytes += sizeof(uint64_t)) {
+            uint64_t word;
+            std::memcpy(&word, bytes, sizeof(word));
+            Mix(word);
+        }
+        if (size > 0) {
+            uint64_t word = 0;
+            std::memcpy(&word, bytes, size);
+            Mix(word);
+        }
+    }
+
+    void AddString(const char* text) {
+        AddBytes(text, text ? std::strlen(text) : 0);
+    }
+
+    // Final avalanche; the hasher can keep accepting data afterwards
+    uint64_t GetHash() const {
+        uint64_t hash = mHash;
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 33;
+        hash *= 0xC4CEB9FE1A85EC53ull;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+private:
+    uint64_t mHash;
+
+    void Mix(uint64_t word) {
+        word *= 0x87C37B91114253D5ull;
+        word = (word << 31) | (word >> 33);
+        mHash ^= word * 0x4CF5AD432745937Full;
+        mHash = ((mHash << 27) | (mHash >> 37)) * 5 + 0x52DCE729;
+    }
+};
+
+} // namespace ECS
+} // namespace Lite2D
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "EntityManager.h"
+#include "StateHash.h"
+#include "Snapshot.h"
+#include "Utils/Random.h"
 
 namespace Lite2D {
 namespace ECS {
@@ -33,9 +36,30 @@ public:
     // Enable/disable system
     void SetEnabled(bool enabled) { mEnabled = enabled; }
     bool IsEnabled() const { return mEnabled; }
+    
+    // Entities handled by the last Update, reported to the profiler
+    size_t GetProcessedEntityCount() const { return mProcessedEntityCount; }
+    
+    // Per-system random stream, derived from a world seed and the system name so that
+    // adding or reordering systems doesn't shift another system's numbers
+    void SetRandomSeed(uint64_t worldSeed) { mRandom.Seed(Random::DeriveSeed(worldSeed, Random::HashName(GetName()))); }
+    Random& GetRandom() { return mRandom; }
+    const Random& GetRandom() const { return mRandom; }
+    
+    // Simulation state a system keeps outside component pools (e.g. particle buffers).
+    // The random stream is hashed by SystemManager, so overrides only add their own data.
+    virtual void HashState(StateHasher& hasher) const {}
+    void HashRandomState(StateHasher& hasher) const { hasher.AddBytes(mRandom.GetState(), 4 * sizeof(uint32_t)); }
+    
+    // Same state for snapshots and rewind; SystemManager saves the random stream.
+    // ReadSnapshot reports malformed data through reader.Fail().
+    virtual void WriteSnapshot(SnapshotWriter& writer) const {}
+    virtual void ReadSnapshot(SnapshotReader& reader) {}
 
 protected:
     bool mEnabled = true;
+    size_t mProcessedEntityCount = 0;
+    Random mRandom;
 };
 
 } // namespace ECS
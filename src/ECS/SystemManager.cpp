@@ -1,16 +1,87 @@
 #include "SystemManager.h"
+#include "Utils/Trace.h"
 #include <iostream>
+#include <iomanip>
 #include <algorithm>
+#include <chrono>
 
 namespace Lite2D {
 namespace ECS {
 
 void SystemManager::UpdateSystems(EntityManager& entityManager, float deltaTime) {
-    for (auto& system : mSystemsToUpdate) {
-        if (system->IsEnabled()) {
-            system->Update(entityManager, deltaTime);
+    LITE2D_TRACE_SCOPE("SystemManager::UpdateSystems");
+    
+    if (mProfilingEnabled) {
+        UpdateSystemsProfiled(entityManager, deltaTime);
+    } else {
+        for (auto& system : mSystemsToUpdate) {
+            if (system->IsEnabled()) {
+                LITE2D_TRACE_SCOPE(system->GetName());
+                system->Update(entityManager, deltaTime);
+            }
+        }
+    }
+    
+    // Frame over, drop this frame's transient allocations in one step
+    entityManager.EndFrame();
+}
+
+void SystemManager::UpdateSystemsProfiled(EntityManager& entityManager, float deltaTime) {
+    using Clock = std::chrono::steady_clock;
+    
+    for (size_t i = 0; i < mSystemsToUpdate.size(); ++i) {
+        auto& system = mSystemsToUpdate[i];
+        if (!system->IsEnabled()) continue;
+        
+        LITE2D_TRACE_SCOPE(system->GetName());
+        size_t allocationsBefore = mAllocationCounter ? mAllocationCounter() : 0;
+        size_t bytesBefore = mAllocatedBytesCounter ? mAllocatedBytesCounter() : 0;
+        auto start = Clock::now();
+        
+        system->Update(entityManager, deltaTime);
+        
+        auto end = Clock::now();
+        size_t allocationsAfter = mAllocationCounter ? mAllocationCounter() : 0;
+        size_t bytesAfter = mAllocatedBytesCounter ? mAllocatedBytesCounter() : 0;
+        
+        SystemFrameSample sample;
+        sample.milliseconds = std::chrono::duration<float, std::milli>(end - start).count();
+        sample.entityCount = system->GetProcessedEntityCount();
+        sample.allocations = allocationsAfter - allocationsBefore;
+        sample.allocatedBytes = bytesAfter - bytesBefore;
+        mSystemStats[i].AddSample(sample);
+    }
+}
+
+const SystemStats* SystemManager::GetSystemStats(const std::string& systemName) const {
+    for (size_t i = 0; i < mSystemsToUpdate.size(); ++i) {
+        if (systemName == mSystemsToUpdate[i]->GetName()) {
+            return &mSystemStats[i];
         }
     }
+    return nullptr;
+}
+
+void SystemManager::EnableProfiling(bool enabled) {
+    mProfilingEnabled = enabled;
+    if (enabled) {
+        // Up front, so profiled frames don't allocate
+        for (auto& stats : mSystemStats) {
+            stats.Allocate();
+        }
+    }
+}
+
+void SystemManager::ResetProfiling() {
+    for (auto& stats : mSystemStats) {
+        stats.Reset();
+    }
+}
+
+void SystemManager::ReleaseProfiling() {
+    for (auto& stats : mSystemStats) {
+        stats.Release();
+    }
 }
 
 void SystemManager::OnEntityDestroyed(Entity entity) {
@@ -56,14 +127,108 @@ void SystemManager::EnableSystem(const std::string& systemName, bool enabled) {
     }
 }
 
+void SystemManager::SetRandomSeed(uint64_t seed) {
+    mRandomSeed = seed;
+    for (auto& system : mSystemsToUpdate) {
+        system->SetRandomSeed(seed);
+    }
+}
+
+void SystemManager::HashState(StateHasher& hasher) const {
+    for (const auto& system : mSystemsToUpdate) {
+        hasher.AddString(system->GetName());
+        hasher.Add(system->IsEnabled());
+        system->HashRandomState(hasher);
+        system->HashState(hasher);
+    }
+}
+
+void SystemManager::SaveSnapshot(SnapshotWriter& writer) const {
+    writer.Write(static_cast<uint32_t>(mSystemsToUpdate.size()));
+    for (const auto& system : mSystemsToUpdate) {
+        writer.WriteString(system->GetName());
+        writer.Write(system->IsEnabled());
+        writer.WriteBytes(system->GetRandom().GetState(), 4 * sizeof(uint32_t));
+        system->WriteSnapshot(writer);
+    }
+}
+
+bool SystemManager::LoadSnapshot(SnapshotReader& reader) {
+    uint32_t systemCount = 0;
+    if (!reader.Read(systemCount) || systemCount != mSystemsToUpdate.size()) {
+        std::cerr << "Snapshot: system count does not match" << std::endl;
+        return false;
+    }
+    
+    std::string name;
+    for (auto& system : mSystemsToUpdate) {
+        bool enabled = true;
+        uint32_t randomState[4];
+        if (!reader.ReadString(name) || name != system->GetName()) {
+            std::cerr << "Snapshot: expected system " << system->GetName() << std::endl;
+            return false;
+        }
+        reader.Read(enabled);
+        reader.ReadBytes(randomState, sizeof(randomState));
+        if (!reader.IsOk()) return false;
+        
+        system->SetEnabled(enabled);
+        system->GetRandom().SetState(randomState);
+        system->ReadSnapshot(reader);
+        if (!reader.IsOk()) {
+            std::cerr << "Snapshot: corrupt state for system " << name << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+void SystemManager::SaveSystemTable(SnapshotWriter& writer) const {
+    writer.Write(static_cast<uint32_t>(mSystemsToUpdate.size()));
+    for (const auto& system : mSystemsToUpdate) {
+        writer.WriteString(system->GetName());
+    }
+}
+
+bool SystemManager::CheckSystemTable(SnapshotReader& reader) const {
+    uint32_t systemCount = 0;
+    if (!reader.Read(systemCount) || systemCount != mSystemsToUpdate.size()) {
+        std::cerr << "Snapshot: system count does not match" << std::endl;
+        return false;
+    }
+    
+    std::string name;
+    for (const auto& system : mSystemsToUpdate) {
+        if (!reader.ReadString(name) || name != system->GetName()) {
+            std::cerr << "Snapshot: expected system " << system->GetName() << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
 void SystemManager::PrintSystemInfo() const {
     std::cout << "=== System Manager Info ===" << std::endl;
     std::cout << "Registered Systems: " << mSystems.size() << std::endl;
     
-    for (const auto& system : mSystemsToUpdate) {
+    for (size_t i = 0; i < mSystemsToUpdate.size(); ++i) {
+        const auto& system = mSystemsToUpdate[i];
         std::cout << "- " << system->GetName() 
                   << " (enabled: " << (system->IsEnabled() ? "yes" : "no") << ")" 
                   << std::endl;
+        
+        const SystemStats& stats = mSystemStats[i];
+        if (stats.GetSampleCount() > 0) {
+            std::cout << std::fixed << std::setprecision(3)
+                      << "    time ms min/avg/p99: " << stats.GetMinMilliseconds()
+                      << " / " << stats.GetAverageMilliseconds()
+                      << " / " << stats.GetP99Milliseconds()
+                      << ", entities: " << std::setprecision(1) << stats.GetAverageEntityCount()
+                      << ", allocs/frame: " << stats.GetAverageAllocations()
+                      << " (" << stats.GetAverageAllocatedBytes() << " B)"
+                      << " (" << stats.GetSampleCount() << " frames)"
+                      << std::defaultfloat << std::endl;
+        }
     }
     std::cout << "=========================" << std::endl;
 }
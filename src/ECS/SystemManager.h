@@ -2,6 +2,8 @@
 
 #include "System.h"
 #include "EntityManager.h"
+#include "SystemProfiler.h"
+#include "Utils/AllocationTracker.h"
 #include <vector>
 #include <memory>
 #include <unordered_map>
@@ -49,6 +51,43 @@ public:
     size_t GetSystemCount() const { return mSystems.size(); }
     void EnableSystem(const std::string& systemName, bool enabled);
     
+    // Profiling - per-system wall time, entity count and allocations for each UpdateSystems call.
+    // Disabled by default; when off UpdateSystems pays a single branch and no system holds a
+    // sample history. Enabling allocates each system's history; it is kept when disabled
+    // again, so the last numbers stay readable, until ReleaseProfiling().
+    // Allocations come from AllocationTracker's per-thread counters (zero unless
+    // LITE2D_TRACK_ALLOCATIONS) unless replaced, so other threads' allocations don't leak in.
+    using AllocationCounter = size_t (*)();
+    void EnableProfiling(bool enabled);
+    bool IsProfilingEnabled() const { return mProfilingEnabled; }
+    void SetAllocationCounter(AllocationCounter counter) { mAllocationCounter = counter; }
+    void SetAllocatedBytesCounter(AllocationCounter counter) { mAllocatedBytesCounter = counter; }
+    const SystemStats* GetSystemStats(const std::string& systemName) const;
+    
+    // Indexed access in execution order (0 .. GetSystemCount() - 1)
+    const System& GetSystemAt(size_t index) const { return *mSystemsToUpdate[index]; }
+    const SystemStats& GetSystemStatsAt(size_t index) const { return mSystemStats[index]; }
+    void ResetProfiling();
+    void ReleaseProfiling();
+    
+    // Seeds every system's random stream (System::SetRandomSeed), including systems registered later.
+    // Defaults to 0, so runs are reproducible unless a game picks a seed of its own.
+    void SetRandomSeed(uint64_t seed);
+    uint64_t GetRandomSeed() const { return mRandomSeed; }
+    
+    // Lockstep state hash of every system in execution order: name, random stream, HashState
+    void HashState(StateHasher& hasher) const;
+    
+    // Every system's enabled flag, random stream and WriteSnapshot data, in execution order.
+    // Loading requires the same systems registered in the same order.
+    void SaveSnapshot(SnapshotWriter& writer) const;
+    bool LoadSnapshot(SnapshotReader& reader);
+    
+    // Just the system count and names. Written ahead of a combined snapshot, it lets a
+    // load be refused before anything is touched when the registered systems differ.
+    void SaveSystemTable(SnapshotWriter& writer) const;
+    bool CheckSystemTable(SnapshotReader& reader) const;
+    
     // Debug
     void PrintSystemInfo() const;
 
@@ -62,6 +101,16 @@ private:
     // Systems in execution order
     std::vector<std::shared_ptr<System>> mSystemsToUpdate;
     
+    // Profiling history, parallel to mSystemsToUpdate
+    std::vector<SystemStats> mSystemStats;
+    bool mProfilingEnabled = false;
+    AllocationCounter mAllocationCounter = &AllocationTracker::GetThreadAllocationCount;
+    AllocationCounter mAllocatedBytesCounter = &AllocationTracker::GetThreadAllocatedBytes;
+    
+    uint64_t mRandomSeed = 0;
+    
+    void UpdateSystemsProfiled(EntityManager& entityManager, float deltaTime);
+    
     // Helper function to get system type index
     template<typename T>
     std::type_index GetSystemTypeIndex();
@@ -81,8 +130,13 @@ std::shared_ptr<T> SystemManager::RegisterSystem(Args&&... args) {
     
     // Create system instance
     auto system = std::make_shared<T>(std::forward<Args>(args)...);
+    system->SetRandomSeed(mRandomSeed);
     mSystems.insert({typeIndex, system});
     mSystemsToUpdate.push_back(system);
+    mSystemStats.emplace_back();
+    if (mProfilingEnabled) {
+        mSystemStats.back().Allocate();
+    }
     
     return system;
 }
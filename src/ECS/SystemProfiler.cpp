@@ -0,0 +1,117 @@
+#include "SystemProfiler.h"
+#include <algorithm>
+
+namespace Lite2D {
+namespace ECS {
+
+void SystemStats::AddSample(const SystemFrameSample& sample) {
+    if (!IsAllocated()) {
+        Allocate();
+    }
+    mSamples[mNext] = sample;
+    mNext = (mNext + 1) % HISTORY_SIZE;
+    if (mCount < HISTORY_SIZE) {
+        mCount++;
+    }
+}
+
+void SystemStats::Reset() {
+    mNext = 0;
+    mCount = 0;
+}
+
+void SystemStats::Allocate() {
+    mSamples.resize(HISTORY_SIZE);
+    mScratch.resize(HISTORY_SIZE);
+}
+
+void SystemStats::Release() {
+    Reset();
+    mSamples = std::vector<SystemFrameSample>();
+    mScratch = std::vector<float>();
+}
+
+const SystemFrameSample& SystemStats::GetSample(size_t index) const {
+    size_t oldest = (mNext + HISTORY_SIZE - mCount) % HISTORY_SIZE;
+    return mSamples[(oldest + index) % HISTORY_SIZE];
+}
+
+const SystemFrameSample& SystemStats::GetLastSample() const {
+    static const SystemFrameSample empty;
+    return mCount > 0 ? GetSample(mCount - 1) : empty;
+}
+
+float SystemStats::GetMinMilliseconds() const {
+    if (mCount == 0) return 0.0f;
+
+    float result = GetSample(0).milliseconds;
+    for (size_t i = 1; i < mCount; ++i) {
+        result = std::min(result, GetSample(i).milliseconds);
+    }
+    return result;
+}
+
+float SystemStats::GetMaxMilliseconds() const {
+    float result = 0.0f;
+    for (size_t i = 0; i < mCount; ++i) {
+        result = std::max(result, GetSample(i).milliseconds);
+    }
+    return result;
+}
+
+float SystemStats::GetAverageMilliseconds() const {
+    if (mCount == 0) return 0.0f;
+
+    double total = 0.0;
+    for (size_t i = 0; i < mCount; ++i) {
+        total += GetSample(i).milliseconds;
+    }
+    return static_cast<float>(total / mCount);
+}
+
+float SystemStats::GetP99Milliseconds() const {
+    if (mCount == 0) return 0.0f;
+
+    for (size_t i = 0; i < mCount; ++i) {
+        mScratch[i] = GetSample(i).milliseconds;
+    }
+
+    // Nearest-rank percentile
+    size_t rank = (mCount * 99 + 99) / 100;
+    size_t index = std::min(rank, mCount) - 1;
+    std::nth_element(mScratch.begin(), mScratch.begin() + index, mScratch.begin() + mCount);
+    return mScratch[index];
+}
+
+float SystemStats::GetAverageEntityCount() const {
+    if (mCount == 0) return 0.0f;
+
+    double total = 0.0;
+    for (size_t i = 0; i < mCount; ++i) {
+        total += static_cast<double>(GetSample(i).entityCount);
+    }
+    return static_cast<float>(total / mCount);
+}
+
+float SystemStats::GetAverageAllocations() const {
+    if (mCount == 0) return 0.0f;
+
+    double total = 0.0;
+    for (size_t i = 0; i < mCount; ++i) {
+        total += static_cast<double>(GetSample(i).allocations);
+    }
+    return static_cast<float>(total / mCount);
+}
+
+float SystemStats::GetAverageAllocatedBytes() const {
+    if (mCount == 0) return 0.0f;
+
+    double total = 0.0;
+    for (size_t i = 0; i < mCount; ++i) {
+        total += static_cast<double>(GetSample(i).allocatedBytes);
+    }
+    return static_cast<float>(total / mCount);
+}
+
+} // namespace ECS
+} // namespace Lite2D
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Lite2D {
+namespace ECS {
+
+/**
+ * One profiled Update call
+ */
+struct SystemFrameSample {
+    float milliseconds = 0.0f;
+    size_t entityCount = 0;
+    size_t allocations = 0;
+    size_t allocatedBytes = 0;
+};
+
+/**
+ * System Stats
+ * Ring buffer of the most recent per-frame samples for one system. The ring is
+ * only allocated once profiling is turned on (Allocate(), or the first sample),
+ * so an unprofiled system carries a few empty vectors rather than ~8 KB of history.
+ */
+class SystemStats {
+public:
+    static constexpr size_t HISTORY_SIZE = 240;
+
+    void AddSample(const SystemFrameSample& sample);
+    void Reset();
+
+    // Ring and percentile scratch storage; Release() drops the history with it
+    void Allocate();
+    void Release();
+    bool IsAllocated() const { return !mSamples.empty(); }
+
+    size_t GetSampleCount() const { return mCount; }
+    const SystemFrameSample& GetLastSample() const;
+
+    // Wall time over the recorded history
+    float GetMinMilliseconds() const;
+    float GetAverageMilliseconds() const;
+    float GetMaxMilliseconds() const;
+    float GetP99Milliseconds() const;
+
+    float GetAverageEntityCount() const;
+    float GetAverageAllocations() const;
+    float GetAverageAllocatedBytes() const;
+
+    // Samples oldest to newest, index 0 is the oldest still in history
+    const SystemFrameSample& GetSample(size_t index) const;
+
+private:
+    std::vector<SystemFrameSample> mSamples; // HISTORY_SIZE once allocated
+    size_t mNext = 0;
+    size_t mCount = 0;
+
+    // Sorting space for GetP99Milliseconds, so a query never allocates
+    mutable std::vector<float> mScratch;
+};
+
+} // namespace ECS
+} // namespace Lite2D
@@ -0,0 +1,211 @@
+#include "EmitterSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace Lite2D {
+namespace ECS {
+
+void EmitterSystem::Update(EntityManager& entityManager, float deltaTime) {
+    if (!mEnabled) return;
+    
+    for (auto& pair : mEmitters) {
+        pair.second.seen = false;
+    }
+    
+    size_t particleCount = 0;
+    auto entities = entityManager.GetFrameEntitiesWith<Position, Emitter>();
+    for (Entity entity : entities) {
+        Emitter* emitter = entityManager.GetComponent<Emitter>(entity);
+        Position* position = entityManager.GetComponent<Position>(entity);
+        
+        EmitterState& state = mEmitters[entity];
+        if (state.particles.GetCapacity() != emitter->maxParticles) {
+            state.particles.SetCapacity(emitter->maxParticles);
+        }
+        if (state.seed != emitter->seed) {
+            state.random.Seed(emitter->seed);
+            state.seed = emitter->seed;
+        }
+        state.seen = true;
+        state.size = emitter->size;
+        state.startColor = emitter->startColor;
+        state.endColor = emitter->endColor;
+        state.layer = emitter->layer;
+        
+        // Age and move first so particles spawned this frame start at the emitter
+        state.particles.Update(deltaTime, emitter->accelerationX, emitter->accelerationY);
+        state.particles.RemoveExpired();
+        
+        size_t spawnCount = 0;
+        if (emitter->emitting && emitter->rate > 0.0f) {
+            state.spawnAccumulator += emitter->rate * deltaTime;
+            spawnCount = static_cast<size_t>(state.spawnAccumulator);
+            state.spawnAccumulator -= static_cast<float>(spawnCount);
+        }
+        if (emitter->burst > 0) {
+            spawnCount += static_cast<size_t>(emitter->burst);
+            emitter->burst = 0;
+        }
+        Emit(state, *emitter, *position, spawnCount);
+        
+        particleCount += state.particles.GetCount();
+    }
+    
+    // Entities that lost their Emitter (or were destroyed) take their particles with them
+    for (auto it = mEmitters.begin(); it != mEmitters.end();) {
+        it = it->second.seen ? std::next(it) : mEmitters.erase(it);
+    }
+    
+    mProcessedEntityCount = particleCount; // Particles are this system's unit of work
+}
+
+void EmitterSystem::Emit(EmitterState& state, const Emitter& emitter, const Position& position, size_t count) {
+    count = std::min(count, state.particles.GetCapacity() - state.particles.GetCount());
+    if (count == 0) return;
+    
+    if (mSpawnScratch.size() < count * 3) {
+        mSpawnScratch.resize(count * 3);
+    }
+    float* angles = mSpawnScratch.data();
+    float* speeds = angles + count;
+    float* lifetimes = speeds + count;
+    state.random.Fill(angles, count, emitter.direction - 0.5f * emitter.spread, emitter.direction + 0.5f * emitter.spread);
+    state.random.Fill(speeds, count, emitter.speedMin, emitter.speedMax);
+    state.random.Fill(lifetimes, count, emitter.lifetimeMin, emitter.lifetimeMax);
+    
+    const float spawnX = position.x + emitter.offsetX;
+    const float spawnY = position.y + emitter.offsetY;
+    for (size_t i = 0; i < count; ++i) {
+        state.particles.Add(spawnX, spawnY, std::cos(angles[i]) * speeds[i], std::sin(angles[i]) * speeds[i], lifetimes[i]);
+    }
+}
+
+void EmitterSystem::Initialize(EntityManager& entityManager) {
+    std::cout << "EmitterSystem initialized" << std::endl;
+}
+
+void EmitterSystem::Shutdown(EntityManager& entityManager) {
+    std::cout << "EmitterSystem shutdown" << std::endl;
+    mEmitters.clear();
+}
+
+void EmitterSystem::HashState(StateHasher& hasher) const {
+    for (const auto& pair : mEmitters) {
+        const EmitterState& state = pair.second;
+        const ParticleBuffer& particles = state.particles;
+        const size_t bytes = particles.GetCount() * sizeof(float);
+        
+        hasher.Add(pair.first);
+        hasher.Add(state.spawnAccumulator);
+        hasher.AddBytes(state.random.GetState(), 4 * sizeof(uint32_t));
+        hasher.AddBytes(particles.GetX(), bytes);
+        hasher.AddBytes(particles.GetY(), bytes);
+        hasher.AddBytes(particles.GetVelocityX(), bytes);
+        hasher.AddBytes(particles.GetVelocityY(), bytes);
+        hasher.AddBytes(particles.GetAge(), bytes);
+        hasher.AddBytes(particles.GetLifetime(), bytes);
+    }
+}
+
+void EmitterSystem::WriteSnapshot(SnapshotWriter& writer) const {
+    writer.Write(static_cast<uint64_t>(mEmitters.size()));
+    for (const auto& pair : mEmitters) {
+        const EmitterState& state = pair.second;
+        const ParticleBuffer& particles = state.particles;
+        const size_t bytes = particles.GetCount() * sizeof(float);
+        
+        writer.Write(pair.first);
+        writer.Write(state.spawnAccumulator);
+        writer.Write(state.seed);
+        writer.WriteBytes(state.random.GetState(), 4 * sizeof(uint32_t));
+        writer.Write(state.size);
+        writer.Write(state.startColor);
+        writer.Write(state.endColor);
+        writer.Write(state.layer);
+        writer.Write(static_cast<uint64_t>(particles.GetCapacity()));
+        writer.Write(static_cast<uint64_t>(particles.GetCount()));
+        writer.WriteBytes(particles.GetX(), bytes);
+        writer.WriteBytes(particles.GetY(), bytes);
+        writer.WriteBytes(particles.GetVelocityX(), bytes);
+        writer.WriteBytes(particles.GetVelocityY(), bytes);
+        writer.WriteBytes(particles.GetAge(), bytes);
+        writer.WriteBytes(particles.GetLifetime(), bytes);
+    }
+}
+
+void EmitterSystem::ReadSnapshot(SnapshotReader& reader) {
+    uint64_t emitterCount = 0;
+    if (!reader.Read(emitterCount) || emitterCount > MAX_ENTITIES) {
+        reader.Fail();
+        return;
+    }
+    
+    // Everything is parsed and checked before any state changes, so a bad
+    // snapshot leaves the current emitters untouched
+    struct SavedEmitter {
+        Entity entity = INVALID_ENTITY;
+        EmitterState fields; // Everything but the particles
+        uint32_t randomState[4];
+        uint64_t capacity = 0;
+        uint64_t count = 0;
+        const uint8_t* arrays = nullptr;
+    };
+    std::vector<SavedEmitter> saved(static_cast<size_t>(emitterCount));
+    for (SavedEmitter& emitter : saved) {
+        reader.Read(emitter.entity);
+        reader.Read(emitter.fields.spawnAccumulator);
+        reader.Read(emitter.fields.seed);
+        reader.ReadBytes(emitter.randomState, sizeof(emitter.randomState));
+        reader.Read(emitter.fields.size);
+        reader.Read(emitter.fields.startColor);
+        reader.Read(emitter.fields.endColor);
+        reader.Read(emitter.fields.layer);
+        reader.Read(emitter.capacity);
+        reader.Read(emitter.count);
+        if (!reader.IsOk() || emitter.capacity > Emitter::MAX_PARTICLES || emitter.count > emitter.capacity) {
+            reader.Fail();
+            return;
+        }
+        emitter.arrays = reader.ReadView(static_cast<size_t>(emitter.count) * 6 * sizeof(float));
+        if (!emitter.arrays) return;
+    }
+    
+    // Buffers of emitters that survive keep their storage
+    std::map<Entity, EmitterState> emitters;
+    for (SavedEmitter& emitter : saved) {
+        EmitterState& state = emitters[emitter.entity];
+        auto existing = mEmitters.find(emitter.entity);
+        if (existing != mEmitters.end()) {
+            state.particles = std::move(existing->second.particles);
+        }
+        state.spawnAccumulator = emitter.fields.spawnAccumulator;
+        state.seed = emitter.fields.seed;
+        state.size = emitter.fields.size;
+        state.startColor = emitter.fields.startColor;
+        state.endColor = emitter.fields.endColor;
+        state.layer = emitter.fields.layer;
+        state.random.SetState(emitter.randomState);
+        if (state.particles.GetCapacity() != emitter.capacity) {
+            state.particles.SetCapacity(static_cast<size_t>(emitter.capacity));
+        }
+        state.particles.Assign(static_cast<size_t>(emitter.count), emitter.arrays);
+    }
+    mEmitters.swap(emitters);
+}
+
+const ParticleBuffer* EmitterSystem::GetParticles(Entity entity) const {
+    auto it = mEmitters.find(entity);
+    return it != mEmitters.end() ? &it->second.particles : nullptr;
+}
+
+size_t EmitterSystem::GetParticleCount() const {
+    size_t count = 0;
+    for (const auto& pair : mEmitters) {
+        count += pair.second.particles.GetCount();
+    }
+    return count;
+}
+
+} // namespace ECS
+} // namespace Lite2D
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "ECS/System.h"
+#include "ECS/EntityManager.h"
+#include "ECS/Components/Position.h"
+#include "ECS/Components/Emitter.h"
+#include "Particles/ParticleBuffer.h"
+#include "Utils/Random.h"
+#include <map>
+#include <vector>
+
+namespace Lite2D {
+namespace ECS {
+
+/**
+ * Emitter System
+ * Spawns, simulates and retires the particles of every entity with Emitter and Position.
+ * Each emitter owns a structure-of-arrays ParticleBuffer; RenderSystem draws each
+ * buffer as one batched geometry command (see RenderSystem::SetEmitterSource).
+ */
+class EmitterSystem : public System {
+public:
+    /**
+     * Runtime state for one emitting entity
+     */
+    struct EmitterState {
+        ParticleBuffer particles;
+        Random random;
+        float spawnAccumulator = 0.0f;
+        uint32_t seed = 0;
+        bool seen = false;
+        
+        // Copied from the component each update for rendering
+        float size = 2.0f;
+        SDL_Color startColor{255, 255, 255, 255};
+        SDL_Color endColor{255, 255, 255, 0};
+        int layer = 0;
+    };
+    
+    EmitterSystem() = default;
+    ~EmitterSystem() = default;
+    
+    // System interface
+    void Update(EntityManager& entityManager, float deltaTime) override;
+    void Initialize(EntityManager& entityManager) override;
+    void Shutdown(EntityManager& entityManager) override;
+    const char* GetName() const override { return "EmitterSystem"; }
+    void HashState(StateHasher& hasher) const override;
+    void WriteSnapshot(SnapshotWriter& writer) const override;
+    void ReadSnapshot(SnapshotReader& reader) override;
+    
+    // Emitters ordered by entity id
+    const std::map<Entity, EmitterState>& GetEmitters() const { return mEmitters; }
+    const ParticleBuffer* GetParticles(Entity entity) const;
+    
+    // Live particles across all emitters
+    size_t GetParticleCount() const;
+
+private:
+    std::map<Entity, EmitterState> mEmitters;
+    
+    // Spawn attributes generated in batches: angle, speed and lifetime runs of one emit
+    std::vector<float> mSpawnScratch;
+    
+    void Emit(EmitterState& state, const Emitter& emitter, const Position& position, size_t count);
+};
+
+} // namespace ECS
+} // namespace Lite2D
@@ -1,5 +1,6 @@
 #include "MovementSystem.h"
 #include <iostream>
+#include <cmath>
 
 namespace Lite2D {
 namespace ECS {
@@ -8,9 +9,10 @@ void MovementSystem::Update(EntityManager& entityManager, float deltaTime) {
     if (!mEnabled) return;
     
     // Get all entities with both Position and Velocity components
-    auto entities = entityManager.GetEntitiesWith<Position, Velocity>();
+    entityManager.GetEntitiesWith<Position, Velocity>(mEntities);
+    mProcessedEntityCount = mEntities.size();
     
-    for (Entity entity : entities) {
+    for (Entity entity : mEntities) {
         Position* position = entityManager.GetComponent<Position>(entity);
         Velocity* velocity = entityManager.GetComponent<Velocity>(entity);
         
@@ -21,7 +23,7 @@ void MovementSystem::Update(EntityManager& entityManager, float deltaTime) {
         position->y += velocity->y * deltaTime;
         
         // Apply speed limiting if configured
-        float speed = sqrt(velocity->x * velocity->x + velocity->y * velocity->y);
+        float speed = std::sqrt(velocity->x * velocity->x + velocity->y * velocity->y);
         if (speed > mMaxSpeed && speed > 0.0f) {
             float scale = mMaxSpeed / speed;
             velocity->x *= scale;
@@ -36,6 +36,9 @@ private:
     bool mClampToBoundaries = false;
     float mMinX = 0.0f, mMinY = 0.0f, mMaxX = 1920.0f, mMaxY = 1080.0f;
     
+    // Query results, kept between frames so steady-state updates don't allocate
+    std::vector<Entity> mEntities;
+    
     void ClampPosition(Position& position);
 };
 
@@ -0,0 +1,86 @@
+#include "World.h"
+
+namespace Lite2D {
+namespace ECS {
+
+World::World(uint32_t seed, size_t frameArenaCapacity)
+    : mEntityManager(frameArenaCapacity), mRandom(seed), mSeed(seed) {
+    mSystemManager.SetRandomSeed(seed);
+}
+
+World::~World() {
+    Shutdown();
+}
+
+void World::Initialize() {
+    if (mInitialized) return;
+    
+    mSystemManager.InitializeAllSystems(mEntityManager);
+    mInitialized = true;
+}
+
+void World::Step(float deltaTime) {
+    mSystemManager.UpdateSystems(mEntityManager, deltaTime);
+    mFrameCount++;
+}
+
+uint64_t World::ComputeStateHash() const {
+    StateHasher hasher(mSeed);
+    hasher.Add(mFrameCount);
+    hasher.AddBytes(mRandom.GetState(), 4 * sizeof(uint32_t));
+    mEntityManager.HashState(hasher);
+    mSystemManager.HashState(hasher);
+    return hasher.GetHash();
+}
+
+// Layout: uint64 frame count, random state, system table, entities, systems
+void World::SaveSnapshot(SnapshotWriter& writer) const {
+    writer.Write(mFrameCount);
+    writer.WriteBytes(mRandom.GetState(), 4 * sizeof(uint32_t));
+    mSystemManager.SaveSystemTable(writer);
+    mEntityManager.SaveSnapshot(writer);
+    mSystemManager.SaveSnapshot(writer);
+}
+
+bool World::LoadSnapshot(SnapshotReader& reader) {
+    uint64_t frameCount = 0;
+    uint32_t randomState[4];
+    if (!reader.Read(frameCount) || !reader.ReadBytes(randomState, sizeof(randomState)) ||
+        !mSystemManager.CheckSystemTable(reader)) {
+        return false;
+    }
+    
+    // The rest can only be checked by loading it, so keep the current state to go back to
+    SnapshotWriter backup;
+    SaveSnapshot(backup);
+    if (LoadState(reader, frameCount, randomState)) {
+        return true;
+    }
+    
+    SnapshotReader restore(backup.GetData(), backup.GetSize());
+    restore.Read(frameCount);
+    restore.ReadBytes(randomState, sizeof(randomState));
+    mSystemManager.CheckSystemTable(restore);
+    LoadState(restore, frameCount, randomState);
+    return false;
+}
+
+bool World::LoadState(SnapshotReader& reader, uint64_t frameCount, const uint32_t* randomState) {
+    if (!mEntityManager.LoadSnapshot(reader) || !mSystemManager.LoadSnapshot(reader)) {
+        return false;
+    }
+    
+    mFrameCount = frameCount;
+    mRandom.SetState(randomState);
+    return true;
+}
+
+void World::Shutdown() {
+    if (!mInitialized) return;
+    
+    mSystemManager.ShutdownAllSystems(mEntityManager);
+    mInitialized = false;
+}
+
+} // namespace ECS
+} // namespace Lite2D
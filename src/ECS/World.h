@@ -0,0 +1,74 @@
+#pragma once
+
+#include "EntityManager.h"
+#include "SystemManager.h"
+#include <cstdint>
+#include <memory>
+#include "Utils/Random.h"
+
+namespace Lite2D {
+namespace ECS {
+
+/**
+ * World
+ * One isolated simulation: its own entities, systems and random stream. Worlds
+ * share nothing, so a WorldScheduler can step many of them on different threads.
+ * Storage grows with use; an empty world costs a few KB.
+ */
+class World {
+public:
+    // Frame arena is sized for a small world and grows if a frame needs more
+    static constexpr size_t DEFAULT_FRAME_ARENA_CAPACITY = 4 * 1024;
+    
+    explicit World(uint32_t seed = 0, size_t frameArenaCapacity = DEFAULT_FRAME_ARENA_CAPACITY);
+    ~World();
+    
+    // Delete copy constructor and assignment operator
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+    
+    // Registers a system with this world's SystemManager
+    template<typename T, typename... Args>
+    std::shared_ptr<T> AddSystem(Args&&... args) {
+        return mSystemManager.RegisterSystem<T>(std::forward<Args>(args)...);
+    }
+    
+    // Lifecycle: Initialize once systems are added, Step once per tick
+    void Initialize();
+    void Step(float deltaTime);
+    void Shutdown();
+    
+    EntityManager& GetEntityManager() { return mEntityManager; }
+    SystemManager& GetSystemManager() { return mSystemManager; }
+    
+    // Per-world random stream, seeded at construction; each system gets its own stream from the same seed
+    Random& GetRandom() { return mRandom; }
+    uint32_t GetSeed() const { return mSeed; }
+    
+    uint64_t GetFrameCount() const { return mFrameCount; }
+    
+    // Hash of all simulation state (component pools, systems, random streams, frame count).
+    // Equal hashes on the same frame mean two runs have not diverged.
+    uint64_t ComputeStateHash() const;
+    
+    // Whole-world snapshot: frame count, random stream, entities and systems. Loading
+    // needs the same systems registered and every component type in the snapshot known.
+    // A load applies all of it or nothing: a different system set is refused before
+    // the world is touched, and a failure further in (corrupt pool or system data)
+    // puts back the state the world had before the call.
+    void SaveSnapshot(SnapshotWriter& writer) const;
+    bool LoadSnapshot(SnapshotReader& reader);
+
+private:
+    EntityManager mEntityManager;
+    SystemManager mSystemManager;
+    Random mRandom;
+    uint32_t mSeed;
+    uint64_t mFrameCount = 0;
+    bool mInitialized = false;
+    
+    bool LoadState(SnapshotReader& reader, uint64_t frameCount, const uint32_t* randomState);
+};
+
+} // namespace ECS
+} // namespace Lite2D
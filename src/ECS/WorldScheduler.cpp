@@ -0,0 +1,52 @@
+#include "WorldScheduler.h"
+#include "Utils/Trace.h"
+#include <algorithm>
+
+namespace Lite2D {
+namespace ECS {
+
+WorldScheduler::WorldScheduler(ThreadPool& threadPool)
+    : mThreadPool(threadPool) {
+}
+
+World& WorldScheduler::CreateWorld(uint32_t seed, size_t frameArenaCapacity) {
+    mWorlds.push_back(std::make_unique<World>(seed, frameArenaCapacity));
+    return *mWorlds.back();
+}
+
+void WorldScheduler::DestroyWorld(World& world) {
+    auto it = std::find_if(mWorlds.begin(), mWorlds.end(),
+        [&world](const std::unique_ptr<World>& entry) { return entry.get() == &world; });
+    if (it != mWorlds.end()) {
+        mWorlds.erase(it);
+    }
+}
+
+void WorldScheduler::InitializeAll() {
+    mThreadPool.ParallelFor(mWorlds.size(), [this](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i) {
+            mWorlds[i]->Initialize();
+        }
+    });
+}
+
+void WorldScheduler::StepAll(float deltaTime) {
+    StepAll(deltaTime, 1);
+}
+
+void WorldScheduler::StepAll(float deltaTime, int stepCount) {
+    LITE2D_TRACE_SCOPE("WorldScheduler::StepAll");
+    
+    // Worlds are independent, so each one runs all its steps back to back while
+    // its data is hot, with no barrier between steps
+    mThreadPool.ParallelFor(mWorlds.size(), [this, deltaTime, stepCount](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i) {
+            for (int step = 0; step < stepCount; ++step) {
+                mWorlds[i]->Step(deltaTime);
+            }
+        }
+    });
+}
+
+} // namespace ECS
+} // namespace Lite2D
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "World.h"
+#include "Utils/ThreadPool.h"
+#include <memory>
+#include <vector>
+
+namespace Lite2D {
+namespace ECS {
+
+/**
+ * World Scheduler
+ * Owns a set of independent worlds and steps them concurrently on a shared
+ * ThreadPool, one contiguous batch of worlds per thread. Systems never see
+ * another world's data, so no locking is needed inside a step.
+ */
+class WorldScheduler {
+public:
+    // The pool is borrowed and may be shared with other users (e.g. RenderSystem)
+    explicit WorldScheduler(ThreadPool& threadPool);
+    ~WorldScheduler() = default;
+    
+    // Delete copy constructor and assignment operator
+    WorldScheduler(const WorldScheduler&) = delete;
+    WorldScheduler& operator=(const WorldScheduler&) = delete;
+    
+    // World lifecycle
+    World& CreateWorld(uint32_t seed, size_t frameArenaCapacity = World::DEFAULT_FRAME_ARENA_CAPACITY);
+    void DestroyWorld(World& world);
+    void Clear() { mWorlds.clear(); }
+    
+    size_t GetWorldCount() const { return mWorlds.size(); }
+    World& GetWorld(size_t index) { return *mWorlds[index]; }
+    
+    // Initializes every world's systems (in parallel)
+    void InitializeAll();
+    
+    // Steps every world once by deltaTime; returns when all have finished
+    void StepAll(float deltaTime);
+    
+    // Steps every world stepCount times
+    void StepAll(float deltaTime, int stepCount);
+
+private:
+    ThreadPool& mThreadPool;
+    std::vector<std::unique_ptr<World>> mWorlds;
+};
+
+} // namespace ECS
+} // namespace Lite2D
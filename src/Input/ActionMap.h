@@ -0,0 +1,72 @@
+#pragma once
+
+#include "InputManager.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Action Map
+ * Binds game actions (small integer ids, typically an enum) to any number of
+ * scancodes and mouse buttons on top of an InputManager. Each action keeps a
+ * key mask the size of the scancode table plus a mouse button mask, so a query
+ * is a mask-and-any over InputManager's state bits: no hashing, no allocation,
+ * and the cost doesn't grow with the number of bindings.
+ */
+class ActionMap
+{
+public:
+    static constexpr size_t MAX_ACTIONS = 64;
+
+    explicit ActionMap(const InputManager& input) : mInput(input) {}
+
+    // False (nothing bound) if the action or key is out of range
+    bool BindKey(size_t action, SDL_Scancode sc) {
+        if (action >= MAX_ACTIONS || static_cast<size_t>(sc) >= InputManager::KEY_COUNT) return false;
+        mBindings[action].keys.set(sc);
+        return true;
+    }
+
+    bool BindMouseButton(size_t action, Uint8 button) {
+        uint32_t bit = InputManager::GetMouseButtonBit(button);
+        if (action >= MAX_ACTIONS || bit == 0) return false;
+        mBindings[action].mouseButtons |= bit;
+        return true;
+    }
+
+    void Unbind(size_t action) {
+        if (action < MAX_ACTIONS) mBindings[action] = Binding();
+    }
+
+    void Clear() { mBindings.fill(Binding()); }
+
+    // Went down this frame through any binding
+    bool IsPressed(size_t action) const {
+        return Test(action, mInput.GetKeysPressed(), mInput.GetMouseButtonsPressed());
+    }
+
+    // Down through any binding
+    bool IsHeld(size_t action) const {
+        return Test(action, mInput.GetKeysDown(), mInput.GetMouseButtonsDown());
+    }
+
+    // Went up this frame through any binding
+    bool IsReleased(size_t action) const {
+        return Test(action, mInput.GetKeysReleased(), mInput.GetMouseButtonsReleased());
+    }
+
+private:
+    struct Binding {
+        InputManager::KeyBits keys;
+        uint32_t mouseButtons = 0;
+    };
+
+    const InputManager& mInput;
+    std::array<Binding, MAX_ACTIONS> mBindings{};
+
+    bool Test(size_t action, const InputManager::KeyBits& keys, uint32_t mouseButtons) const {
+        if (action >= MAX_ACTIONS) return false;
+        const Binding& binding = mBindings[action];
+        return (binding.mouseButtons & mouseButtons) != 0 || (binding.keys & keys).any();
+    }
+};
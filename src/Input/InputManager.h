@@ -1,8 +1,9 @@
 #pragma once
 
-#include <SDL3/SDL.h>   
-#include <unordered_map>
-#include <string>
+#include <SDL3/SDL.h>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
 
 enum KeyState
 {
@@ -12,194 +13,149 @@ enum KeyState
     Released
 };
 
+/**
+ * Input Manager
+ * Key and mouse button state in flat tables indexed by scancode / button
+ * number: one bitset for what is down and two per-frame edge bitsets for what
+ * went down or up since the last Update(). Update() just clears the edges, and
+ * every query is a bit test - no hashing and no allocation. Scancode queries
+ * are the fast path; the SDL_Keycode overloads translate through the keyboard
+ * layout on each call. ActionMap (ActionMap.h) maps game actions onto these.
+ */
 class InputManager
 {
 public:
+    static constexpr size_t KEY_COUNT = SDL_SCANCODE_COUNT;
+    static constexpr size_t MOUSE_BUTTON_COUNT = 32;
+
+    using KeyBits = std::bitset<KEY_COUNT>;
+
     InputManager() {}
     ~InputManager() {}
 
-    void FeedEvent(SDL_Event event) {
-        SDL_Keycode kc = event.key.key;
-
+    void FeedEvent(const SDL_Event& event) {
         if (event.type == SDL_EVENT_KEY_DOWN)
         {
             // Ignore repeat events. Only process first key down.
-            if (event.key.repeat == 0)
+            size_t sc = GetEventScancode(event);
+            if (event.key.repeat == 0 && sc < KEY_COUNT && !mKeysDown[sc])
             {
-                auto it = mKeysStateMap.find(kc);
-                if (it == mKeysStateMap.end() || it->second == KeyState::None)
-                {
-                    mKeysStateMap[kc] = KeyState::Pressed;
-                }
+                mKeysDown.set(sc);
+                mKeysPressed.set(sc);
             }
-
         }
         else if (event.type == SDL_EVENT_KEY_UP)
         {
-            auto it = mKeysStateMap.find(kc);
-
-            if (it == mKeysStateMap.end())
+            // An up without a down (key held while the window gained focus,
+            // or when a recording started) is ignored
+            size_t sc = GetEventScancode(event);
+            if (sc < KEY_COUNT && mKeysDown[sc])
             {
-                // This is an anamoly
-                SDL_Log("Error: Key UP detected but no DOWN");
-            }
-
-            if (it->second == KeyState::Pressed || it->second == KeyState::Held)
-            {
-                mKeysStateMap[kc] = KeyState::Released;
+                mKeysDown.reset(sc);
+                mKeysReleased.set(sc);
             }
         }
-
         else if (event.type == SDL_EVENT_MOUSE_BUTTON_DOWN)
         {
-            Uint8 button = event.button.button;
-            if (event.button.down)
+            mMouseXPosition = event.button.x;
+            mMouseYPosition = event.button.y;
+
+            uint32_t bit = GetMouseButtonBit(event.button.button);
+            if (event.button.down && !(mMouseDown & bit))
             {
-                auto it = mMouseButtonStateMap.find(button);
-                if (it == mMouseButtonStateMap.end() || it->second == KeyState::None)
-                {
-                    mMouseButtonStateMap[button] = KeyState::Pressed;
-                }
+                mMouseDown |= bit;
+                mMousePressed |= bit;
             }
         }
         else if (event.type == SDL_EVENT_MOUSE_BUTTON_UP)
         {
-            Uint8 button = event.button.button;
-            auto it = mMouseButtonStateMap.find(button);
-
-            if (it == mMouseButtonStateMap.end())
-            {
-                SDL_Log("Error: Mouse UP detected but no DOWN");
-            }
+            mMouseXPosition = event.button.x;
+            mMouseYPosition = event.button.y;
 
-            if (it->second == KeyState::Pressed || it->second == KeyState::Held)
+            uint32_t bit = GetMouseButtonBit(event.button.button);
+            if (mMouseDown & bit)
             {
-                mMouseButtonStateMap[button] = KeyState::Released;
+                mMouseDown &= ~bit;
+                mMouseReleased |= bit;
             }
         }
+        else if (event.type == SDL_EVENT_MOUSE_MOTION)
+        {
+            mMouseXPosition = event.motion.x;
+            mMouseYPosition = event.motion.y;
+        }
     }
 
     // Call this once per frame after processing all events
     void Update() {
-        for (auto it = mKeysStateMap.begin(); it != mKeysStateMap.end(); ) {
-            switch (it->second) {
-                case KeyState::Pressed:
-                    // After being pressed this frame, move to Held
-                    it->second = KeyState::Held;
-                    ++it;
-                    break;
-
-                case KeyState::Released:
-                    // After released, reset to None or remove from map
-                    // Here we remove the key to keep map clean
-                    it = mKeysStateMap.erase(it);
-                    break;
-
-                default:
-                    // Held or None, just keep as is
-                    ++it;
-                    break;
-            }
-        }
-
-        for (auto it = mMouseButtonStateMap.begin(); it != mMouseButtonStateMap.end(); ) {
-            switch (it->second) {
-                case KeyState::Pressed:
-                    // After being pressed this frame, move to Held
-                    it->second = KeyState::Held;
-                    ++it;
-                    break;
-
-                case KeyState::Released:
-                    // After released, reset to None or remove from map
-                    // Here we remove the key to keep map clean
-                    it = mMouseButtonStateMap.erase(it);
-                    break;
-
-                default:
-                    // Held or None, just keep as is
-                    ++it;
-                    break;
-            }
-        }
-
-
-        SDL_MouseButtonFlags mouseButtonFlags {};
-
-        float currX;
-        float currY;
-        mouseButtonFlags = SDL_GetMouseState(&currX, &currY);
-
-        mMouseDeltaX = currX - mMouseXPosition;
-        mMouseDeltaY = currY - mMouseYPosition;
-
-        mMouseXPosition = currX;
-        mMouseYPosition = currY;
-    
+        // Edges last one frame; what is down stays down
+        mKeysPressed.reset();
+        mKeysReleased.reset();
+        mMousePressed = 0;
+        mMouseReleased = 0;
+
+        // Position comes from the fed events rather than SDL_GetMouseState, so
+        // recorded input (InputPlayer) drives the mouse exactly like live input
+        mMouseDeltaX = mMouseXPosition - mLastMouseXPosition;
+        mMouseDeltaY = mMouseYPosition - mLastMouseYPosition;
+
+        mLastMouseXPosition = mMouseXPosition;
+        mLastMouseYPosition = mMouseYPosition;
     }
 
-    // Query functions
-    bool IsKeyPressed(SDL_Keycode sc) const {
-        auto it = mKeysStateMap.find(sc);
-        return it != mKeysStateMap.end() && it->second == KeyState::Pressed;
-    }
-
-    bool IsKeyHeld(SDL_Keycode sc) const {
-        auto it = mKeysStateMap.find(sc);
-        return it != mKeysStateMap.end() && (it->second == KeyState::Held || it->second == KeyState::Pressed);
-    }
+    // Query functions. A key tapped within one frame reports both Pressed and Released.
+    bool IsKeyPressed(SDL_Scancode sc) const { return TestKey(mKeysPressed, sc); }
+    bool IsKeyHeld(SDL_Scancode sc) const { return TestKey(mKeysDown, sc); }
+    bool IsKeyReleased(SDL_Scancode sc) const { return TestKey(mKeysReleased, sc); }
 
-    bool IsKeyReleased(SDL_Keycode sc) const {
-        auto it = mKeysStateMap.find(sc);
-        return it != mKeysStateMap.end() && it->second == KeyState::Released;
-    }
+    bool IsKeyPressed(SDL_Keycode key) const { return IsKeyPressed(ToScancode(key)); }
+    bool IsKeyHeld(SDL_Keycode key) const { return IsKeyHeld(ToScancode(key)); }
+    bool IsKeyReleased(SDL_Keycode key) const { return IsKeyReleased(ToScancode(key)); }
 
-    void GetKeyState(SDL_Keycode sc, KeyState keystate)
-    {
-        auto it = mKeysStateMap.find(sc);
-        if (it == mKeysStateMap.end())
-        {
-            keystate = KeyState::None;
-        }
-        keystate = it->second;
+    KeyState GetKeyState(SDL_Scancode sc) const {
+        if (IsKeyPressed(sc)) return KeyState::Pressed;
+        if (IsKeyHeld(sc)) return KeyState::Held;
+        if (IsKeyReleased(sc)) return KeyState::Released;
+        return KeyState::None;
     }
 
+    // Whole tables, for testing many keys at once (ActionMap)
+    const KeyBits& GetKeysDown() const { return mKeysDown; }
+    const KeyBits& GetKeysPressed() const { return mKeysPressed; }
+    const KeyBits& GetKeysReleased() const { return mKeysReleased; }
+    uint32_t GetMouseButtonsDown() const { return mMouseDown; }
+    uint32_t GetMouseButtonsPressed() const { return mMousePressed; }
+    uint32_t GetMouseButtonsReleased() const { return mMouseReleased; }
 
-
-    void GetMousePosition(int& x, int& y)
+    void GetMousePosition(int& x, int& y) const
     {
         x = mMouseXPosition;
         y = mMouseYPosition;
     }
 
-    void GetMouseDelta(int& dx, int& dy)
+    void GetMouseDelta(int& dx, int& dy) const
     {
         dx = mMouseDeltaX;
         dy = mMouseDeltaY;
     }
 
-    bool IsMouseButtonPressed(Uint8 button)
-    {
-        auto it = mMouseButtonStateMap.find(button);
-        return it != mMouseButtonStateMap.end() && it->second == KeyState::Pressed;
-    }
-
-    bool IsMouseButtonHeld(Uint8 button) {
-        auto it = mMouseButtonStateMap.find(button);
-        return it != mMouseButtonStateMap.end() && it->second == KeyState::Held;
-    }
-
-    bool IsMouseButtonReleased(Uint8 button) {
-        auto it = mMouseButtonStateMap.find(button);
-        return it != mMouseButtonStateMap.end() && it->second == KeyState::Released;
-    }
+    bool IsMouseButtonPressed(Uint8 button) const { return (mMousePressed & GetMouseButtonBit(button)) != 0; }
+    bool IsMouseButtonHeld(Uint8 button) const { return (mMouseDown & GetMouseButtonBit(button)) != 0; }
+    bool IsMouseButtonReleased(Uint8 button) const { return (mMouseReleased & GetMouseButtonBit(button)) != 0; }
 
-    bool IsMouseInRect(int x, int y, int w, int h) {
+    bool IsMouseInRect(int x, int y, int w, int h) const {
         return (mMouseXPosition >= x) && (mMouseXPosition <= x + w) &&
                (mMouseYPosition >= y) && (mMouseYPosition <= y + h);
 
     }
 
+    // Bit for an SDL button number (SDL_BUTTON_LEFT is 1); 0 if out of range
+    static uint32_t GetMouseButtonBit(Uint8 button) {
+        return button < MOUSE_BUTTON_COUNT ? (1u << button) : 0u;
+    }
+
+    static SDL_Scancode ToScancode(SDL_Keycode key) { return SDL_GetScancodeFromKey(key, nullptr); }
+
 
     InputManager(const InputManager&) = delete;
     InputManager operator=(const InputManager&) = delete;
@@ -207,13 +163,33 @@ public:
 
 private:
 
-    std::unordered_map<SDL_Keycode, KeyState> mKeysStateMap;
+    KeyBits mKeysDown;
+    KeyBits mKeysPressed;
+    KeyBits mKeysReleased;
+
+    uint32_t mMouseDown = 0;
+    uint32_t mMousePressed = 0;
+    uint32_t mMouseReleased = 0;
 
-    std::unordered_map<Uint8, KeyState> mMouseButtonStateMap;
+    float mMouseXPosition = 0.0f;
+    float mMouseYPosition = 0.0f;
+    float mLastMouseXPosition = 0.0f;
+    float mLastMouseYPosition = 0.0f;
+    float mMouseDeltaX = 0.0f;
+    float mMouseDeltaY = 0.0f;
 
-    float mMouseXPosition;
-    float mMouseYPosition;
-    float mMouseDeltaX;
-    float mMouseDeltaY;
+    static bool TestKey(const KeyBits& bits, SDL_Scancode sc) {
+        return static_cast<size_t>(sc) < KEY_COUNT && bits[sc];
+    }
+
+    // Synthetic events may carry only the keycode; unknown keys map past the table
+    static size_t GetEventScancode(const SDL_Event& event) {
+        SDL_Scancode sc = event.key.scancode;
+        if (sc == SDL_SCANCODE_UNKNOWN)
+        {
+            sc = ToScancode(event.key.key);
+        }
+        return sc == SDL_SCANCODE_UNKNOWN ? KEY_COUNT : static_cast<size_t>(sc);
+    }
 
-};
\ No newline at end of file
+};
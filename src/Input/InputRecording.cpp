@@ -0,0 +1,242 @@
+#include "InputRecording.h"
+#include "Utils/MappedFile.h"
+#include <cstring>
+#include <iostream>
+
+using Lite2D::ECS::SnapshotReader;
+
+namespace {
+
+// One byte per event in the file instead of the 32-bit SDL event type
+enum class RecordedEvent : uint8_t {
+    Quit,
+    KeyDown,
+    KeyUp,
+    MouseButtonDown,
+    MouseButtonUp,
+    MouseMotion,
+    WindowResized
+};
+
+bool ReadEvent(SnapshotReader& reader, SDL_Event& event) {
+    std::memset(&event, 0, sizeof(event));
+
+    uint8_t kind = 0;
+    reader.Read(kind);
+    switch (static_cast<RecordedEvent>(kind)) {
+        case RecordedEvent::Quit:
+            event.type = SDL_EVENT_QUIT;
+            break;
+
+        case RecordedEvent::KeyDown:
+        case RecordedEvent::KeyUp: {
+            uint16_t scancode = 0;
+            uint8_t repeat = 0;
+            event.type = kind == static_cast<uint8_t>(RecordedEvent::KeyDown) ? SDL_EVENT_KEY_DOWN : SDL_EVENT_KEY_UP;
+            reader.Read(scancode);
+            reader.Read(event.key.key);
+            reader.Read(event.key.mod);
+            reader.Read(repeat);
+            event.key.scancode = static_cast<SDL_Scancode>(scancode);
+            event.key.down = event.type == SDL_EVENT_KEY_DOWN;
+            event.key.repeat = repeat != 0;
+            break;
+        }
+
+        case RecordedEvent::MouseButtonDown:
+        case RecordedEvent::MouseButtonUp:
+            event.type = kind == static_cast<uint8_t>(RecordedEvent::MouseButtonDown)
+                ? SDL_EVENT_MOUSE_BUTTON_DOWN : SDL_EVENT_MOUSE_BUTTON_UP;
+            reader.Read(event.button.button);
+            reader.Read(event.button.clicks);
+            reader.Read(event.button.x);
+            reader.Read(event.button.y);
+            event.button.down = event.type == SDL_EVENT_MOUSE_BUTTON_DOWN;
+            break;
+
+        case RecordedEvent::MouseMotion:
+            event.type = SDL_EVENT_MOUSE_MOTION;
+            reader.Read(event.motion.state);
+            reader.Read(event.motion.x);
+            reader.Read(event.motion.y);
+            reader.Read(event.motion.xrel);
+            reader.Read(event.motion.yrel);
+            break;
+
+        case RecordedEvent::WindowResized:
+            event.type = SDL_EVENT_WINDOW_RESIZED;
+            reader.Read(event.window.data1);
+            reader.Read(event.window.data2);
+            break;
+
+        default:
+            reader.Fail();
+            break;
+    }
+    return reader.IsOk();
+}
+
+} // namespace
+
+bool InputRecorder::IsRecorded(const SDL_Event& event) {
+    switch (event.type) {
+        case SDL_EVENT_QUIT:
+        case SDL_EVENT_KEY_DOWN:
+        case SDL_EVENT_KEY_UP:
+        case SDL_EVENT_MOUSE_BUTTON_DOWN:
+        case SDL_EVENT_MOUSE_BUTTON_UP:
+        case SDL_EVENT_MOUSE_MOTION:
+        case SDL_EVENT_WINDOW_RESIZED:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void InputRecorder::Begin(uint64_t seed, int viewWidth, int viewHeight) {
+    mWriter.Clear();
+    mWriter.Write(INPUT_RECORDING_MAGIC);
+    mWriter.Write(INPUT_RECORDING_VERSION);
+    mWriter.Write(seed);
+    mWriter.Write(static_cast<int32_t>(viewWidth));
+    mWriter.Write(static_cast<int32_t>(viewHeight));
+    mFrameCount = 0;
+    mRecording = true;
+}
+
+void InputRecorder::RecordFrame(float deltaTime, const SDL_Event* events, size_t count) {
+    if (!mRecording) return;
+
+    uint32_t recorded = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (IsRecorded(events[i])) ++recorded;
+    }
+
+    mWriter.Write(deltaTime);
+    mWriter.Write(recorded);
+
+    for (size_t i = 0; i < count; ++i) {
+        const SDL_Event& event = events[i];
+        switch (event.type) {
+            case SDL_EVENT_QUIT:
+                mWriter.Write(RecordedEvent::Quit);
+                break;
+
+            case SDL_EVENT_KEY_DOWN:
+            case SDL_EVENT_KEY_UP:
+                mWriter.Write(event.type == SDL_EVENT_KEY_DOWN ? RecordedEvent::KeyDown : RecordedEvent::KeyUp);
+                mWriter.Write(static_cast<uint16_t>(event.key.scancode));
+                mWriter.Write(event.key.key);
+                mWriter.Write(event.key.mod);
+                mWriter.Write(static_cast<uint8_t>(event.key.repeat ? 1 : 0));
+                break;
+
+            case SDL_EVENT_MOUSE_BUTTON_DOWN:
+            case SDL_EVENT_MOUSE_BUTTON_UP:
+                mWriter.Write(event.type == SDL_EVENT_MOUSE_BUTTON_DOWN
+                    ? RecordedEvent::MouseButtonDown : RecordedEvent::MouseButtonUp);
+                mWriter.Write(event.button.button);
+                mWriter.Write(event.button.clicks);
+                mWriter.Write(event.button.x);
+                mWriter.Write(event.button.y);
+                break;
+
+            case SDL_EVENT_MOUSE_MOTION:
+                mWriter.Write(RecordedEvent::MouseMotion);
+                mWriter.Write(event.motion.state);
+                mWriter.Write(event.motion.x);
+                mWriter.Write(event.motion.y);
+                mWriter.Write(event.motion.xrel);
+                mWriter.Write(event.motion.yrel);
+                break;
+
+            case SDL_EVENT_WINDOW_RESIZED:
+                mWriter.Write(RecordedEvent::WindowResized);
+                mWriter.Write(event.window.data1);
+                mWriter.Write(event.window.data2);
+                break;
+        }
+    }
+
+    ++mFrameCount;
+}
+
+bool InputRecorder::SaveToFile(const std::string& path) const {
+    return mWriter.SaveToFile(path);
+}
+
+void InputPlayer::Clear() {
+    mFrames.clear();
+    mEvents.clear();
+    mNextFrame = 0;
+    mSeed = 0;
+    mViewWidth = 0;
+    mViewHeight = 0;
+    mLoaded = false;
+}
+
+bool InputPlayer::Load(const uint8_t* data, size_t size) {
+    Clear();
+
+    SnapshotReader reader(data, size);
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    int32_t viewWidth = 0;
+    int32_t viewHeight = 0;
+    reader.Read(magic);
+    reader.Read(version);
+    if (!reader.IsOk() || magic != INPUT_RECORDING_MAGIC || version != INPUT_RECORDING_VERSION) {
+        std::cerr << "Not an input recording (or an unsupported version)" << std::endl;
+        return false;
+    }
+    reader.Read(mSeed);
+    reader.Read(viewWidth);
+    reader.Read(viewHeight);
+
+    while (reader.IsOk() && reader.GetRemaining() > 0) {
+        Frame frame;
+        reader.Read(frame.deltaTime);
+        reader.Read(frame.eventCount);
+        // Every event takes at least one byte, which bounds the count before resizing
+        if (!reader.IsOk() || frame.eventCount > reader.GetRemaining()) {
+            reader.Fail();
+            break;
+        }
+
+        frame.firstEvent = static_cast<uint32_t>(mEvents.size());
+        mEvents.resize(mEvents.size() + frame.eventCount);
+        for (uint32_t i = 0; i < frame.eventCount; ++i) {
+            if (!ReadEvent(reader, mEvents[frame.firstEvent + i])) break;
+        }
+        mFrames.push_back(frame);
+    }
+
+    if (!reader.IsOk()) {
+        std::cerr << "Input recording is damaged at byte " << reader.GetOffset() << std::endl;
+        Clear();
+        return false;
+    }
+
+    mViewWidth = viewWidth;
+    mViewHeight = viewHeight;
+    mLoaded = true;
+    return true;
+}
+
+bool InputPlayer::LoadFromFile(const std::string& path) {
+    Lite2D::MappedFile file;
+    if (!file.Open(path)) {
+        return false;
+    }
+    return Load(file.GetData(), file.GetSize());
+}
+
+bool InputPlayer::NextFrame(float& deltaTime, const SDL_Event*& events, size_t& count) {
+    if (IsFinished()) return false;
+
+    const Frame& frame = mFrames[mNextFrame++];
+    deltaTime = frame.deltaTime;
+    events = frame.eventCount > 0 ? &mEvents[frame.firstEvent] : nullptr;
+    count = frame.eventCount;
+    return true;
+}
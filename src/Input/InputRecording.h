@@ -0,0 +1,92 @@
+#pragma once
+
+#include "ECS/Snapshot.h"
+#include <SDL3/SDL.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// "L2DI" in the first four bytes
+constexpr uint32_t INPUT_RECORDING_MAGIC = 0x4944324C;
+constexpr uint32_t INPUT_RECORDING_VERSION = 1;
+
+/**
+ * Input Recorder
+ * Captures the per-frame SDL event stream and timestep in a compact binary
+ * form: a header with the run's seed and view size, then per frame the delta
+ * time, an event count and only the fields the engine reads from each event
+ * (keys, mouse buttons and motion, resize, quit). Other event types are dropped.
+ * Replaying with InputPlayer through the same input path reproduces the run
+ * exactly, as long as the game is seeded and sized from the header.
+ */
+class InputRecorder {
+public:
+    InputRecorder() = default;
+
+    // Starts a new recording, discarding any previous one
+    void Begin(uint64_t seed, int viewWidth, int viewHeight);
+    void Stop() { mRecording = false; }
+
+    // Appends one frame; ignored unless recording
+    void RecordFrame(float deltaTime, const SDL_Event* events, size_t count);
+
+    bool IsRecording() const { return mRecording; }
+    size_t GetFrameCount() const { return mFrameCount; }
+    size_t GetSize() const { return mWriter.GetSize(); }
+    const uint8_t* GetData() const { return mWriter.GetData(); }
+
+    bool SaveToFile(const std::string& path) const;
+
+    // Whether an event of this type is kept
+    static bool IsRecorded(const SDL_Event& event);
+
+private:
+    Lite2D::ECS::SnapshotWriter mWriter;
+    size_t mFrameCount = 0;
+    bool mRecording = false;
+};
+
+/**
+ * Input Player
+ * Loads a recording made by InputRecorder and hands it back frame by frame.
+ * The whole file is decoded up front into rebuilt SDL_Events, so playback adds
+ * nothing to the frame time being measured. Feed each frame's events through the
+ * same code that handles live events (InputManager::FeedEvent, game handlers).
+ */
+class InputPlayer {
+public:
+    InputPlayer() = default;
+
+    bool Load(const uint8_t* data, size_t size);
+    bool LoadFromFile(const std::string& path);
+    void Clear();
+
+    bool IsLoaded() const { return mLoaded; }
+    uint64_t GetSeed() const { return mSeed; }
+    int GetViewWidth() const { return mViewWidth; }
+    int GetViewHeight() const { return mViewHeight; }
+
+    size_t GetFrameCount() const { return mFrames.size(); }
+    size_t GetEventCount() const { return mEvents.size(); }
+
+    // Next recorded frame; false once every frame has been played
+    bool NextFrame(float& deltaTime, const SDL_Event*& events, size_t& count);
+    bool IsFinished() const { return mNextFrame >= mFrames.size(); }
+    void Restart() { mNextFrame = 0; }
+
+private:
+    struct Frame {
+        float deltaTime;
+        uint32_t firstEvent;
+        uint32_t eventCount;
+    };
+
+    std::vector<Frame> mFrames;
+    std::vector<SDL_Event> mEvents;
+    size_t mNextFrame = 0;
+    uint64_t mSeed = 0;
+    int mViewWidth = 0;
+    int mViewHeight = 0;
+    bool mLoaded = false;
+};
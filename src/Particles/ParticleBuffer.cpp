@@ -0,0 +1,110 @@
+#include "ParticleBuffer.h"
+#include "Rendering/VertexBuffer.h"
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+
+namespace Lite2D {
+
+void ParticleBuffer::SetCapacity(size_t capacity) {
+    mX.resize(capacity);
+    mY.resize(capacity);
+    mVelocityX.resize(capacity);
+    mVelocityY.resize(capacity);
+    mAge.resize(capacity);
+    mLifetime.resize(capacity);
+    mCapacity = capacity;
+    mCount = std::min(mCount, capacity);
+}
+
+bool ParticleBuffer::Assign(size_t count, const void* packedArrays) {
+    if (count > mCapacity) return false;
+    mCount = count;
+    if (count == 0) return true;
+
+    const size_t bytes = count * sizeof(float);
+    const char* source = static_cast<const char*>(packedArrays);
+    for (std::vector<float>* attribute : { &mX, &mY, &mVelocityX, &mVelocityY, &mAge, &mLifetime }) {
+        std::memcpy(attribute->data(), source, bytes);
+        source += bytes;
+    }
+    return true;
+}
+
+bool ParticleBuffer::Add(float x, float y, float velocityX, float velocityY, float lifetime) {
+    if (mCount == mCapacity) return false;
+
+    const size_t i = mCount++;
+    mX[i] = x;
+    mY[i] = y;
+    mVelocityX[i] = velocityX;
+    mVelocityY[i] = velocityY;
+    mAge[i] = 0.0f;
+    mLifetime[i] = lifetime;
+    return true;
+}
+
+void ParticleBuffer::Update(float deltaTime, float accelerationX, float accelerationY) {
+    const size_t count = mCount;
+    float* __restrict x = mX.data();
+    float* __restrict y = mY.data();
+    float* __restrict velocityX = mVelocityX.data();
+    float* __restrict velocityY = mVelocityY.data();
+    float* __restrict age = mAge.data();
+
+    const float deltaVelocityX = accelerationX * deltaTime;
+    const float deltaVelocityY = accelerationY * deltaTime;
+
+    // Branch-free, one array per stream: vectorizes at -O2/-O3
+    for (size_t i = 0; i < count; ++i) {
+        velocityX[i] += deltaVelocityX;
+        velocityY[i] += deltaVelocityY;
+        x[i] += velocityX[i] * deltaTime;
+        y[i] += velocityY[i] * deltaTime;
+        age[i] += deltaTime;
+    }
+}
+
+size_t ParticleBuffer::RemoveExpired() {
+    size_t write = 0;
+    for (size_t read = 0; read < mCount; ++read) {
+        if (mAge[read] >= mLifetime[read]) continue;
+
+        if (write != read) {
+            mX[write] = mX[read];
+            mY[write] = mY[read];
+            mVelocityX[write] = mVelocityX[read];
+            mVelocityY[write] = mVelocityY[read];
+            mAge[write] = mAge[read];
+            mLifetime[write] = mLifetime[read];
+        }
+        write++;
+    }
+
+    const size_t removed = mCount - write;
+    mCount = write;
+    return removed;
+}
+
+void ParticleBuffer::AppendQuads(VertexBuffer& geometry, float offsetX, float offsetY, float size,
+                                 SDL_Color startColor, SDL_Color endColor) const {
+    const float half = size * 0.5f;
+    const float deltaR = static_cast<float>(endColor.r) - startColor.r;
+    const float deltaG = static_cast<float>(endColor.g) - startColor.g;
+    const float deltaB = static_cast<float>(endColor.b) - startColor.b;
+    const float deltaA = static_cast<float>(endColor.a) - startColor.a;
+
+    geometry.Reserve(geometry.GetIndexCount() / 6 + mCount);
+    for (size_t i = 0; i < mCount; ++i) {
+        float t = mLifetime[i] > 0.0f ? std::min(mAge[i] / mLifetime[i], 1.0f) : 1.0f;
+        SDL_Color color = {
+            static_cast<Uint8>(startColor.r + deltaR * t),
+            static_cast<Uint8>(startColor.g + deltaG * t),
+            static_cast<Uint8>(startColor.b + deltaB * t),
+            static_cast<Uint8>(startColor.a + deltaA * t)
+        };
+        geometry.AddQuad({mX[i] - half - offsetX, mY[i] - half - offsetY, size, size}, color);
+    }
+}
+
+} // namespace Lite2D
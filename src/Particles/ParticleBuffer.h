@@ -0,0 +1,68 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <cstddef>
+#include <vector>
+
+class VertexBuffer;
+
+namespace Lite2D {
+
+/**
+ * Particle Buffer
+ * Structure-of-arrays particle storage for one emitter. Every attribute is a dense
+ * float array, so the integration loop is a straight run over contiguous memory the
+ * compiler can vectorize. Dead particles are compacted away in one pass per frame.
+ * Capacity is fixed up front; adding particles never allocates.
+ */
+class ParticleBuffer {
+public:
+    ParticleBuffer() = default;
+    explicit ParticleBuffer(size_t capacity) { SetCapacity(capacity); }
+
+    // Resize storage; live particles past the new capacity are dropped
+    void SetCapacity(size_t capacity);
+    size_t GetCapacity() const { return mCapacity; }
+    size_t GetCount() const { return mCount; }
+    bool IsFull() const { return mCount == mCapacity; }
+
+    // Returns false when the buffer is full
+    bool Add(float x, float y, float velocityX, float velocityY, float lifetime);
+    void Clear() { mCount = 0; }
+
+    // Replace the live particles with count particles from six packed float arrays
+    // (x, y, velocityX, velocityY, age, lifetime; count floats each), e.g. a snapshot.
+    // Returns false if count exceeds the capacity.
+    bool Assign(size_t count, const void* packedArrays);
+
+    // Integrate velocity (with constant acceleration) and age every particle
+    void Update(float deltaTime, float accelerationX = 0.0f, float accelerationY = 0.0f);
+
+    // Drop particles whose age reached their lifetime, keeping the rest in order.
+    // Returns the number removed.
+    size_t RemoveExpired();
+
+    // One size x size quad per particle, color interpolated from start to end over its life
+    void AppendQuads(VertexBuffer& geometry, float offsetX, float offsetY, float size,
+                     SDL_Color startColor, SDL_Color endColor) const;
+
+    // Raw arrays (GetCount() entries each)
+    const float* GetX() const { return mX.data(); }
+    const float* GetY() const { return mY.data(); }
+    const float* GetVelocityX() const { return mVelocityX.data(); }
+    const float* GetVelocityY() const { return mVelocityY.data(); }
+    const float* GetAge() const { return mAge.data(); }
+    const float* GetLifetime() const { return mLifetime.data(); }
+
+private:
+    std::vector<float> mX;
+    std::vector<float> mY;
+    std::vector<float> mVelocityX;
+    std::vector<float> mVelocityY;
+    std::vector<float> mAge;
+    std::vector<float> mLifetime;
+    size_t mCapacity = 0;
+    size_t mCount = 0;
+};
+
+} // namespace Lite2D
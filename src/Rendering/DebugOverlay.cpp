@@ -0,0 +1,177 @@
+#include "DebugOverlay.h"
+#include "ECS/EntityManager.h"
+#include "ECS/SystemManager.h"
+#include "Utils/AllocationTracker.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace Lite2D {
+namespace ECS {
+
+namespace {
+
+// Layout (SDL debug font glyphs are 8x8 pixels)
+constexpr float PANEL_X = 5.0f;
+constexpr float PANEL_Y = 5.0f;
+constexpr float PANEL_WIDTH = 360.0f;
+constexpr float PADDING = 6.0f;
+constexpr float LINE_HEIGHT = 11.0f;
+constexpr float GRAPH_HEIGHT = 48.0f;
+constexpr float GRAPH_BAR_WIDTH = 2.0f;
+constexpr float GRAPH_MAX_MS = 50.0f;
+constexpr float TARGET_FRAME_MS = 1000.0f / 60.0f;
+
+constexpr SDL_Color PANEL_COLOR = {0, 0, 0, 160};
+constexpr SDL_Color TEXT_COLOR = {0, 255, 0, 255};
+constexpr SDL_Color HEADER_COLOR = {255, 255, 255, 255};
+constexpr SDL_Color TARGET_LINE_COLOR = {80, 80, 255, 255};
+
+SDL_Color FrameBarColor(float milliseconds) {
+    if (milliseconds <= TARGET_FRAME_MS) return {0, 200, 0, 255};
+    if (milliseconds <= TARGET_FRAME_MS * 2.0f) return {230, 200, 0, 255};
+    return {230, 40, 40, 255};
+}
+
+} // namespace
+
+void DebugOverlay::AddFrameTime(float milliseconds) {
+    mFrameTimes[mNextFrame] = milliseconds;
+    mNextFrame = (mNextFrame + 1) % FRAME_HISTORY;
+    mFrameCount = std::min(mFrameCount + 1, FRAME_HISTORY);
+}
+
+void DebugOverlay::ResetFrameTimes() {
+    mNextFrame = 0;
+    mFrameCount = 0;
+}
+
+float DebugOverlay::GetFrameTime(size_t index) const {
+    size_t oldest = (mNextFrame + FRAME_HISTORY - mFrameCount) % FRAME_HISTORY;
+    return mFrameTimes[(oldest + index) % FRAME_HISTORY];
+}
+
+float DebugOverlay::GetAverageFrameTime() const {
+    if (mFrameCount == 0) return 0.0f;
+
+    float total = 0.0f;
+    for (size_t i = 0; i < mFrameCount; ++i) {
+        total += GetFrameTime(i);
+    }
+    return total / mFrameCount;
+}
+
+float DebugOverlay::GetMaxFrameTime() const {
+    float result = 0.0f;
+    for (size_t i = 0; i < mFrameCount; ++i) {
+        result = std::max(result, GetFrameTime(i));
+    }
+    return result;
+}
+
+void DebugOverlay::RefreshSystemSummaries() {
+    mSystemSummaries.resize(mSystemManager->GetSystemCount());
+    for (size_t i = 0; i < mSystemSummaries.size(); ++i) {
+        const SystemStats& stats = mSystemManager->GetSystemStatsAt(i);
+        mSystemSummaries[i].averageMilliseconds = stats.GetAverageMilliseconds();
+        mSystemSummaries[i].p99Milliseconds = stats.GetP99Milliseconds();
+    }
+    mFramesSinceSystemRefresh = 0;
+}
+
+void DebugOverlay::Record(RenderCommandList& commands, int layer, const EntityManager& entityManager,
+                          const RenderInfo& renderInfo) {
+    char line[128];
+    const int contentLayer = layer + 1;
+    float x = PANEL_X + PADDING;
+    float y = PANEL_Y + PADDING;
+
+    // Size the panel from the line count up front
+    size_t poolLines = 0;
+    for (size_t type = 0; type < entityManager.GetComponentTypeCount(); ++type) {
+        if (entityManager.GetComponentPool(static_cast<ComponentType>(type))) poolLines++;
+    }
+    size_t systemLines = 0;
+    if (mSystemManager) {
+        systemLines = mSystemManager->IsProfilingEnabled() ? mSystemManager->GetSystemCount() + 1 : 1;
+    }
+    const size_t heapLines = AllocationTracker::IsEnabled() ? 1 : 0;
+    const size_t textLines = 4 + poolLines + heapLines + systemLines;
+    const float panelHeight = PADDING * 3.0f + GRAPH_HEIGHT + textLines * LINE_HEIGHT;
+    
+    // The panel gets a layer of its own so it is drawn under the bars and text whatever their colors
+    commands.RecordFillRect(layer, {PANEL_X, PANEL_Y, PANEL_WIDTH, panelHeight}, PANEL_COLOR);
+
+    auto Text = [&](const char* text, SDL_Color color) {
+        commands.RecordText(contentLayer, text, x, y, color);
+        y += LINE_HEIGHT;
+    };
+
+    // Frame timing
+    float averageMs = GetAverageFrameTime();
+    std::snprintf(line, sizeof(line), "FPS %.1f  frame %.2fms  max %.2fms",
+                  averageMs > 0.0f ? 1000.0f / averageMs : 0.0f, averageMs, GetMaxFrameTime());
+    Text(line, HEADER_COLOR);
+
+    // Frame-time graph, newest frame on the right
+    const float graphTop = y;
+    const float graphBottom = graphTop + GRAPH_HEIGHT;
+    const float graphRight = x + FRAME_HISTORY * GRAPH_BAR_WIDTH;
+    for (size_t i = 0; i < mFrameCount; ++i) {
+        float ms = GetFrameTime(i);
+        float height = std::min(ms / GRAPH_MAX_MS, 1.0f) * GRAPH_HEIGHT;
+        float barX = graphRight - (mFrameCount - i) * GRAPH_BAR_WIDTH;
+        commands.RecordFillRect(contentLayer, {barX, graphBottom - height, GRAPH_BAR_WIDTH - 1.0f, height}, FrameBarColor(ms));
+    }
+    float targetY = graphBottom - (TARGET_FRAME_MS / GRAPH_MAX_MS) * GRAPH_HEIGHT;
+    commands.RecordLine(contentLayer, x, targetY, graphRight, targetY, TARGET_LINE_COLOR);
+    y = graphBottom + PADDING;
+
+    // Entities and component pools
+    std::snprintf(line, sizeof(line), "Entities %zu / %zu", entityManager.GetEntityCount(),
+                  static_cast<size_t>(MAX_ENTITIES));
+    Text(line, HEADER_COLOR);
+    for (size_t type = 0; type < entityManager.GetComponentTypeCount(); ++type) {
+        const IComponentArray* pool = entityManager.GetComponentPool(static_cast<ComponentType>(type));
+        if (!pool) continue;
+        std::snprintf(line, sizeof(line), "  %-16s %zu", pool->GetComponentTypeName(), pool->GetSize());
+        Text(line, TEXT_COLOR);
+    }
+
+    // Renderer
+    std::snprintf(line, sizeof(line), "Render items %zu  static layers %zu", renderInfo.renderItems,
+                  renderInfo.staticLayers);
+    Text(line, HEADER_COLOR);
+    std::snprintf(line, sizeof(line), "  last frame: %zu cmds, %zu draws, %zu state changes",
+                  renderInfo.lastSubmit.commands, renderInfo.lastSubmit.drawCalls,
+                  renderInfo.lastSubmit.stateChanges);
+    Text(line, TEXT_COLOR);
+
+    // Heap traffic, only with LITE2D_TRACK_ALLOCATIONS
+    if (heapLines) {
+        const AllocationTracker::AllocationStats& heap = AllocationTracker::GetLastFrame();
+        std::snprintf(line, sizeof(line), "Heap last frame: %zu allocs, %zu bytes", heap.allocations, heap.bytes);
+        Text(line, HEADER_COLOR);
+    }
+
+    // Systems
+    if (mSystemManager && mSystemManager->IsProfilingEnabled()) {
+        // Summarizing the history each frame would be charged to RenderSystem's own timing
+        if (mSystemSummaries.size() != mSystemManager->GetSystemCount() ||
+            ++mFramesSinceSystemRefresh >= SYSTEM_REFRESH_FRAMES) {
+            RefreshSystemSummaries();
+        }
+
+        Text("Systems            avg ms  p99 ms  entities", HEADER_COLOR);
+        for (size_t i = 0; i < mSystemSummaries.size(); ++i) {
+            std::snprintf(line, sizeof(line), "  %-16.16s %6.3f  %6.3f  %zu", mSystemManager->GetSystemAt(i).GetName(),
+                          mSystemSummaries[i].averageMilliseconds, mSystemSummaries[i].p99Milliseconds,
+                          mSystemManager->GetSystemStatsAt(i).GetLastSample().entityCount);
+            Text(line, TEXT_COLOR);
+        }
+    } else if (mSystemManager) {
+        Text("Systems: profiling disabled", TEXT_COLOR);
+    }
+}
+
+} // namespace ECS
+} // namespace Lite2D
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "RenderCommandList.h"
+#include <SDL3/SDL.h>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace Lite2D {
+namespace ECS {
+
+class EntityManager;
+class SystemManager;
+
+/**
+ * Debug Overlay
+ * On-screen frame-time graph, per-system timings and entity/pool counts.
+ * Everything is read from counters the engine already maintains (living entity count,
+ * component pool sizes, SystemManager profiling history), so drawing it costs no scans.
+ * Text uses SDL's built-in debug font, whose glyphs SDL caches in a texture.
+ * Per-system averages and p99s are refreshed every SYSTEM_REFRESH_FRAMES frames
+ * rather than every frame, so the overlay adds next to nothing to the timings of
+ * the (profiled) RenderSystem update that records it.
+ */
+class DebugOverlay {
+public:
+    static constexpr size_t FRAME_HISTORY = 120;
+    static constexpr size_t SYSTEM_REFRESH_FRAMES = 30;
+    
+    // Renderer-side numbers shown in the overlay
+    struct RenderInfo {
+        size_t renderItems = 0;
+        size_t staticLayers = 0;
+        RenderCommandList::SubmitStats lastSubmit;
+    };
+    
+    DebugOverlay() = default;
+    
+    // Per-system timings come from here when profiling is enabled on it
+    void SetSystemManager(const SystemManager* systemManager) { mSystemManager = systemManager; }
+    
+    void AddFrameTime(float milliseconds);
+    void ResetFrameTimes();
+    
+    // Record the overlay into a command list: the panel at layer, everything on it at layer + 1
+    void Record(RenderCommandList& commands, int layer, const EntityManager& entityManager,
+                const RenderInfo& renderInfo);
+    
+    float GetAverageFrameTime() const;
+    float GetMaxFrameTime() const;
+
+private:
+    const SystemManager* mSystemManager = nullptr;
+    
+    std::array<float, FRAME_HISTORY> mFrameTimes{};
+    size_t mNextFrame = 0;
+    size_t mFrameCount = 0;
+    
+    // Per-system timings as last refreshed, parallel to the SystemManager's systems
+    struct SystemSummary {
+        float averageMilliseconds = 0.0f;
+        float p99Milliseconds = 0.0f;
+    };
+    std::vector<SystemSummary> mSystemSummaries;
+    size_t mFramesSinceSystemRefresh = 0;
+    
+    float GetFrameTime(size_t index) const;
+    void RefreshSystemSummaries();
+};
+
+} // namespace ECS
+} // namespace Lite2D
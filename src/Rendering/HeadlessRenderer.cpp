@@ -0,0 +1,104 @@
+#include "HeadlessRenderer.h"
+#include <cstdlib>
+
+bool HeadlessRenderer::Initialize(int width, int height) {
+    Shutdown();
+
+    // RGBA32 keeps the byte order (R, G, B, A) identical on every platform,
+    // which keeps checksums and golden images comparable across machines
+    mSurface = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_RGBA32);
+    if (!mSurface) {
+        SDL_Log("Failed to create headless surface: %s", SDL_GetError());
+        return false;
+    }
+
+    // The software renderer needs no video subsystem, window or GPU
+    mRenderer = SDL_CreateSoftwareRenderer(mSurface);
+    if (!mRenderer) {
+        SDL_Log("Failed to create software renderer: %s", SDL_GetError());
+        SDL_DestroySurface(mSurface);
+        mSurface = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
+void HeadlessRenderer::Shutdown() {
+    if (mRenderer) {
+        SDL_DestroyRenderer(mRenderer);
+        mRenderer = nullptr;
+    }
+
+    if (mSurface) {
+        SDL_DestroySurface(mSurface);
+        mSurface = nullptr;
+    }
+}
+
+bool HeadlessRenderer::ReadPixel(int x, int y, SDL_Color& color) const {
+    if (!mSurface) return false;
+
+    return SDL_ReadSurfacePixel(mSurface, x, y, &color.r, &color.g, &color.b, &color.a);
+}
+
+uint64_t HeadlessRenderer::ComputeChecksum() const {
+    if (!mSurface || !mSurface->pixels) return 0;
+
+    uint64_t hash = 14695981039346656037ull; // FNV-1a offset basis
+    const size_t rowBytes = static_cast<size_t>(mSurface->w) * 4;
+
+    for (int y = 0; y < mSurface->h; ++y) {
+        // Hash row by row so pitch padding never leaks into the result
+        const Uint8* row = static_cast<const Uint8*>(mSurface->pixels) + y * mSurface->pitch;
+        for (size_t i = 0; i < rowBytes; ++i) {
+            hash ^= row[i];
+            hash *= 1099511628211ull; // FNV-1a prime
+        }
+    }
+
+    return hash;
+}
+
+bool HeadlessRenderer::SaveToFile(const std::string& path) const {
+    if (!mSurface) return false;
+
+    if (!SDL_SaveBMP(mSurface, path.c_str())) {
+        SDL_Log("Failed to save headless frame: %s", SDL_GetError());
+        return false;
+    }
+    return true;
+}
+
+bool HeadlessRenderer::MatchesGoldenImage(const std::string& path, int tolerance) const {
+    if (!mSurface) return false;
+
+    SDL_Surface* loaded = SDL_LoadBMP(path.c_str());
+    if (!loaded) {
+        SDL_Log("Failed to load golden image: %s", SDL_GetError());
+        return false;
+    }
+
+    SDL_Surface* golden = SDL_ConvertSurface(loaded, SDL_PIXELFORMAT_RGBA32);
+    SDL_DestroySurface(loaded);
+    if (!golden) {
+        SDL_Log("Failed to convert golden image: %s", SDL_GetError());
+        return false;
+    }
+
+    bool matches = golden->w == mSurface->w && golden->h == mSurface->h;
+
+    for (int y = 0; matches && y < mSurface->h; ++y) {
+        const Uint8* actual = static_cast<const Uint8*>(mSurface->pixels) + y * mSurface->pitch;
+        const Uint8* expected = static_cast<const Uint8*>(golden->pixels) + y * golden->pitch;
+        for (int i = 0; i < mSurface->w * 4; ++i) {
+            if (std::abs(static_cast<int>(actual[i]) - static_cast<int>(expected[i])) > tolerance) {
+                matches = false;
+                break;
+            }
+        }
+    }
+
+    SDL_DestroySurface(golden);
+    return matches;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <cstdint>
+#include <string>
+
+/**
+ * Headless render target
+ * Owns an offscreen surface and an SDL software renderer that draws into it,
+ * so RenderSystem and game render paths can run without a window or display
+ */
+class HeadlessRenderer {
+public:
+    HeadlessRenderer() = default;
+    ~HeadlessRenderer() {
+        // Incase you forget to call Shutdown
+        Shutdown();
+    }
+
+    // Delete copy constructor and assignment operator
+    HeadlessRenderer(const HeadlessRenderer&) = delete;
+    HeadlessRenderer& operator=(const HeadlessRenderer&) = delete;
+
+    // Delete move constructor and assignment operator
+    HeadlessRenderer(HeadlessRenderer&&) = delete;
+    HeadlessRenderer& operator=(HeadlessRenderer&&) = delete;
+
+    // Create the offscreen surface and software renderer
+    bool Initialize(int width, int height);
+    void Shutdown();
+
+    // Get the underlying SDL_Renderer (drop-in for a windowed renderer)
+    SDL_Renderer* GetRendererObject() const { return mRenderer; }
+    SDL_Surface* GetSurface() const { return mSurface; }
+
+    int GetWidth() const { return mSurface ? mSurface->w : 0; }
+    int GetHeight() const { return mSurface ? mSurface->h : 0; }
+
+    // Pixel access for golden-image tests
+    bool ReadPixel(int x, int y, SDL_Color& color) const;
+
+    // FNV-1a hash of the framebuffer, stable across runs for identical output
+    uint64_t ComputeChecksum() const;
+
+    // Golden image helpers (BMP on disk)
+    bool SaveToFile(const std::string& path) const;
+    bool MatchesGoldenImage(const std::string& path, int tolerance = 0) const;
+
+private:
+    SDL_Surface* mSurface{ nullptr };
+    SDL_Renderer* mRenderer{ nullptr };
+};
@@ -0,0 +1,258 @@
+#include "RenderCommandList.h"
+#include "TextRenderer.h"
+#include "VertexBuffer.h"
+#include "Utils/Trace.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace {
+
+inline bool SameColor(SDL_Color a, SDL_Color b) {
+    return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+}
+
+template<typename T>
+void WritePod(std::ofstream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+} // namespace
+
+RenderCommand& RenderCommandList::PushCommand(RenderCommandType type, int layer, SDL_Color color) {
+    RenderCommand command{};
+    command.type = type;
+    command.layer = layer;
+    command.sequence = static_cast<uint32_t>(mCommands.size());
+    command.color = color;
+    mCommands.push_back(command);
+    return mCommands.back();
+}
+
+void RenderCommandList::RecordFillRect(int layer, const SDL_FRect& rect, SDL_Color color) {
+    PushCommand(RenderCommandType::FillRect, layer, color).rect = rect;
+}
+
+void RenderCommandList::RecordOutlineRect(int layer, const SDL_FRect& rect, SDL_Color color) {
+    PushCommand(RenderCommandType::OutlineRect, layer, color).rect = rect;
+}
+
+void RenderCommandList::RecordLine(int layer, float x1, float y1, float x2, float y2, SDL_Color color) {
+    PushCommand(RenderCommandType::Line, layer, color).rect = { x1, y1, x2, y2 };
+}
+
+void RenderCommandList::RecordSprite(int layer, SDL_Texture* texture, const SDL_FRect& destRect,
+                                     const SDL_FRect* sourceRect, SDL_Color tint) {
+    if (!texture) return;
+
+    RenderCommand& command = PushCommand(RenderCommandType::Sprite, layer, tint);
+    command.texture = texture;
+    command.rect = destRect;
+    command.sourceRect = sourceRect ? *sourceRect : SDL_FRect{ 0.0f, 0.0f, 0.0f, 0.0f };
+}
+
+void RenderCommandList::RecordText(int layer, const std::string& text, float x, float y, SDL_Color color,
+                                   TextRenderer* font) {
+    RecordText(layer, text.c_str(), x, y, color, font);
+}
+
+void RenderCommandList::RecordText(int layer, const char* text, float x, float y, SDL_Color color,
+                                   TextRenderer* font) {
+    if (!text) return;
+
+    const size_t length = std::strlen(text);
+    RenderCommand& command = PushCommand(RenderCommandType::Text, layer, color);
+    command.rect = { x, y, 0.0f, 0.0f };
+    command.font = font;
+    command.textOffset = static_cast<uint32_t>(mTextArena.size());
+    command.textLength = static_cast<uint32_t>(length);
+
+    mTextArena.insert(mTextArena.end(), text, text + length);
+    mTextArena.push_back('\0');
+}
+
+void RenderCommandList::RecordGeometry(int layer, const VertexBuffer* geometry, size_t firstIndex,
+                                       size_t indexCount, SDL_Texture* texture) {
+    if (!geometry || indexCount == 0) return;
+
+    RenderCommand& command = PushCommand(RenderCommandType::Geometry, layer, { 255, 255, 255, 255 });
+    command.geometry = geometry;
+    command.texture = texture;
+    command.firstIndex = static_cast<uint32_t>(firstIndex);
+    command.indexCount = static_cast<uint32_t>(indexCount);
+}
+
+void RenderCommandList::Append(const RenderCommandList& other) {
+    const uint32_t sequenceBase = static_cast<uint32_t>(mCommands.size());
+    const uint32_t textBase = static_cast<uint32_t>(mTextArena.size());
+
+    for (RenderCommand command : other.mCommands) {
+        command.sequence += sequenceBase;
+        if (command.type == RenderCommandType::Text) {
+            command.textOffset += textBase;
+        }
+        mCommands.push_back(command);
+    }
+
+    mTextArena.insert(mTextArena.end(), other.mTextArena.begin(), other.mTextArena.end());
+}
+
+void RenderCommandList::SortCommands() {
+    mSortedIndices.resize(mCommands.size());
+    for (uint32_t i = 0; i < mSortedIndices.size(); ++i) {
+        mSortedIndices[i] = i;
+    }
+
+    // Layer is the draw order. Within a layer commands replay in record order, so
+    // overlapping draws come out exactly as recorded; replay batches adjacent runs
+    // that share state. Systems mostly record layer by layer, so skip the sort then.
+    auto Before = [this](uint32_t ia, uint32_t ib) {
+        const RenderCommand& a = mCommands[ia];
+        const RenderCommand& b = mCommands[ib];
+        if (a.layer != b.layer) return a.layer < b.layer;
+        return a.sequence < b.sequence;
+    };
+    if (!std::is_sorted(mSortedIndices.begin(), mSortedIndices.end(), Before)) {
+        std::sort(mSortedIndices.begin(), mSortedIndices.end(), Before);
+    }
+}
+
+void RenderCommandList::FlushRectBatch(SDL_Renderer* renderer, RenderCommandType type) {
+    if (mRectBatch.empty()) return;
+
+    const int count = static_cast<int>(mRectBatch.size());
+    if (type == RenderCommandType::FillRect) {
+        SDL_RenderFillRects(renderer, mRectBatch.data(), count);
+    } else {
+        SDL_RenderRects(renderer, mRectBatch.data(), count);
+    }
+
+    mLastStats.drawCalls++;
+    mRectBatch.clear();
+}
+
+void RenderCommandList::Submit(SDL_Renderer* renderer) {
+    LITE2D_TRACE_SCOPE("RenderCommandList::Submit");
+    mLastStats = SubmitStats();
+    mLastStats.commands = mCommands.size();
+    if (!renderer || mCommands.empty()) return;
+
+    SortCommands();
+
+    bool hasDrawColor = false;
+    SDL_Color drawColor{ 0, 0, 0, 0 };
+    auto BindDrawColor = [&](SDL_Color color) {
+        if (!hasDrawColor || !SameColor(color, drawColor)) {
+            SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
+            drawColor = color;
+            hasDrawColor = true;
+            mLastStats.stateChanges++;
+        }
+    };
+
+    SDL_Texture* boundTexture = nullptr;
+    SDL_Color boundTint{ 0, 0, 0, 0 };
+    RenderCommandType batchType = RenderCommandType::FillRect;
+
+    for (uint32_t index : mSortedIndices) {
+        const RenderCommand& command = mCommands[index];
+
+        // A rect batch ends as soon as the type or color changes
+        if (!mRectBatch.empty() && (command.type != batchType || !SameColor(command.color, drawColor))) {
+            FlushRectBatch(renderer, batchType);
+        }
+
+        switch (command.type) {
+            case RenderCommandType::FillRect:
+            case RenderCommandType::OutlineRect:
+                BindDrawColor(command.color);
+                batchType = command.type;
+                mRectBatch.push_back(command.rect);
+                break;
+
+            case RenderCommandType::Line:
+                BindDrawColor(command.color);
+                SDL_RenderLine(renderer, command.rect.x, command.rect.y, command.rect.w, command.rect.h);
+                mLastStats.drawCalls++;
+                break;
+
+            case RenderCommandType::Sprite: {
+                if (command.texture != boundTexture || !SameColor(command.color, boundTint)) {
+                    SDL_SetTextureColorMod(command.texture, command.color.r, command.color.g, command.color.b);
+                    SDL_SetTextureAlphaMod(command.texture, command.color.a);
+                    boundTexture = command.texture;
+                    boundTint = command.color;
+                    mLastStats.stateChanges++;
+                }
+                const SDL_FRect* source = command.sourceRect.w > 0.0f ? &command.sourceRect : nullptr;
+                SDL_RenderTexture(renderer, command.texture, source, &command.rect);
+                mLastStats.drawCalls++;
+                break;
+            }
+
+            case RenderCommandType::Text:
+                if (command.font) {
+                    command.font->RenderText(GetText(command), command.color,
+                                             static_cast<int>(command.rect.x), static_cast<int>(command.rect.y), renderer);
+                } else {
+                    BindDrawColor(command.color);
+                    SDL_RenderDebugText(renderer, command.rect.x, command.rect.y, GetText(command));
+                }
+                mLastStats.drawCalls++;
+                break;
+
+            case RenderCommandType::Geometry:
+                command.geometry->Submit(renderer, command.texture, command.firstIndex, command.indexCount);
+                mLastStats.drawCalls++;
+                break;
+        }
+    }
+
+    FlushRectBatch(renderer, batchType);
+}
+
+void RenderCommandList::Clear() {
+    mCommands.clear();
+    mTextArena.clear();
+    mSortedIndices.clear();
+}
+
+bool RenderCommandList::WriteToFile(const std::string& path) const {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) {
+        SDL_Log("Failed to open render capture file: %s", path.c_str());
+        return false;
+    }
+
+    // Layout (native endianness):
+    //   char[4] "L2RC", uint32 version, uint32 commandCount, uint32 textBytes
+    //   commandCount x { uint8 type, int32 layer, uint32 sequence, uint8 rgba[4],
+    //                    float rect[4], float sourceRect[4], uint64 textureId,
+    //                    uint64 fontId, uint32 textOffset, uint32 textLength,
+    //                    uint64 geometryId, uint32 firstIndex, uint32 indexCount }
+    //   textBytes of null-terminated text
+    const char magic[4] = { 'L', '2', 'R', 'C' };
+    out.write(magic, sizeof(magic));
+    WritePod(out, uint32_t(2));
+    WritePod(out, static_cast<uint32_t>(mCommands.size()));
+    WritePod(out, static_cast<uint32_t>(mTextArena.size()));
+
+    for (const RenderCommand& command : mCommands) {
+        WritePod(out, static_cast<uint8_t>(command.type));
+        WritePod(out, static_cast<int32_t>(command.layer));
+        WritePod(out, command.sequence);
+        WritePod(out, command.color);
+        WritePod(out, command.rect);
+        WritePod(out, command.sourceRect);
+        WritePod(out, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(command.texture)));
+        WritePod(out, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(command.font)));
+        WritePod(out, command.textOffset);
+        WritePod(out, command.textLength);
+        WritePod(out, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(command.geometry)));
+        WritePod(out, command.firstIndex);
+        WritePod(out, command.indexCount);
+    }
+
+    out.write(mTextArena.data(), static_cast<std::streamsize>(mTextArena.size()));
+    return static_cast<bool>(out);
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class TextRenderer;
+class VertexBuffer;
+
+enum class RenderCommandType : uint8_t {
+    FillRect = 0,
+    OutlineRect,
+    Line,
+    Sprite,
+    Text,
+    Geometry
+};
+
+/**
+ * A single recorded draw
+ * Plain data so command lists can be merged, sorted and written to disk
+ */
+struct RenderCommand {
+    RenderCommandType type;
+    int layer;                    // Sort layer (lower = drawn first)
+    uint32_t sequence;            // Record order, the draw order within a layer
+    SDL_Color color;
+    SDL_FRect rect;               // Quad/sprite destination, line endpoints (x, y) -> (w, h), text origin
+    SDL_FRect sourceRect;         // Sprite source rect (w <= 0 means whole texture)
+    SDL_Texture* texture;         // Sprite texture
+    TextRenderer* font;           // Text font (nullptr = SDL built-in debug font)
+    uint32_t textOffset;          // Text bytes in the list's string arena
+    uint32_t textLength;
+    const VertexBuffer* geometry; // Geometry vertices, must stay alive until Submit
+    uint32_t firstIndex;          // Geometry index range
+    uint32_t indexCount;
+};
+
+/**
+ * Render Command List
+ * Systems record typed draw commands into linear per-frame storage, the list is then
+ * sorted by layer and replayed against an SDL_Renderer in one pass. Commands within a
+ * layer keep their record order, so overlaps draw as recorded; adjacent commands with
+ * identical state are collapsed into batched SDL calls.
+ */
+class RenderCommandList {
+public:
+    struct SubmitStats {
+        size_t commands = 0;
+        size_t drawCalls = 0;
+        size_t stateChanges = 0;
+    };
+
+    RenderCommandList() = default;
+    ~RenderCommandList() = default;
+
+    RenderCommandList(const RenderCommandList&) = delete;
+    RenderCommandList& operator=(const RenderCommandList&) = delete;
+
+    // Recording
+    void RecordFillRect(int layer, const SDL_FRect& rect, SDL_Color color);
+    void RecordOutlineRect(int layer, const SDL_FRect& rect, SDL_Color color);
+    void RecordLine(int layer, float x1, float y1, float x2, float y2, SDL_Color color);
+    void RecordSprite(int layer, SDL_Texture* texture, const SDL_FRect& destRect,
+                      const SDL_FRect* sourceRect = nullptr, SDL_Color tint = { 255, 255, 255, 255 });
+    void RecordText(int layer, const std::string& text, float x, float y, SDL_Color color,
+                    TextRenderer* font = nullptr);
+    void RecordText(int layer, const char* text, float x, float y, SDL_Color color,
+                    TextRenderer* font = nullptr);
+    // Triangles prepared elsewhere (e.g. on worker threads). Geometry within a layer
+    // replays in record order so chunked buffers keep their relative ordering.
+    void RecordGeometry(int layer, const VertexBuffer* geometry, size_t firstIndex, size_t indexCount,
+                        SDL_Texture* texture = nullptr);
+
+    // Merge commands recorded elsewhere (e.g. on another thread) after this list's own
+    void Append(const RenderCommandList& other);
+
+    // Sort by layer and replay. The list is left intact so it can still be captured.
+    void Submit(SDL_Renderer* renderer);
+
+    // Reset for the next frame, keeping allocated capacity
+    void Clear();
+
+    // Capture to file for offline profiling (binary, see RenderCommandList.cpp for layout)
+    bool WriteToFile(const std::string& path) const;
+
+    // Accessors
+    size_t GetCommandCount() const { return mCommands.size(); }
+    const std::vector<RenderCommand>& GetCommands() const { return mCommands; }
+    const char* GetText(const RenderCommand& command) const { return mTextArena.data() + command.textOffset; }
+    const SubmitStats& GetLastSubmitStats() const { return mLastStats; }
+
+private:
+    std::vector<RenderCommand> mCommands;
+    std::vector<char> mTextArena;          // Null-terminated strings referenced by Text commands
+    std::vector<uint32_t> mSortedIndices;
+    std::vector<SDL_FRect> mRectBatch;     // Scratch for batched rect calls
+    SubmitStats mLastStats;
+
+    RenderCommand& PushCommand(RenderCommandType type, int layer, SDL_Color color);
+    void SortCommands();
+    void FlushRectBatch(SDL_Renderer* renderer, RenderCommandType type);
+};
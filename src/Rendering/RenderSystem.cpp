@@ -1,5 +1,5 @@
 #include "RenderSystem.h"
-#include "ECS/Components/Velocity.h"
+#include "Utils/Trace.h"
 #include <iostream>
 #include <algorithm>
 
@@ -12,48 +12,59 @@ RenderSystem::RenderSystem(SDL_Renderer* renderer) : mRenderer(renderer) {
     }
 }
 
+RenderSystem::~RenderSystem() {
+    ReleaseStaticLayers();
+}
+
 void RenderSystem::Update(EntityManager& entityManager, float deltaTime) {
     if (!mEnabled || !mRenderer) return;
     
     // Clear the screen
     ClearScreen();
     
-    // Get all entities with both Position and Renderable components
-    auto entities = entityManager.GetEntitiesWith<Position, Renderable>();
-    
-    // Collect render items
-    mRenderItems.clear();
-    mRenderItems.reserve(entities.size());
-    
-    for (Entity entity : entities) {
-        Position* position = entityManager.GetComponent<Position>(entity);
-        Renderable* renderable = entityManager.GetComponent<Renderable>(entity);
+    {
+        LITE2D_TRACE_SCOPE("RenderSystem::Collect");
+        
+        // Get all entities with both Position and Renderable components
+        auto entities = entityManager.GetFrameEntitiesWith<Position, Renderable>();
+        mProcessedEntityCount = entities.size();
         
-        if (!position || !renderable || !renderable->visible) continue;
+        // Collect render items
+        mRenderItems.clear();
+        mRenderItems.reserve(entities.size());
         
-        mRenderItems.push_back({entity, position, renderable});
+        // Read-only access, so drawing never counts as a change for static layers
+        const EntityManager& components = entityManager;
+        for (Entity entity : entities) {
+            const Position* position = components.GetComponent<Position>(entity);
+            const Renderable* renderable = components.GetComponent<Renderable>(entity);
+            
+            if (!position || !renderable || !renderable->visible) continue;
+            
+            mRenderItems.push_back({entity, position, renderable});
+        }
     }
     
-    // Sort by render layer
-    std::sort(mRenderItems.begin(), mRenderItems.end(), 
-        [this](const RenderItem& a, const RenderItem& b) {
-            if (mRenderAscending) {
-                return a.renderable->layer < b.renderable->layer;
-            } else {
-                return a.renderable->layer > b.renderable->layer;
-            }
-        });
-    
-    // Render all entities
-    for (const auto& item : mRenderItems) {
-        RenderEntity(item.position, item.renderable);
-    }
+    // Record draw commands - layer ordering and state grouping happen in Submit
+    mCommandList.Clear();
+    SplitStaticItems(entityManager);
+    RecordStaticLayers();
+    RecordEntities();
+    RecordEmitters();
     
     // Render debug info if enabled
     if (mShowDebugInfo) {
+        TrackFrameTime();
         RenderDebugInfo(entityManager);
     }
     
+    mCommandList.Submit(mRenderer);
+    
+    if (!mCapturePath.empty()) {
+        mCommandList.WriteToFile(mCapturePath);
+        mCapturePath.clear();
+    }
+    
     // Present the frame
     PresentFrame();
 }
@@ -63,6 +74,8 @@ void RenderSystem::Initialize(EntityManager& entityManager) {
 }
 
 void RenderSystem::Shutdown(EntityManager& entityManager) {
+    // Cached textures belong to the renderer, release them while it is still alive
+    ReleaseStaticLayers();
     std::cout << "RenderSystem shutdown" << std::endl;
 }
 
@@ -90,154 +103,285 @@ void RenderSystem::ClearScreen() {
 }
 
 void RenderSystem::PresentFrame() {
+    LITE2D_TRACE_SCOPE("RenderSystem::Present");
     if (mRenderer) {
         SDL_RenderPresent(mRenderer);
     }
 }
 
-void RenderSystem::RenderEntity(Position* position, Renderable* renderable) {
-    if (!mRenderer || !position || !renderable) return;
+void RenderSystem::SetWorkerThreads(size_t threadCount) {
+    if (threadCount == 1) {
+        mThreadPool.reset();
+    } else {
+        mThreadPool = std::make_unique<ThreadPool>(threadCount);
+    }
+}
+
+void RenderSystem::RecordEntities() {
+    LITE2D_TRACE_SCOPE("RenderSystem::RecordEntities");
+    if (mRenderItems.empty()) return;
+    
+    // Sort by layer so each thread's slice is already in draw order
+    std::stable_sort(mRenderItems.begin(), mRenderItems.end(),
+        [this](const RenderItem& a, const RenderItem& b) {
+            return GetSortLayer(a.renderable->layer) < GetSortLayer(b.renderable->layer);
+        });
     
-    // Apply camera offset
-    float screenX = position->x - mCameraOffsetX;
-    float screenY = position->y - mCameraOffsetY;
+    const size_t chunkCount = GetWorkerThreads();
+    mPrepChunks.resize(chunkCount);
+    for (SpriteChunk& chunk : mPrepChunks) {
+        chunk.Clear();
+    }
+    mSpritePositions.resize(mRenderItems.size());
+    mSpriteRenderables.resize(mRenderItems.size());
     
-    // Render a 20x20 rectangle at the entity's position
-    SDL_FRect rect = {screenX - 10, screenY - 10, 20, 20};
+    // Pure CPU work - no SDL calls happen on the workers
+    if (mThreadPool) {
+        mThreadPool->ParallelFor(mRenderItems.size(), [this](size_t begin, size_t end, size_t chunkIndex) {
+            PrepareChunk(begin, end, mPrepChunks[chunkIndex]);
+        });
+    } else {
+        PrepareChunk(0, mRenderItems.size(), mPrepChunks[0]);
+    }
     
-    // Set color based on render layer for different entity types
-    switch (renderable->layer) {
-        case 0: // Snake body segments
-            SDL_SetRenderDrawColor(mRenderer, 100, 200, 100, 255); // Green
-            break;
-        case 1: // Snake head
-            SDL_SetRenderDrawColor(mRenderer, 200, 100, 100, 255); // Red
-            break;
-        case 2: // Food
-            SDL_SetRenderDrawColor(mRenderer, 255, 255, 100, 255); // Yellow
-            break;
-        case 3: // Walls
-            SDL_SetRenderDrawColor(mRenderer, 150, 150, 150, 255); // Gray
-            break;
-        default: // Default
-            SDL_SetRenderDrawColor(mRenderer, 255, 255, 255, 255); // White
-            break;
+    // Chunks are recorded in slice order so each layer keeps its entity order
+    for (const SpriteChunk& chunk : mPrepChunks) {
+        for (const GeometryRun& run : chunk.runs) {
+            mCommandList.RecordGeometry(run.layer, &chunk.geometry, run.firstIndex, run.indexCount);
+        }
     }
+}
+
+void RenderSystem::RecordEmitters() {
+    if (!mEmitterSource) return;
+    LITE2D_TRACE_SCOPE("RenderSystem::RecordEmitters");
     
-    SDL_RenderFillRect(mRenderer, &rect);
+    const auto& emitters = mEmitterSource->GetEmitters();
+    mEmitterGeometry.resize(emitters.size());
     
-    // Render a darker border for better visibility
-    Uint8 r, g, b, a;
-    SDL_GetRenderDrawColor(mRenderer, &r, &g, &b, &a);
-    SDL_SetRenderDrawColor(mRenderer, r/2, g/2, b/2, 255);
-    SDL_RenderRect(mRenderer, &rect);
+    size_t index = 0;
+    for (const auto& pair : emitters) {
+        const EmitterSystem::EmitterState& state = pair.second;
+        VertexBuffer& geometry = mEmitterGeometry[index++];
+        geometry.Clear();
+        state.particles.AppendQuads(geometry, mCameraOffsetX, mCameraOffsetY, state.size,
+                                    state.startColor, state.endColor);
+        mCommandList.RecordGeometry(GetSortLayer(state.layer), &geometry, 0, geometry.GetIndexCount());
+    }
 }
 
-void RenderSystem::RenderDebugInfo(EntityManager& entityManager) {
-    if (!mRenderer) return;
+void RenderSystem::PrepareChunk(size_t begin, size_t end, SpriteChunk& chunk) {
+    LITE2D_TRACE_SCOPE("RenderSystem::PrepareChunk");
     
-    // Set up debug text rendering parameters
-    const int DEBUG_FONT_SIZE = 16;
-    const int DEBUG_LINE_HEIGHT = 20;
-    const int DEBUG_START_X = 10;
-    const int DEBUG_START_Y = 10;
-    
-    // Debug text color (bright green)
-    SDL_SetRenderDrawColor(mRenderer, 0, 255, 0, 255);
-    
-    // Get debug information
-    size_t totalEntities = entityManager.GetEntityCount();
-    auto entitiesWithPosition = entityManager.GetEntitiesWith<Position>();
-    auto entitiesWithRenderable = entityManager.GetEntitiesWith<Renderable>();
-    auto entitiesWithVelocity = entityManager.GetEntitiesWith<Velocity>();
-    auto entitiesWithBoth = entityManager.GetEntitiesWith<Position, Renderable>();
-    
-    // Render debug info background
-    SDL_SetRenderDrawColor(mRenderer, 0, 0, 0, 128); // Semi-transparent black
-    SDL_FRect debugBg = {5, 5, 350, 200};
-    SDL_RenderFillRect(mRenderer, &debugBg);
-    
-    // Debug info border
-    SDL_SetRenderDrawColor(mRenderer, 0, 255, 0, 255); // Green border
-    SDL_RenderRect(mRenderer, &debugBg);
-    
-    // Reset text color
-    SDL_SetRenderDrawColor(mRenderer, 0, 255, 0, 255);
-    
-    // Helper function to render a debug line (simplified text rendering)
-    auto RenderDebugLine = [this, DEBUG_START_X, DEBUG_START_Y, DEBUG_LINE_HEIGHT](int line, const std::string& text) {
-        // For now, we'll render simple rectangles to represent text
-        // In a real implementation, you'd use a font rendering system
-        int y = DEBUG_START_Y + (line * DEBUG_LINE_HEIGHT);
-        
-        // Render a small indicator rectangle for each line
-        SDL_FRect indicator = {static_cast<float>(DEBUG_START_X), static_cast<float>(y + 5), 10.0f, 10.0f};
-        SDL_RenderFillRect(mRenderer, &indicator);
-        
-        // Note: Actual text rendering would require SDL_ttf or similar
-        // For now, we'll just render the indicator rectangles
-    };
-    
-    // Render debug information lines
-    RenderDebugLine(0, "=== ECS Debug Info ===");
-    RenderDebugLine(1, "Total Entities: " + std::to_string(totalEntities));
-    RenderDebugLine(2, "With Position: " + std::to_string(entitiesWithPosition.size()));
-    RenderDebugLine(3, "With Renderable: " + std::to_string(entitiesWithRenderable.size()));
-    RenderDebugLine(4, "With Velocity: " + std::to_string(entitiesWithVelocity.size()));
-    RenderDebugLine(5, "Renderable (Pos+Ren): " + std::to_string(entitiesWithBoth.size()));
-    
-    // Also print debug info to console for demonstration
-    static int debugCounter = 0;
-    if (debugCounter++ % 60 == 0) { // Print every 60 frames (roughly once per second)
-        std::cout << "[DEBUG] ECS Stats - Entities: " << totalEntities 
-                  << ", Pos: " << entitiesWithPosition.size()
-                  << ", Ren: " << entitiesWithRenderable.size()
-                  << ", Vel: " << entitiesWithVelocity.size()
-                  << ", RenderItems: " << mRenderItems.size() << std::endl;
-    }
-    
-    // Render camera info
-    RenderDebugLine(6, "Camera Offset: (" + 
-                    std::to_string((int)mCameraOffsetX) + ", " + 
-                    std::to_string((int)mCameraOffsetY) + ")");
-    
-    // Render render items info
-    RenderDebugLine(7, "Render Items: " + std::to_string(mRenderItems.size()));
-    
-    // Render layer info if we have render items
-    if (!mRenderItems.empty()) {
-        int minLayer = mRenderItems[0].renderable->layer;
-        int maxLayer = mRenderItems[0].renderable->layer;
-        
-        for (const auto& item : mRenderItems) {
-            minLayer = std::min(minLayer, item.renderable->layer);
-            maxLayer = std::max(maxLayer, item.renderable->layer);
+    // Each thread gathers its own slice, so the pool reads are spread across workers too
+    for (size_t i = begin; i < end; ++i) {
+        mSpritePositions[i] = *mRenderItems[i].position;
+        mSpriteRenderables[i] = *mRenderItems[i].renderable;
+    }
+    
+    BuildSpriteChunk(mSpritePositions.data() + begin, mSpriteRenderables.data() + begin, end - begin,
+                     mCameraOffsetX, mCameraOffsetY, mRenderAscending, chunk);
+}
+
+void RenderSystem::SetLayerStatic(int layer, bool isStatic) {
+    auto it = mStaticLayers.find(layer);
+    if (isStatic) {
+        if (it == mStaticLayers.end()) {
+            mStaticLayers[layer];
         }
-        
-        RenderDebugLine(8, "Layer Range: " + std::to_string(minLayer) + " - " + std::to_string(maxLayer));
+    } else if (it != mStaticLayers.end()) {
+        if (it->second.texture) {
+            SDL_DestroyTexture(it->second.texture);
+        }
+        mStaticLayers.erase(it);
+    }
+}
+
+void RenderSystem::MarkStaticLayerDirty(int layer) {
+    auto it = mStaticLayers.find(layer);
+    if (it != mStaticLayers.end()) {
+        it->second.dirty = true;
+    }
+}
+
+void RenderSystem::InvalidateStaticLayers() {
+    for (auto& pair : mStaticLayers) {
+        pair.second.valid = false;
+        pair.second.failed = false;
+    }
+}
+
+void RenderSystem::ReleaseStaticLayers() {
+    for (auto& pair : mStaticLayers) {
+        StaticLayer& layer = pair.second;
+        if (layer.texture) {
+            SDL_DestroyTexture(layer.texture);
+            layer.texture = nullptr;
+        }
+        layer.valid = false;
+    }
+}
+
+namespace {
+constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+constexpr uint64_t FNV_PRIME = 1099511628211ull;
+} // namespace
+
+void RenderSystem::SplitStaticItems(EntityManager& entityManager) {
+    for (auto& pair : mStaticLayers) {
+        pair.second.items.clear();
+        pair.second.membership = FNV_OFFSET_BASIS;
     }
+    if (mStaticLayers.empty()) return;
     
-    // Render entity bounding boxes if we have render items
-    if (mShowDebugInfo && !mRenderItems.empty()) {
-        SDL_SetRenderDrawColor(mRenderer, 255, 0, 0, 128); // Semi-transparent red
-        
-        for (const auto& item : mRenderItems) {
-            if (!item.position || !item.renderable) continue;
-            
-            // Apply camera offset
-            float screenX = item.position->x - mCameraOffsetX;
-            float screenY = item.position->y - mCameraOffsetY;
-            
-            // Render entity bounding box
-            SDL_FRect bbox = {screenX - 10, screenY - 10, 20, 20};
-            SDL_RenderRect(mRenderer, &bbox);
+    // The pools stamp every write to Position and Renderable, so a changed entity
+    // shows up as a newer version than the layer was built at - no field compares
+    ComponentArray<Position>* positions = entityManager.GetComponentArray<Position>();
+    ComponentArray<Renderable>* renderables = entityManager.GetComponentArray<Renderable>();
+    positions->SetChangeTracking(true);
+    renderables->SetChangeTracking(true);
+    mPositionVersion = positions->GetChangeVersion();
+    mRenderableVersion = renderables->GetChangeVersion();
+    
+    // Move static-layer items out of the per-frame vertex path. Hashing the entity ids
+    // and generations on the way catches entities joining, leaving or reordering
+    // (including a recycled ID) without another pass.
+    size_t dynamicCount = 0;
+    for (size_t i = 0; i < mRenderItems.size(); ++i) {
+        const RenderItem& item = mRenderItems[i];
+        auto it = mStaticLayers.find(item.renderable->layer);
+        if (it != mStaticLayers.end()) {
+            StaticLayer& layer = it->second;
+            layer.items.push_back(item);
             
-            // Render entity ID at the center (simplified)
-            SDL_FRect idBox = {screenX - 2, screenY - 2, 4, 4};
-            SDL_RenderFillRect(mRenderer, &idBox);
+            uint64_t id = (static_cast<uint64_t>(entityManager.GetGeneration(item.entity)) << 32) | item.entity;
+            layer.membership = (layer.membership ^ id) * FNV_PRIME;
+            if (!layer.dirty && (positions->GetChangeVersion(item.entity) > layer.builtPositionVersion ||
+                                 renderables->GetChangeVersion(item.entity) > layer.builtRenderableVersion)) {
+                layer.dirty = true;
+            }
+        } else {
+            mRenderItems[dynamicCount++] = item;
+        }
+    }
+    mRenderItems.resize(dynamicCount);
+}
+
+void RenderSystem::DrawStaticLayerDirectly(const StaticLayer& layer) {
+    // Back into the per-frame path; RecordEntities sorts them onto their layer
+    mRenderItems.insert(mRenderItems.end(), layer.items.begin(), layer.items.end());
+}
+
+bool RenderSystem::RebuildStaticLayer(StaticLayer& layer, int width, int height) {
+    if (!layer.texture || layer.width != width || layer.height != height) {
+        if (layer.texture) {
+            SDL_DestroyTexture(layer.texture);
+        }
+        layer.texture = SDL_CreateTexture(mRenderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, width, height);
+        if (!layer.texture) {
+            SDL_Log("Failed to create static layer texture: %s", SDL_GetError());
+            return false;
+        }
+        SDL_SetTextureBlendMode(layer.texture, SDL_BLENDMODE_BLEND);
+        layer.width = width;
+        layer.height = height;
+    }
+    
+    layer.geometry.Clear();
+    layer.geometry.Reserve(layer.items.size() * 2);
+    for (const RenderItem& item : layer.items) {
+        AppendSpriteQuads(*item.position, *item.renderable, mCameraOffsetX, mCameraOffsetY, layer.geometry);
+    }
+    
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(mRenderer);
+    SDL_SetRenderTarget(mRenderer, layer.texture);
+    SDL_SetRenderDrawColor(mRenderer, 0, 0, 0, 0); // Transparent where the layer is empty
+    SDL_RenderClear(mRenderer);
+    layer.geometry.Submit(mRenderer);
+    SDL_SetRenderTarget(mRenderer, previousTarget);
+    
+    mStaticLayerRebuilds++;
+    return true;
+}
+
+void RenderSystem::RecordStaticLayers() {
+    if (mStaticLayers.empty()) return;
+    LITE2D_TRACE_SCOPE("RenderSystem::StaticLayers");
+    
+    int width = 0;
+    int height = 0;
+    if (!SDL_GetCurrentRenderOutputSize(mRenderer, &width, &height) || width <= 0 || height <= 0) {
+        for (const auto& pair : mStaticLayers) {
+            DrawStaticLayerDirectly(pair.second);
+        }
+        return;
+    }
+    
+    for (auto& pair : mStaticLayers) {
+        StaticLayer& layer = pair.second;
+        if (layer.items.empty()) continue;
+        
+        bool sizeChanged = layer.width != width || layer.height != height;
+        if (layer.failed && !sizeChanged) {
+            DrawStaticLayerDirectly(layer);
+            continue;
+        }
+        
+        bool cameraChanged = layer.cameraX != mCameraOffsetX || layer.cameraY != mCameraOffsetY;
+        if (!layer.valid || layer.dirty || sizeChanged || cameraChanged || layer.membership != layer.builtMembership) {
+            layer.valid = RebuildStaticLayer(layer, width, height);
+            layer.failed = !layer.valid;
+            if (layer.failed) {
+                // Remember the size that failed so it is retried only once the output changes
+                layer.width = width;
+                layer.height = height;
+            }
+            layer.dirty = false;
+            layer.cameraX = mCameraOffsetX;
+            layer.cameraY = mCameraOffsetY;
+            layer.builtMembership = layer.membership;
+            layer.builtPositionVersion = mPositionVersion;
+            layer.builtRenderableVersion = mRenderableVersion;
+        }
+        
+        if (layer.valid) {
+            SDL_FRect dest = {0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height)};
+            mCommandList.RecordSprite(GetSortLayer(pair.first), layer.texture, dest);
+        } else {
+            DrawStaticLayerDirectly(layer);
         }
     }
 }
 
+void RenderSystem::EnableDebugInfo(bool enable) {
+    if (enable && !mShowDebugInfo) {
+        mDebugOverlay.ResetFrameTimes();
+        mHasLastFrame = false;
+    }
+    mShowDebugInfo = enable;
+}
+
+void RenderSystem::TrackFrameTime() {
+    // Wall time between consecutive frames, independent of the deltaTime callers pass in
+    auto now = std::chrono::steady_clock::now();
+    if (mHasLastFrame) {
+        mDebugOverlay.AddFrameTime(std::chrono::duration<float, std::milli>(now - mLastFrameStart).count());
+    }
+    mLastFrameStart = now;
+    mHasLastFrame = true;
+}
+
+void RenderSystem::RenderDebugInfo(EntityManager& entityManager) {
+    if (!mRenderer) return;
+    LITE2D_TRACE_SCOPE("RenderSystem::DebugInfo");
+    
+    DebugOverlay::RenderInfo info;
+    info.renderItems = mProcessedEntityCount;
+    info.staticLayers = mStaticLayers.size();
+    info.lastSubmit = mCommandList.GetLastSubmitStats();
+    
+    mDebugOverlay.Record(mCommandList, DEBUG_LAYER, entityManager, info);
+}
+
 } // namespace ECS
 } // namespace Lite2D
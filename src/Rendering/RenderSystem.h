@@ -4,7 +4,18 @@
 #include "ECS/EntityManager.h"
 #include "ECS/Components/Position.h"
 #include "ECS/Components/Renderable.h"
+#include "ECS/Systems/EmitterSystem.h"
+#include "RenderCommandList.h"
+#include "DebugOverlay.h"
+#include "VertexBuffer.h"
+#include "SpriteGeometry.h"
+#include "Utils/ThreadPool.h"
 #include <SDL3/SDL.h>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
 
 namespace Lite2D {
 namespace ECS {
@@ -12,11 +23,12 @@ namespace ECS {
 /**
  * Render System
  * Renders entities with Position and Renderable components
+ * Vertex generation can be spread across worker threads; SDL calls stay on the calling thread
  */
 class RenderSystem : public System {
 public:
     RenderSystem(SDL_Renderer* renderer);
-    ~RenderSystem() = default;
+    ~RenderSystem();
     
     // System interface
     void Update(EntityManager& entityManager, float deltaTime) override;
@@ -27,11 +39,41 @@ public:
     // Rendering configuration
     void SetClearColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a);
     void SetRenderOrder(bool ascending = true) { mRenderAscending = ascending; }
-    void EnableDebugInfo(bool enable) { mShowDebugInfo = enable; }
+    void EnableDebugInfo(bool enable);
+    bool IsDebugInfoEnabled() const { return mShowDebugInfo; }
+    
+    // Per-system timings in the debug overlay (enable profiling on the manager to populate them)
+    void SetProfilingSource(const SystemManager* systemManager) { mDebugOverlay.SetSystemManager(systemManager); }
+    
+    // Particles of every emitter are drawn as one geometry batch each, on the emitter's layer
+    void SetEmitterSource(const EmitterSystem* emitterSystem) { mEmitterSource = emitterSystem; }
+    
+    // Threads used to build entity vertices (1 = calling thread only, 0 = hardware concurrency)
+    void SetWorkerThreads(size_t threadCount);
+    size_t GetWorkerThreads() const { return mThreadPool ? mThreadPool->GetThreadCount() : 1; }
+    
+    // Static layers are drawn once into a cached texture and re-blitted each frame.
+    // The cache rebuilds itself when an entity on the layer has its Position or
+    // Renderable written, when an entity joins or leaves the layer (created,
+    // destroyed, hidden or moved to another layer), or when the camera or output
+    // size changes. Writes are detected through the pools' change tracking, which
+    // this turns on: a mutable GetComponent counts as a write, so read static
+    // entities through a const EntityManager. Writes through a pointer kept from an
+    // earlier frame are not seen; report those with MarkStaticLayerDirty. If the
+    // cache can't be built the layer is drawn directly instead.
+    void SetLayerStatic(int layer, bool isStatic = true);
+    bool IsLayerStatic(int layer) const { return mStaticLayers.count(layer) != 0; }
+    void MarkStaticLayerDirty(int layer);
+    void InvalidateStaticLayers();
+    size_t GetStaticLayerRebuildCount() const { return mStaticLayerRebuilds; }
     
     // Camera/viewport
     void SetCamera(float offsetX, float offsetY);
     void GetCamera(float& offsetX, float& offsetY) const;
+    
+    // Command capture for offline profiling - writes the next frame's command list
+    void CaptureNextFrame(const std::string& path) { mCapturePath = path; }
+    const RenderCommandList& GetCommandList() const { return mCommandList; }
 
 private:
     SDL_Renderer* mRenderer;
@@ -43,16 +85,71 @@ private:
     // Rendering helpers
     void ClearScreen();
     void PresentFrame();
-    void RenderEntity(Position* position, Renderable* renderable);
+    void RecordEntities();
     void RenderDebugInfo(EntityManager& entityManager);
+    void TrackFrameTime();
+    int GetSortLayer(int layer) const { return mRenderAscending ? layer : -layer; }
     
     struct RenderItem {
         Entity entity;
-        Position* position;
-        Renderable* renderable;
+        const Position* position;
+        const Renderable* renderable;
     };
     
     std::vector<RenderItem> mRenderItems;
+    
+    // Sorted render items gathered into contiguous arrays for BuildSpriteChunk,
+    // one chunk per thread, each built from a contiguous slice
+    std::unique_ptr<ThreadPool> mThreadPool;
+    std::vector<Position> mSpritePositions;
+    std::vector<Renderable> mSpriteRenderables;
+    std::vector<SpriteChunk> mPrepChunks;
+    
+    void PrepareChunk(size_t begin, size_t end, SpriteChunk& chunk);
+    
+    // Cached render target for one static layer
+    struct StaticLayer {
+        SDL_Texture* texture = nullptr;
+        int width = 0;
+        int height = 0;
+        float cameraX = 0.0f;
+        float cameraY = 0.0f;
+        uint64_t membership = 0;        // Hash of this frame's entities, in draw order
+        uint64_t builtMembership = 0;   // ...and of the ones in the texture
+        uint64_t builtPositionVersion = 0;   // Pool change versions the texture was drawn at
+        uint64_t builtRenderableVersion = 0;
+        bool valid = false;
+        bool dirty = true;
+        bool failed = false;            // Texture couldn't be made, drawn directly until resized
+        std::vector<RenderItem> items;  // This frame's items on the layer
+        VertexBuffer geometry;
+    };
+    
+    // Emitter particle batches, one buffer per emitter
+    const EmitterSystem* mEmitterSource = nullptr;
+    std::vector<VertexBuffer> mEmitterGeometry;
+    void RecordEmitters();
+    
+    std::map<int, StaticLayer> mStaticLayers;
+    size_t mStaticLayerRebuilds = 0;
+    uint64_t mPositionVersion = 0;     // Pool change versions as of this frame's split
+    uint64_t mRenderableVersion = 0;
+    
+    void SplitStaticItems(EntityManager& entityManager);
+    void RecordStaticLayers();
+    bool RebuildStaticLayer(StaticLayer& layer, int width, int height);
+    void DrawStaticLayerDirectly(const StaticLayer& layer);
+    void ReleaseStaticLayers();
+    
+    // Per-frame draw commands, sorted by layer/state and replayed in Update
+    RenderCommandList mCommandList;
+    std::string mCapturePath;
+    
+    // Debug overlay is drawn above every entity layer
+    static constexpr int DEBUG_LAYER = 1 << 30;
+    DebugOverlay mDebugOverlay;
+    std::chrono::steady_clock::time_point mLastFrameStart;
+    bool mHasLastFrame = false;
 };
 
 } // namespace ECS
@@ -0,0 +1,60 @@
+#include "ShapeBatcher.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+constexpr float PI = 3.14159265358979f;
+constexpr float MAX_EDGE_ERROR = 0.25f; // Pixels between chord and arc
+constexpr int MIN_CIRCLE_SEGMENTS = 8;
+constexpr int MAX_CIRCLE_SEGMENTS = 128;
+
+} // namespace
+
+void ShapeBatcher::Clear() {
+    mGeometry.Clear();
+    mShapeCount = 0;
+}
+
+int ShapeBatcher::GetCircleSegments(float radius) {
+    if (radius <= MAX_EDGE_ERROR) return MIN_CIRCLE_SEGMENTS;
+
+    // Sagitta r * (1 - cos(pi / n)) <= MAX_EDGE_ERROR
+    int segments = static_cast<int>(std::ceil(PI / std::acos(1.0f - MAX_EDGE_ERROR / radius)));
+
+    // Round up to a multiple of 4 so nearby radii share a mesh
+    segments = (segments + 3) & ~3;
+    return std::clamp(segments, MIN_CIRCLE_SEGMENTS, MAX_CIRCLE_SEGMENTS);
+}
+
+const std::vector<SDL_FPoint>& ShapeBatcher::GetUnitCircle(int segments) {
+    auto it = mCircleMeshes.find(segments);
+    if (it != mCircleMeshes.end()) {
+        return it->second;
+    }
+
+    std::vector<SDL_FPoint> ring(segments);
+    for (int i = 0; i < segments; ++i) {
+        float angle = 2.0f * PI * i / segments;
+        ring[i] = { std::cos(angle), std::sin(angle) };
+    }
+
+    return mCircleMeshes.emplace(segments, std::move(ring)).first->second;
+}
+
+void ShapeBatcher::AddCircle(float centerX, float centerY, float radius, SDL_Color color) {
+    if (radius <= 0.0f) return;
+
+    const std::vector<SDL_FPoint>& ring = GetUnitCircle(GetCircleSegments(radius));
+    mGeometry.AddFan(centerX, centerY, radius, ring.data(), ring.size(), color);
+    mShapeCount++;
+}
+
+void ShapeBatcher::AddRect(const SDL_FRect& rect, SDL_Color color) {
+    mGeometry.AddQuad(rect, color);
+    mShapeCount++;
+}
+
+bool ShapeBatcher::Submit(SDL_Renderer* renderer) const {
+    return mGeometry.Submit(renderer);
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "VertexBuffer.h"
+#include <SDL3/SDL.h>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Shape Batcher
+ * Collects filled circles and rects into a single triangle list so any number of
+ * colored shapes draw with one SDL_RenderGeometry call. Circle outlines are
+ * tessellated once per segment count and reused for every circle of similar size.
+ */
+class ShapeBatcher {
+public:
+    ShapeBatcher() = default;
+    ~ShapeBatcher() = default;
+
+    // Start a new batch, keeping allocated storage
+    void Clear();
+
+    void AddCircle(float centerX, float centerY, float radius, SDL_Color color);
+    void AddRect(const SDL_FRect& rect, SDL_Color color);
+
+    // Draw everything added since Clear in one call
+    bool Submit(SDL_Renderer* renderer) const;
+
+    // Accessors
+    const VertexBuffer& GetGeometry() const { return mGeometry; }
+    size_t GetShapeCount() const { return mShapeCount; }
+    size_t GetCachedMeshCount() const { return mCircleMeshes.size(); }
+
+    // Segments needed to keep the polygon within a quarter pixel of a true circle
+    static int GetCircleSegments(float radius);
+
+private:
+    VertexBuffer mGeometry;
+    size_t mShapeCount{ 0 };
+
+    // Unit circle rings keyed by segment count
+    std::unordered_map<int, std::vector<SDL_FPoint>> mCircleMeshes;
+
+    const std::vector<SDL_FPoint>& GetUnitCircle(int segments);
+};
@@ -0,0 +1,48 @@
+#include "SpriteGeometry.h"
+#include "Utils/Trace.h"
+
+namespace Lite2D {
+namespace ECS {
+
+SDL_Color GetLayerColor(int layer) {
+    switch (layer) {
+        case 0: return {100, 200, 100, 255}; // Snake body segments - Green
+        case 1: return {200, 100, 100, 255}; // Snake head - Red
+        case 2: return {255, 255, 100, 255}; // Food - Yellow
+        case 3: return {150, 150, 150, 255}; // Walls - Gray
+        default: return {255, 255, 255, 255}; // Default - White
+    }
+}
+
+void AppendSpriteQuads(const Position& position, const Renderable& renderable,
+                       float cameraX, float cameraY, VertexBuffer& geometry) {
+    float screenX = position.x - cameraX;
+    float screenY = position.y - cameraY;
+
+    SDL_Color color = GetLayerColor(renderable.layer);
+    SDL_Color border = {static_cast<Uint8>(color.r / 2), static_cast<Uint8>(color.g / 2),
+                        static_cast<Uint8>(color.b / 2), 255};
+
+    geometry.AddQuad({screenX - 10, screenY - 10, 20, 20}, border);
+    geometry.AddQuad({screenX - 9, screenY - 9, 18, 18}, color);
+}
+
+void BuildSpriteChunk(const Position* positions, const Renderable* renderables, size_t count,
+                      float cameraX, float cameraY, bool ascending, SpriteChunk& chunk) {
+    LITE2D_TRACE_SCOPE("BuildSpriteChunk");
+    chunk.geometry.Reserve(chunk.geometry.GetVertexCount() / 4 + count * 2);
+
+    for (size_t i = 0; i < count; ++i) {
+        int layer = ascending ? renderables[i].layer : -renderables[i].layer;
+
+        if (chunk.runs.empty() || chunk.runs.back().layer != layer) {
+            chunk.runs.push_back({layer, chunk.geometry.GetIndexCount(), 0});
+        }
+
+        AppendSpriteQuads(positions[i], renderables[i], cameraX, cameraY, chunk.geometry);
+        chunk.runs.back().indexCount += 12;
+    }
+}
+
+} // namespace ECS
+} // namespace Lite2D
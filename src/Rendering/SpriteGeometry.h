@@ -0,0 +1,54 @@
+#pragma once
+
+#include "ECS/Components/Position.h"
+#include "ECS/Components/Renderable.h"
+#include "VertexBuffer.h"
+#include <SDL3/SDL.h>
+#include <cstddef>
+#include <vector>
+
+namespace Lite2D {
+namespace ECS {
+
+/**
+ * Sprite vertex building shared by RenderSystem, its tests and benchmarks
+ *
+ * Every sprite is a 20x20 quad in a darker border color with the fill color
+ * inset by one pixel, colored by its Renderable layer. The builder is pure CPU
+ * work, so RenderSystem runs it on worker threads over slices of its sorted
+ * sprites; anything else can call it on plain component arrays.
+ */
+
+// Fill color for a render layer (snake body, head, food, walls, white otherwise)
+SDL_Color GetLayerColor(int layer);
+
+// A run of consecutive quads sharing one sort layer
+struct GeometryRun {
+    int layer;
+    size_t firstIndex;
+    size_t indexCount;
+};
+
+// Vertices built from a contiguous slice of sprites, split into per-layer runs
+struct SpriteChunk {
+    VertexBuffer geometry;
+    std::vector<GeometryRun> runs;
+
+    void Clear() {
+        geometry.Clear();
+        runs.clear();
+    }
+};
+
+// Appends one sprite's border and fill quads, offset by the camera
+void AppendSpriteQuads(const Position& position, const Renderable& renderable,
+                       float cameraX, float cameraY, VertexBuffer& geometry);
+
+// Appends count sprites (positions[i], renderables[i]) to chunk, starting a new run
+// whenever the sort layer changes. Sort layers are the render layers, negated when
+// drawing in descending order; callers sort the sprites by it first.
+void BuildSpriteChunk(const Position* positions, const Renderable* renderables, size_t count,
+                      float cameraX, float cameraY, bool ascending, SpriteChunk& chunk);
+
+} // namespace ECS
+} // namespace Lite2D
@@ -2,6 +2,7 @@
 #include <SDL3_ttf/SDL_ttf.h>   
 
 #include "Texture.h"
+#include "Utils/Trace.h"
 
 constexpr int defaultFontSize = 28;
 
@@ -36,6 +37,7 @@ public:
 
     bool RenderText(std::string text, SDL_Color color, int x, int y, SDL_Renderer* renderer)
     {
+        LITE2D_TRACE_SCOPE("TextRenderer::RenderText");
         if (!mFont) {
             SDL_Log("Font not loaded");
             return false;
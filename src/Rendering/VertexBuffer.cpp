@@ -0,0 +1,63 @@
+#include "VertexBuffer.h"
+
+void VertexBuffer::Clear() {
+    mVertices.clear();
+    mIndices.clear();
+}
+
+void VertexBuffer::Reserve(size_t quadCount) {
+    mVertices.reserve(quadCount * 4);
+    mIndices.reserve(quadCount * 6);
+}
+
+void VertexBuffer::AddQuad(const SDL_FRect& rect, SDL_Color color) {
+    const int base = static_cast<int>(mVertices.size());
+    const SDL_FColor fcolor = { color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f };
+
+    const float left = rect.x;
+    const float top = rect.y;
+    const float right = rect.x + rect.w;
+    const float bottom = rect.y + rect.h;
+
+    mVertices.push_back({ { left, top }, fcolor, { 0.0f, 0.0f } });
+    mVertices.push_back({ { right, top }, fcolor, { 1.0f, 0.0f } });
+    mVertices.push_back({ { right, bottom }, fcolor, { 1.0f, 1.0f } });
+    mVertices.push_back({ { left, bottom }, fcolor, { 0.0f, 1.0f } });
+
+    const int quadIndices[6] = { base, base + 1, base + 2, base, base + 2, base + 3 };
+    mIndices.insert(mIndices.end(), quadIndices, quadIndices + 6);
+}
+
+void VertexBuffer::AddFan(float centerX, float centerY, float radius,
+                          const SDL_FPoint* unitPoints, size_t pointCount, SDL_Color color) {
+    if (pointCount < 3) return;
+
+    const int base = static_cast<int>(mVertices.size());
+    const SDL_FColor fcolor = { color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f };
+
+    mVertices.push_back({ { centerX, centerY }, fcolor, { 0.5f, 0.5f } });
+    for (size_t i = 0; i < pointCount; ++i) {
+        const SDL_FPoint& unit = unitPoints[i];
+        mVertices.push_back({ { centerX + unit.x * radius, centerY + unit.y * radius }, fcolor,
+                              { 0.5f + unit.x * 0.5f, 0.5f + unit.y * 0.5f } });
+    }
+
+    const int count = static_cast<int>(pointCount);
+    for (int i = 0; i < count; ++i) {
+        mIndices.push_back(base);
+        mIndices.push_back(base + 1 + i);
+        mIndices.push_back(base + 1 + (i + 1) % count);
+    }
+}
+
+bool VertexBuffer::Submit(SDL_Renderer* renderer, SDL_Texture* texture,
+                          size_t firstIndex, size_t indexCount) const {
+    if (!renderer || mIndices.empty()) return false;
+
+    if (indexCount == 0) {
+        indexCount = mIndices.size() - firstIndex;
+    }
+
+    return SDL_RenderGeometry(renderer, texture, mVertices.data(), static_cast<int>(mVertices.size()),
+                              mIndices.data() + firstIndex, static_cast<int>(indexCount));
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <cstddef>
+#include <vector>
+
+/**
+ * CPU-side triangle list for SDL_RenderGeometry
+ * Quads are appended as 4 vertices and 6 indices; storage is kept between
+ * frames so refilling a buffer of similar size does not allocate
+ */
+class VertexBuffer {
+public:
+    VertexBuffer() = default;
+    ~VertexBuffer() = default;
+
+    void Clear();
+    void Reserve(size_t quadCount);
+
+    // Axis-aligned solid quad
+    void AddQuad(const SDL_FRect& rect, SDL_Color color);
+
+    // Solid triangle fan around center, unitPoints form a closed ring scaled by radius
+    void AddFan(float centerX, float centerY, float radius,
+                const SDL_FPoint* unitPoints, size_t pointCount, SDL_Color color);
+
+    // Draw a range of indices (whole buffer when indexCount is 0)
+    bool Submit(SDL_Renderer* renderer, SDL_Texture* texture = nullptr,
+                size_t firstIndex = 0, size_t indexCount = 0) const;
+
+    // Accessors
+    size_t GetVertexCount() const { return mVertices.size(); }
+    size_t GetIndexCount() const { return mIndices.size(); }
+    const SDL_Vertex* GetVertices() const { return mVertices.data(); }
+    const int* GetIndices() const { return mIndices.data(); }
+
+private:
+    std::vector<SDL_Vertex> mVertices;
+    std::vector<int> mIndices;
+};
@@ -0,0 +1,74 @@
+// Global operator new/delete replacements feeding AllocationTracker.
+// Only linked when LITE2D_TRACK_ALLOCATIONS is on (and into the unit tests).
+
+#include "AllocationTracker.h"
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+struct HookInstaller {
+    HookInstaller() { Lite2D::AllocationTracker::Detail::gHooksInstalled.store(true, std::memory_order_relaxed); }
+};
+HookInstaller gHookInstaller;
+
+void* Allocate(std::size_t size) {
+    Lite2D::AllocationTracker::Detail::RecordAllocation(size);
+    void* pointer = std::malloc(size ? size : 1);
+    if (!pointer) throw std::bad_alloc();
+    return pointer;
+}
+
+void* AllocateAligned(std::size_t size, std::align_val_t alignment) {
+    Lite2D::AllocationTracker::Detail::RecordAllocation(size);
+    std::size_t align = static_cast<std::size_t>(alignment);
+    // aligned_alloc needs the size to be a multiple of the alignment
+    std::size_t rounded = ((size ? size : 1) + align - 1) / align * align;
+#if defined(_WIN32)
+    void* pointer = _aligned_malloc(rounded, align);
+#else
+    void* pointer = std::aligned_alloc(align, rounded);
+#endif
+    if (!pointer) throw std::bad_alloc();
+    return pointer;
+}
+
+void Free(void* pointer) {
+    if (!pointer) return;
+    Lite2D::AllocationTracker::Detail::RecordFree();
+    std::free(pointer);
+}
+
+void FreeAligned(void* pointer) {
+    if (!pointer) return;
+    Lite2D::AllocationTracker::Detail::RecordFree();
+#if defined(_WIN32)
+    _aligned_free(pointer);
+#else
+    std::free(pointer);
+#endif
+}
+
+} // namespace
+
+void* operator new(std::size_t size) { return Allocate(size); }
+void* operator new[](std::size_t size) { return Allocate(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try { return Allocate(size); } catch (...) { return nullptr; }
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try { return Allocate(size); } catch (...) { return nullptr; }
+}
+void* operator new(std::size_t size, std::align_val_t alignment) { return AllocateAligned(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return AllocateAligned(size, alignment); }
+
+void operator delete(void* pointer) noexcept { Free(pointer); }
+void operator delete[](void* pointer) noexcept { Free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { Free(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { Free(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { Free(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { Free(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { FreeAligned(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { FreeAligned(pointer); }
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept { FreeAligned(pointer); }
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept { FreeAligned(pointer); }
@@ -0,0 +1,73 @@
+#include "AllocationTracker.h"
+
+namespace Lite2D {
+namespace AllocationTracker {
+
+namespace Detail {
+// Constant-initialized, so allocations during static init are counted safely
+std::atomic<size_t> gAllocations{ 0 };
+std::atomic<size_t> gBytes{ 0 };
+std::atomic<size_t> gFrees{ 0 };
+std::atomic<bool> gHooksInstalled{ false };
+thread_local size_t tThreadAllocations = 0;
+thread_local size_t tThreadBytes = 0;
+} // namespace Detail
+
+namespace {
+AllocationStats gFrameStart;
+AllocationStats gLastFrame;
+
+AllocationStats Difference(const AllocationStats& end, const AllocationStats& start) {
+    AllocationStats stats;
+    stats.allocations = end.allocations - start.allocations;
+    stats.bytes = end.bytes - start.bytes;
+    stats.frees = end.frees - start.frees;
+    return stats;
+}
+} // namespace
+
+bool IsEnabled() {
+    return Detail::gHooksInstalled.load(std::memory_order_relaxed);
+}
+
+AllocationStats GetTotals() {
+    AllocationStats stats;
+    stats.allocations = Detail::gAllocations.load(std::memory_order_relaxed);
+    stats.bytes = Detail::gBytes.load(std::memory_order_relaxed);
+    stats.frees = Detail::gFrees.load(std::memory_order_relaxed);
+    return stats;
+}
+
+size_t GetAllocationCount() {
+    return Detail::gAllocations.load(std::memory_order_relaxed);
+}
+
+size_t GetAllocatedBytes() {
+    return Detail::gBytes.load(std::memory_order_relaxed);
+}
+
+size_t GetThreadAllocationCount() {
+    return Detail::tThreadAllocations;
+}
+
+size_t GetThreadAllocatedBytes() {
+    return Detail::tThreadBytes;
+}
+
+AllocationStats MarkFrame() {
+    AllocationStats now = GetTotals();
+    gLastFrame = Difference(now, gFrameStart);
+    gFrameStart = now;
+    return gLastFrame;
+}
+
+const AllocationStats& GetLastFrame() {
+    return gLastFrame;
+}
+
+AllocationStats Scope::GetStats() const {
+    return Difference(GetTotals(), mStart);
+}
+
+} // namespace AllocationTracker
+} // namespace Lite2D
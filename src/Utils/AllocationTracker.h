@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+/**
+ * Heap allocation counters fed by global operator new/delete hooks
+ *
+ * The hooks live in AllocationHooks.cpp and are opt-in: configure with
+ * -DLITE2D_TRACK_ALLOCATIONS=ON to link them into the engine. Without them
+ * IsEnabled() is false and every counter stays at zero.
+ *
+ *   AllocationTracker::Scope scope;
+ *   movementSystem.Update(entityManager, dt);
+ *   EXPECT_EQ(scope.GetStats().allocations, 0u);
+ *
+ * The totals (and Scope, MarkFrame) are global relaxed atomics, so they include
+ * every thread's allocations. The GetThread* counters only see the calling
+ * thread; SystemManager uses them so per-system counts stay right when several
+ * worlds are stepped at once (WorldScheduler), though work a system hands to a
+ * thread pool is then not charged to it.
+ */
+namespace Lite2D {
+namespace AllocationTracker {
+
+struct AllocationStats {
+    size_t allocations = 0;
+    size_t bytes = 0;           // Requested bytes, not including allocator overhead
+    size_t frees = 0;
+};
+
+// True once the operator new/delete hooks are linked in
+bool IsEnabled();
+
+// Running totals since startup
+AllocationStats GetTotals();
+size_t GetAllocationCount();
+size_t GetAllocatedBytes();
+
+// Running totals for the calling thread only
+size_t GetThreadAllocationCount();
+size_t GetThreadAllocatedBytes();
+
+// Close the current frame: returns and remembers what was allocated since the previous call.
+// The counters are process-wide, so only the game loop calls this, once per frame;
+// everything else (e.g. the debug overlay) reads GetLastFrame()
+AllocationStats MarkFrame();
+const AllocationStats& GetLastFrame();
+
+/**
+ * Allocations made between construction and GetStats()
+ */
+class Scope {
+public:
+    Scope() : mStart(GetTotals()) {}
+
+    AllocationStats GetStats() const;
+
+private:
+    AllocationStats mStart;
+};
+
+namespace Detail {
+extern std::atomic<size_t> gAllocations;
+extern std::atomic<size_t> gBytes;
+extern std::atomic<size_t> gFrees;
+extern std::atomic<bool> gHooksInstalled;
+extern thread_local size_t tThreadAllocations;
+extern thread_local size_t tThreadBytes;
+
+inline void RecordAllocation(size_t size) {
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    gBytes.fetch_add(size, std::memory_order_relaxed);
+    ++tThreadAllocations;
+    tThreadBytes += size;
+}
+
+inline void RecordFree() {
+    gFrees.fetch_add(1, std::memory_order_relaxed);
+}
+} // namespace Detail
+
+} // namespace AllocationTracker
+} // namespace Lite2D
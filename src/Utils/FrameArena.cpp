@@ -0,0 +1,71 @@
+#include "FrameArena.h"
+#include <algorithm>
+
+namespace Lite2D {
+
+FrameArena::FrameArena(size_t initialCapacity)
+    : mInitialCapacity(std::max<size_t>(initialCapacity, 1)) {
+}
+
+void* FrameArena::Allocate(size_t size, size_t alignment) {
+    if (size == 0) size = 1;
+
+    while (true) {
+        if (mCurrentBlock < mBlocks.size()) {
+            Block& block = mBlocks[mCurrentBlock];
+            uintptr_t base = reinterpret_cast<uintptr_t>(block.memory.get());
+            uintptr_t aligned = (base + mOffset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+            size_t newOffset = static_cast<size_t>(aligned - base) + size;
+
+            if (newOffset <= block.size) {
+                mUsedBytes += newOffset - mOffset;
+                mPeakBytes = std::max(mPeakBytes, mUsedBytes);
+                mOffset = newOffset;
+                return reinterpret_cast<void*>(aligned);
+            }
+
+            // Try the next block (left over from an earlier spill), or grow
+            mCurrentBlock++;
+            mOffset = 0;
+            continue;
+        }
+
+        AddBlock(size + alignment);
+    }
+}
+
+void FrameArena::Reset() {
+    // Merge spilled blocks so the next frame fits in one
+    if (mBlocks.size() > 1) {
+        size_t capacity = GetCapacity();
+        mBlocks.clear();
+        AddBlock(capacity);
+    }
+
+    mCurrentBlock = 0;
+    mOffset = 0;
+    mUsedBytes = 0;
+}
+
+size_t FrameArena::GetCapacity() const {
+    size_t capacity = 0;
+    for (const Block& block : mBlocks) {
+        capacity += block.size;
+    }
+    return capacity;
+}
+
+void FrameArena::AddBlock(size_t minimumSize) {
+    // Grow geometrically so a growing workload settles after a few frames
+    size_t size = mBlocks.empty() ? mInitialCapacity : mBlocks.back().size * 2;
+    size = std::max(size, minimumSize);
+
+    Block block;
+    block.memory.reset(new std::byte[size]); // Left uninitialized, unlike make_unique
+    block.size = size;
+    mBlocks.push_back(std::move(block));
+    mCurrentBlock = mBlocks.size() - 1;
+    mOffset = 0;
+}
+
+} // namespace Lite2D
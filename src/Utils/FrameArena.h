@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace Lite2D {
+
+/**
+ * Frame Arena
+ * Linear allocator for data that only lives for one frame (query results, scratch lists).
+ * Allocation is a pointer bump, individual frees are no-ops and Reset() releases
+ * everything at once. If a frame outgrows the arena it spills into extra blocks, and the
+ * next Reset() merges them into one block, so steady-state frames make no heap calls.
+ * Not thread-safe: allocate from the thread that owns the arena.
+ */
+class FrameArena {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 64 * 1024;
+
+    // Memory is reserved on first use
+    explicit FrameArena(size_t initialCapacity = DEFAULT_CAPACITY);
+    ~FrameArena() = default;
+
+    // Delete copy constructor and assignment operator
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    template<typename T>
+    T* AllocateArray(size_t count) {
+        return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    // Release every allocation made since the last reset
+    void Reset();
+
+    size_t GetUsedBytes() const { return mUsedBytes; }
+    size_t GetPeakBytes() const { return mPeakBytes; }
+    size_t GetCapacity() const;
+    size_t GetBlockCount() const { return mBlocks.size(); }
+
+private:
+    struct Block {
+        std::unique_ptr<std::byte[]> memory;
+        size_t size = 0;
+    };
+
+    std::vector<Block> mBlocks;
+    size_t mCurrentBlock = 0;
+    size_t mOffset = 0;              // Bump offset within mBlocks[mCurrentBlock]
+    size_t mUsedBytes = 0;           // Including alignment padding
+    size_t mPeakBytes = 0;
+    size_t mInitialCapacity;
+
+    void AddBlock(size_t minimumSize);
+};
+
+/**
+ * Standard allocator over a FrameArena, for containers that live within one frame
+ */
+template<typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(FrameArena& arena) noexcept : mArena(&arena) {}
+
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : mArena(other.GetArena()) {}
+
+    T* allocate(size_t count) { return mArena->AllocateArray<T>(count); }
+    void deallocate(T*, size_t) noexcept {} // Reclaimed by FrameArena::Reset
+
+    FrameArena* GetArena() const noexcept { return mArena; }
+
+    template<typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept { return mArena == other.GetArena(); }
+    template<typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept { return mArena != other.GetArena(); }
+
+private:
+    FrameArena* mArena;
+};
+
+// Vector whose storage comes from a frame arena; must not outlive the arena's next Reset()
+template<typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+} // namespace Lite2D
@@ -0,0 +1,138 @@
+#include "MappedFile.h"
+#include <iostream>
+#include <utility>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Lite2D {
+
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Close();
+        std::swap(mData, other.mData);
+        std::swap(mSize, other.mSize);
+        std::swap(mOpen, other.mOpen);
+#if defined(_WIN32)
+        std::swap(mFileHandle, other.mFileHandle);
+        std::swap(mMappingHandle, other.mMappingHandle);
+#endif
+    }
+    return *this;
+}
+
+#if defined(_WIN32)
+
+bool MappedFile::Open(const std::string& path) {
+    Close();
+
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        std::cerr << "Failed to open file for mapping: " << path << std::endl;
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        return false;
+    }
+
+    mFileHandle = file;
+    mSize = static_cast<size_t>(size.QuadPart);
+    mOpen = true;
+    if (mSize == 0) {
+        return true; // Zero-length files can't be mapped
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view) {
+        std::cerr << "Failed to map file: " << path << std::endl;
+        if (mapping) CloseHandle(mapping);
+        Close();
+        return false;
+    }
+
+    mMappingHandle = mapping;
+    mData = static_cast<const uint8_t*>(view);
+    return true;
+}
+
+void MappedFile::Close() {
+    if (mData) UnmapViewOfFile(mData);
+    if (mMappingHandle) CloseHandle(static_cast<HANDLE>(mMappingHandle));
+    if (mFileHandle) CloseHandle(static_cast<HANDLE>(mFileHandle));
+    mData = nullptr;
+    mMappingHandle = nullptr;
+    mFileHandle = nullptr;
+    mSize = 0;
+    mOpen = false;
+}
+
+#else
+
+bool MappedFile::Open(const std::string& path) {
+    Close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "Failed to open file for mapping: " << path << std::endl;
+        return false;
+    }
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    mSize = static_cast<size_t>(info.st_size);
+    mOpen = true;
+    if (mSize == 0) {
+        ::close(fd);
+        return true; // Zero-length files can't be mapped
+    }
+
+    // Private mapping: pages are shared with the page cache until written (never, here)
+    void* view = ::mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // The mapping keeps the file referenced
+    if (view == MAP_FAILED) {
+        std::cerr << "Failed to map file: " << path << std::endl;
+        mSize = 0;
+        mOpen = false;
+        return false;
+    }
+
+    // Readers walk the file front to back once; start readahead now
+    ::madvise(view, mSize, MADV_SEQUENTIAL);
+    ::madvise(view, mSize, MADV_WILLNEED);
+    mData = static_cast<const uint8_t*>(view);
+    return true;
+}
+
+void MappedFile::Close() {
+    if (mData) {
+        ::munmap(const_cast<uint8_t*>(mData), mSize);
+    }
+    mData = nullptr;
+    mSize = 0;
+    mOpen = false;
+}
+
+#endif
+
+} // namespace Lite2D
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Lite2D {
+
+/**
+ * Mapped File
+ * Read-only, private memory mapping of a whole file (mmap, or MapViewOfFile on
+ * Windows). Pages are faulted in from the page cache on first touch instead of
+ * being read into a heap buffer up front, so opening a large file costs the
+ * same as opening a small one and only the bytes actually read are paged in.
+ * The mapping is released by Close() or the destructor.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile() { Close(); }
+
+    // Move-only: one owner per mapping
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    // Maps the whole file; an empty file opens with a null data pointer and size 0
+    bool Open(const std::string& path);
+    void Close();
+
+    bool IsOpen() const { return mOpen; }
+    const uint8_t* GetData() const { return mData; }
+    size_t GetSize() const { return mSize; }
+
+private:
+    const uint8_t* mData = nullptr;
+    size_t mSize = 0;
+    bool mOpen = false;
+#if defined(_WIN32)
+    void* mFileHandle = nullptr;
+    void* mMappingHandle = nullptr;
+#endif
+};
+
+} // namespace Lite2D
@@ -0,0 +1,114 @@
+#include "Random.h"
+
+namespace Lite2D {
+
+namespace {
+
+uint64_t SplitMix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/**
+ * Sixteen xoshiro128 generators stepped in lockstep, one per array slot, so each
+ * step is a few vector shifts and xors. Lanes are seeded from the parent stream,
+ * which keeps a fill as deterministic as scalar draws. Floats use the + scrambler
+ * (only the high bits are kept), raw output uses **.
+ */
+template<bool StarStar, typename Output>
+void GenerateLanes(Random& parent, size_t blocks, Output output) {
+    // Local state so the compiler knows the output can't alias it
+    uint32_t s0[Random::BATCH_LANES], s1[Random::BATCH_LANES], s2[Random::BATCH_LANES], s3[Random::BATCH_LANES];
+    for (size_t lane = 0; lane < Random::BATCH_LANES; ++lane) {
+        s0[lane] = parent.NextUInt32();
+        s1[lane] = parent.NextUInt32() | 1u; // Never all zero
+        s2[lane] = parent.NextUInt32();
+        s3[lane] = parent.NextUInt32();
+    }
+    
+    for (size_t block = 0; block < blocks; ++block) {
+        for (size_t lane = 0; lane < Random::BATCH_LANES; ++lane) {
+            uint32_t result = s0[lane] + s3[lane];
+            if (StarStar) {
+                const uint32_t x = s1[lane] * 5;
+                result = ((x << 7) | (x >> 25)) * 9;
+            }
+            const uint32_t t = s1[lane] << 9;
+            s2[lane] ^= s0[lane];
+            s3[lane] ^= s1[lane];
+            s1[lane] ^= s2[lane];
+            s0[lane] ^= s3[lane];
+            s2[lane] ^= t;
+            s3[lane] = (s3[lane] << 11) | (s3[lane] >> 21);
+            output(block * Random::BATCH_LANES + lane, result);
+        }
+    }
+}
+
+} // namespace
+
+void Random::Seed(uint64_t seed) {
+    mSeed = seed;
+    uint64_t state = seed;
+    const uint64_t a = SplitMix64(state);
+    const uint64_t b = SplitMix64(state);
+    mState[0] = static_cast<uint32_t>(a);
+    mState[1] = static_cast<uint32_t>(a >> 32);
+    mState[2] = static_cast<uint32_t>(b);
+    mState[3] = static_cast<uint32_t>(b >> 32);
+    if ((mState[0] | mState[1] | mState[2] | mState[3]) == 0) {
+        mState[0] = 1;
+    }
+}
+
+uint64_t Random::DeriveSeed(uint64_t seed, uint64_t streamId) {
+    uint64_t state = streamId;
+    uint64_t mixed = seed ^ SplitMix64(state);
+    return SplitMix64(mixed);
+}
+
+uint64_t Random::HashName(const char* name) {
+    // FNV-1a
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (const char* c = name; c && *c; ++c) {
+        hash ^= static_cast<unsigned char>(*c);
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+void Random::Fill(float* out, size_t count, float min, float max) {
+    const float scale = (max - min) * FLOAT_UNIT;
+    size_t i = 0;
+
+    if (count >= MIN_BATCH) {
+        const size_t blocks = count / BATCH_LANES;
+        GenerateLanes<false>(*this, blocks, [out, min, scale](size_t index, uint32_t bits) {
+            // 24-bit value fits a signed int, which converts to float in one vector instruction
+            out[index] = min + static_cast<float>(static_cast<int32_t>(bits >> 8)) * scale;
+        });
+        i = blocks * BATCH_LANES;
+    }
+
+    for (; i < count; ++i) {
+        out[i] = min + static_cast<float>(NextUInt32() >> 8) * scale;
+    }
+}
+
+void Random::Fill(uint32_t* out, size_t count) {
+    size_t i = 0;
+
+    if (count >= MIN_BATCH) {
+        const size_t blocks = count / BATCH_LANES;
+        GenerateLanes<true>(*this, blocks, [out](size_t index, uint32_t bits) { out[index] = bits; });
+        i = blocks * BATCH_LANES;
+    }
+
+    for (; i < count; ++i) {
+        out[i] = NextUInt32();
+    }
+}
+
+} // namespace Lite2D
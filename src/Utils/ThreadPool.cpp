@@ -0,0 +1,85 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+ThreadPool::ThreadPool(size_t threadCount) {
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // The calling thread works the first chunk, so spawn one fewer
+    mWorkers.reserve(threadCount - 1);
+    for (size_t i = 1; i < threadCount; ++i) {
+        mWorkers.emplace_back(&ThreadPool::WorkerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mWorkAvailable.notify_all();
+
+    for (std::thread& worker : mWorkers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::RunChunk(const RangeFunction& func, size_t count, size_t chunkIndex) const {
+    const size_t chunks = GetThreadCount();
+    const size_t begin = count * chunkIndex / chunks;
+    const size_t end = count * (chunkIndex + 1) / chunks;
+    if (begin < end) {
+        func(begin, end, chunkIndex);
+    }
+}
+
+void ThreadPool::ParallelFor(size_t count, const RangeFunction& func) {
+    if (count == 0) return;
+
+    if (mWorkers.empty()) {
+        func(0, count, 0);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mJob = &func;
+        mJobCount = count;
+        mPendingWorkers = mWorkers.size();
+        mJobGeneration++;
+    }
+    mWorkAvailable.notify_all();
+
+    RunChunk(func, count, 0);
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mWorkDone.wait(lock, [this] { return mPendingWorkers == 0; });
+    mJob = nullptr;
+}
+
+void ThreadPool::WorkerLoop(size_t workerIndex) {
+    size_t seenGeneration = 0;
+
+    while (true) {
+        const RangeFunction* job = nullptr;
+        size_t count = 0;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mWorkAvailable.wait(lock, [&] { return mStopping || mJobGeneration != seenGeneration; });
+            if (mStopping) return;
+
+            seenGeneration = mJobGeneration;
+            job = mJob;
+            count = mJobCount;
+        }
+
+        RunChunk(*job, count, workerIndex);
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mPendingWorkers--;
+        }
+        mWorkDone.notify_one();
+    }
+}
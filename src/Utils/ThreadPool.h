@@ -0,0 +1,47 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Fixed-size worker pool for data-parallel frame work
+ * ParallelFor splits a range into one contiguous chunk per thread, runs the first
+ * chunk on the calling thread and blocks until every chunk has finished
+ */
+class ThreadPool {
+public:
+    // Total thread count including the calling thread, 0 = hardware concurrency
+    explicit ThreadPool(size_t threadCount = 0);
+    ~ThreadPool();
+
+    // Delete copy constructor and assignment operator
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // func(begin, end, chunkIndex) is called once per non-empty chunk of [0, count)
+    using RangeFunction = std::function<void(size_t begin, size_t end, size_t chunkIndex)>;
+    void ParallelFor(size_t count, const RangeFunction& func);
+
+    size_t GetThreadCount() const { return mWorkers.size() + 1; }
+
+private:
+    std::vector<std::thread> mWorkers;
+
+    std::mutex mMutex;
+    std::condition_variable mWorkAvailable;
+    std::condition_variable mWorkDone;
+
+    // Current job, guarded by mMutex
+    const RangeFunction* mJob{ nullptr };
+    size_t mJobCount{ 0 };
+    size_t mJobGeneration{ 0 };
+    size_t mPendingWorkers{ 0 };
+    bool mStopping{ false };
+
+    void WorkerLoop(size_t workerIndex);
+    void RunChunk(const RangeFunction& func, size_t count, size_t chunkIndex) const;
+};
@@ -0,0 +1,217 @@
+#include "Trace.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <SDL3/SDL.h>
+
+namespace Lite2D {
+namespace Trace {
+
+namespace {
+
+struct TraceEvent {
+    const char* name;
+    uint64_t startNs;
+    uint64_t endNs;
+};
+
+// Events recorded by one thread. Only the owner writes events; the count is
+// published with release so exporters read fully written entries.
+struct ThreadBuffer {
+    static constexpr size_t CAPACITY = 1 << 16;
+
+    std::vector<TraceEvent> events;  // Sized to CAPACITY on the owner's first event
+    std::atomic<size_t> count{ 0 };
+    std::atomic<size_t> dropped{ 0 };
+    uint32_t threadId = 0;
+    std::string threadName;
+    bool exited = false;             // Owner thread is gone, guarded by gRegistryMutex
+};
+
+// Buffers are shared with the registry so they outlive their threads
+std::mutex gRegistryMutex;
+std::vector<std::shared_ptr<ThreadBuffer>> gBuffers;
+uint32_t gNextThreadId = 0;
+
+std::chrono::steady_clock::time_point gEpoch = std::chrono::steady_clock::now();
+
+// Flags the buffer as reusable when its thread exits
+struct ThreadBufferOwner {
+    std::shared_ptr<ThreadBuffer> buffer;
+
+    ~ThreadBufferOwner() {
+        if (buffer) {
+            std::lock_guard<std::mutex> lock(gRegistryMutex);
+            buffer->exited = true;
+        }
+    }
+};
+
+ThreadBuffer& GetThreadBuffer() {
+    thread_local ThreadBufferOwner owner;
+    if (!owner.buffer) {
+        std::lock_guard<std::mutex> lock(gRegistryMutex);
+
+        // Take over an exited thread's buffer if nothing in it is left to export
+        for (auto& buffer : gBuffers) {
+            if (buffer->exited && buffer->count.load(std::memory_order_relaxed) == 0) {
+                owner.buffer = buffer;
+                break;
+            }
+        }
+        if (!owner.buffer) {
+            owner.buffer = std::make_shared<ThreadBuffer>();
+            gBuffers.push_back(owner.buffer);
+        }
+
+        ThreadBuffer& buffer = *owner.buffer;
+        buffer.exited = false;
+        buffer.dropped.store(0, std::memory_order_relaxed);
+        buffer.threadId = gNextThreadId++;
+        buffer.threadName = buffer.threadId == 0 ? "Main" : "Thread " + std::to_string(buffer.threadId);
+    }
+    return *owner.buffer;
+}
+
+void WriteJsonString(std::ofstream& out, const std::string& text) {
+    out << '"';
+    for (char c : text) {
+        switch (c) {
+            case '"':  out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            default:
+                if (static_cast<unsigned char>(c) >= 0x20) out << c;
+                break;
+        }
+    }
+    out << '"';
+}
+
+} // namespace
+
+namespace Detail {
+
+std::atomic<bool> gCapturing{ false };
+
+uint64_t NowNanoseconds() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - gEpoch).count());
+}
+
+void RecordEvent(const char* name, uint64_t startNs, uint64_t endNs) {
+    ThreadBuffer& buffer = GetThreadBuffer();
+    size_t index = buffer.count.load(std::memory_order_relaxed);
+    if (index >= ThreadBuffer::CAPACITY) {
+        buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    if (buffer.events.empty()) {
+        // Once per buffer; the lock keeps GetBufferMemory from seeing a half-grown vector
+        std::lock_guard<std::mutex> lock(gRegistryMutex);
+        buffer.events.resize(ThreadBuffer::CAPACITY);
+    }
+
+    buffer.events[index] = { name, startNs, endNs };
+    buffer.count.store(index + 1, std::memory_order_release);
+}
+
+} // namespace Detail
+
+void Start() {
+    {
+        std::lock_guard<std::mutex> lock(gRegistryMutex);
+
+        // The previous capture is discarded, so exited threads' buffers can go
+        gBuffers.erase(std::remove_if(gBuffers.begin(), gBuffers.end(),
+                                      [](const std::shared_ptr<ThreadBuffer>& buffer) { return buffer->exited; }),
+                       gBuffers.end());
+        for (auto& buffer : gBuffers) {
+            buffer->count.store(0, std::memory_order_relaxed);
+            buffer->dropped.store(0, std::memory_order_relaxed);
+        }
+        gEpoch = std::chrono::steady_clock::now();
+    }
+
+    // Register the calling thread first so it is exported as the main thread
+    GetThreadBuffer();
+    Detail::gCapturing.store(true, std::memory_order_release);
+}
+
+void Stop() {
+    Detail::gCapturing.store(false, std::memory_order_release);
+}
+
+void SetThreadName(const std::string& name) {
+    ThreadBuffer& buffer = GetThreadBuffer();
+    std::lock_guard<std::mutex> lock(gRegistryMutex);
+    buffer.threadName = name;
+}
+
+size_t GetEventCount() {
+    std::lock_guard<std::mutex> lock(gRegistryMutex);
+    size_t total = 0;
+    for (const auto& buffer : gBuffers) {
+        total += buffer->count.load(std::memory_order_acquire);
+    }
+    return total;
+}
+
+size_t GetDroppedEventCount() {
+    std::lock_guard<std::mutex> lock(gRegistryMutex);
+    size_t total = 0;
+    for (const auto& buffer : gBuffers) {
+        total += buffer->dropped.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+size_t GetBufferMemory() {
+    std::lock_guard<std::mutex> lock(gRegistryMutex);
+    size_t total = 0;
+    for (const auto& buffer : gBuffers) {
+        total += buffer->events.capacity() * sizeof(TraceEvent);
+    }
+    return total;
+}
+
+bool WriteChromeTrace(const std::string& path) {
+    std::ofstream out(path);
+    if (!out) {
+        SDL_Log("Failed to open trace file: %s", path.c_str());
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(gRegistryMutex);
+
+    // Complete ("X") events with microsecond timestamps, plus thread name metadata
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    for (const auto& buffer : gBuffers) {
+        out << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+            << buffer->threadId << ",\"args\":{\"name\":";
+        WriteJsonString(out, buffer->threadName);
+        out << "}}";
+        first = false;
+
+        const size_t count = buffer->count.load(std::memory_order_acquire);
+        for (size_t i = 0; i < count; ++i) {
+            const TraceEvent& event = buffer->events[i];
+            out << ",\n{\"name\":";
+            WriteJsonString(out, event.name);
+            out << ",\"cat\":\"lite2d\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadId
+                << ",\"ts\":" << (event.startNs / 1000) << '.' << ((event.startNs % 1000) / 100)
+                << ",\"dur\":" << ((event.endNs - event.startNs) / 1000) << '.'
+                << (((event.endNs - event.startNs) % 1000) / 100) << "}";
+        }
+    }
+    out << "\n]}\n";
+
+    return static_cast<bool>(out);
+}
+
+} // namespace Trace
+} // namespace Lite2D
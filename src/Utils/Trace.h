@@ -0,0 +1,91 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * Scoped trace markers exported as Chrome Trace Event JSON (chrome://tracing, Perfetto)
+ *
+ *   LITE2D_TRACE_SCOPE("RenderSystem::Submit");
+ *
+ * Names must outlive the capture (string literals, System::GetName()).
+ * Events go to a fixed-size buffer owned by the recording thread, so recording takes
+ * no locks. Outside a capture a marker costs one relaxed atomic load. A buffer's
+ * storage is allocated on its thread's first event. Buffers of exited threads are
+ * kept for export, released by the next Start(), and reused by new threads once
+ * their events have been discarded.
+ * Configure with -DLITE2D_ENABLE_TRACING=OFF to compile every marker out.
+ */
+#ifndef LITE2D_TRACING_ENABLED
+#define LITE2D_TRACING_ENABLED 1
+#endif
+
+namespace Lite2D {
+namespace Trace {
+
+// Begin a capture, discarding previously recorded events.
+// Call while no other thread is recording (e.g. between frames).
+void Start();
+void Stop();
+
+// Write every recorded event as Chrome Trace Event JSON
+bool WriteChromeTrace(const std::string& path);
+
+// Label the calling thread in the exported trace
+void SetThreadName(const std::string& name);
+
+// Recorded / dropped (buffer full) event totals across all threads
+size_t GetEventCount();
+size_t GetDroppedEventCount();
+
+// Bytes of event storage currently held across all thread buffers
+size_t GetBufferMemory();
+
+namespace Detail {
+extern std::atomic<bool> gCapturing;
+uint64_t NowNanoseconds();
+void RecordEvent(const char* name, uint64_t startNs, uint64_t endNs);
+} // namespace Detail
+
+inline bool IsCapturing() {
+    return Detail::gCapturing.load(std::memory_order_relaxed);
+}
+
+/**
+ * Records one complete event covering its own lifetime
+ */
+class ScopedTrace {
+public:
+    explicit ScopedTrace(const char* name) : mName(IsCapturing() ? name : nullptr) {
+        if (mName) {
+            mStartNs = Detail::NowNanoseconds();
+        }
+    }
+
+    ~ScopedTrace() {
+        if (mName) {
+            Detail::RecordEvent(mName, mStartNs, Detail::NowNanoseconds());
+        }
+    }
+
+    ScopedTrace(const ScopedTrace&) = delete;
+    ScopedTrace& operator=(const ScopedTrace&) = delete;
+
+private:
+    const char* mName;
+    uint64_t mStartNs{ 0 };
+};
+
+} // namespace Trace
+} // namespace Lite2D
+
+#define LITE2D_TRACE_CONCAT_INNER(a, b) a##b
+#define LITE2D_TRACE_CONCAT(a, b) LITE2D_TRACE_CONCAT_INNER(a, b)
+
+#if LITE2D_TRACING_ENABLED
+#define LITE2D_TRACE_SCOPE(name) ::Lite2D::Trace::ScopedTrace LITE2D_TRACE_CONCAT(lite2dTraceScope_, __LINE__)(name)
+#else
+#define LITE2D_TRACE_SCOPE(name) ((void)0)
+#endif
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <new>
+#include <thread>
+#include "Utils/AllocationTracker.h"
+#include "ECS/EntityManager.h"
+#include "ECS/SystemManager.h"
+#include "ECS/Systems/MovementSystem.h"
+#include "ECS/Components/Position.h"
+#include "ECS/Components/Velocity.h"
+
+using namespace Lite2D;
+using namespace Lite2D::ECS;
+
+// System that allocates its query every frame, the pattern the tracker is meant to catch
+class AllocatingQuerySystem : public System {
+public:
+    void Update(EntityManager& entityManager, float deltaTime) override {
+        auto entities = entityManager.GetEntitiesWith<Position>();
+        mProcessedEntityCount = entities.size();
+    }
+    void Initialize(EntityManager& entityManager) override {}
+    void Shutdown(EntityManager& entityManager) override {}
+    const char* GetName() const override { return "AllocatingQuerySystem"; }
+};
+
+class AllocationTrackerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_TRUE(AllocationTracker::IsEnabled());
+
+        entityManager = std::make_unique<EntityManager>();
+        for (int i = 0; i < 1000; ++i) {
+            Entity entity = entityManager->CreateEntity();
+            entityManager->AddComponent(entity, Position(static_cast<float>(i), 0.0f));
+            entityManager->AddComponent(entity, Velocity(1.0f, 2.0f));
+        }
+    }
+
+    std::unique_ptr<EntityManager> entityManager;
+};
+
+// Test that hooked allocations are counted with their size
+TEST_F(AllocationTrackerTest, CountsAllocationsAndBytes) {
+    AllocationTracker::Scope scope;
+
+    // Direct operator calls, a new-expression could be optimized away
+    void* block = ::operator new(256);
+    ::operator delete(block);
+
+    AllocationTracker::AllocationStats stats = scope.GetStats();
+    EXPECT_EQ(stats.allocations, 1u);
+    EXPECT_EQ(stats.bytes, 256u);
+    EXPECT_EQ(stats.frees, 1u);
+}
+
+// Test per-frame totals
+TEST_F(AllocationTrackerTest, MarkFrame) {
+    AllocationTracker::MarkFrame();
+
+    void* first = ::operator new(64);
+    void* second = ::operator new(32);
+    ::operator delete(first);
+    ::operator delete(second);
+
+    AllocationTracker::AllocationStats frame = AllocationTracker::MarkFrame();
+    EXPECT_EQ(frame.allocations, 2u);
+    EXPECT_EQ(frame.bytes, 96u);
+    EXPECT_EQ(AllocationTracker::GetLastFrame().allocations, 2u);
+
+    EXPECT_EQ(AllocationTracker::MarkFrame().allocations, 0u);
+}
+
+// Test that MovementSystem makes no heap allocations once warmed up
+TEST_F(AllocationTrackerTest, MovementSystemSteadyStateIsAllocationFree) {
+    MovementSystem movementSystem;
+    movementSystem.EnableBoundaryClamping(true);
+    movementSystem.Update(*entityManager, 0.016f); // Sizes the query buffer
+
+    AllocationTracker::Scope scope;
+    for (int frame = 0; frame < 100; ++frame) {
+        movementSystem.Update(*entityManager, 0.016f);
+    }
+
+    EXPECT_EQ(scope.GetStats().allocations, 0u);
+    EXPECT_EQ(movementSystem.GetProcessedEntityCount(), 1000u);
+}
+
+// Test per-system allocation counts through SystemManager profiling
+TEST_F(AllocationTrackerTest, PerSystemAllocations) {
+    SystemManager systemManager;
+    systemManager.RegisterSystem<MovementSystem>();
+    systemManager.RegisterSystem<AllocatingQuerySystem>();
+    systemManager.EnableProfiling(true); // Counts through AllocationTracker by default
+
+    for (int frame = 0; frame < 10; ++frame) {
+        systemManager.UpdateSystems(*entityManager, 0.016f);
+    }
+
+    const SystemStats* movementStats = systemManager.GetSystemStats("MovementSystem");
+    ASSERT_NE(movementStats, nullptr);
+    EXPECT_EQ(movementStats->GetLastSample().allocations, 0u);
+    EXPECT_EQ(movementStats->GetLastSample().allocatedBytes, 0u);
+
+    const SystemStats* queryStats = systemManager.GetSystemStats("AllocatingQuerySystem");
+    ASSERT_NE(queryStats, nullptr);
+    EXPECT_EQ(queryStats->GetLastSample().allocations, 1u);
+    EXPECT_GE(queryStats->GetLastSample().allocatedBytes, 1000u * sizeof(Entity));
+}
+
+// Test that another thread's allocations are not charged to the system running meanwhile
+TEST_F(AllocationTrackerTest, PerSystemAllocationsIgnoreOtherThreads) {
+    std::atomic<int> requested{ 0 };
+    std::atomic<int> served{ 0 };
+    std::atomic<bool> stop{ false };
+    std::thread worker([&]() {
+        int done = 0;
+        while (!stop.load()) {
+            if (requested.load() == done) {
+                std::this_thread::yield();
+                continue;
+            }
+            for (int i = 0; i < 5; ++i) {
+                ::operator delete(::operator new(128));
+            }
+            served.store(++done);
+        }
+    });
+
+    // Has the worker allocate while it runs, without allocating itself
+    class WaitingSystem : public System {
+    public:
+        WaitingSystem(std::atomic<int>& requested, std::atomic<int>& served) : mRequested(requested), mServed(served) {}
+        void Update(EntityManager& entityManager, float deltaTime) override {
+            int ticket = mRequested.fetch_add(1) + 1;
+            while (mServed.load() != ticket) std::this_thread::yield();
+        }
+        void Initialize(EntityManager& entityManager) override {}
+        void Shutdown(EntityManager& entityManager) override {}
+        const char* GetName() const override { return "WaitingSystem"; }
+    private:
+        std::atomic<int>& mRequested;
+        std::atomic<int>& mServed;
+    };
+
+    SystemManager systemManager;
+    systemManager.RegisterSystem<WaitingSystem>(requested, served);
+    systemManager.EnableProfiling(true);
+    AllocationTracker::Scope scope;
+    for (int frame = 0; frame < 3; ++frame) {
+        systemManager.UpdateSystems(*entityManager, 0.016f);
+    }
+    stop.store(true);
+    worker.join();
+
+    EXPECT_GE(scope.GetStats().allocations, 15u);
+    const SystemStats* stats = systemManager.GetSystemStats("WaitingSystem");
+    ASSERT_NE(stats, nullptr);
+    EXPECT_EQ(stats->GetSampleCount(), 3u);
+    EXPECT_EQ(stats->GetLastSample().allocations, 0u);
+    EXPECT_EQ(stats->GetLastSample().allocatedBytes, 0u);
+}
+
+// Test that querying profiler history never allocates
+TEST_F(AllocationTrackerTest, SystemStatsQueriesDoNotAllocate) {
+    SystemStats stats;
+    for (size_t i = 0; i < SystemStats::HISTORY_SIZE; ++i) {
+        SystemFrameSample sample;
+        sample.milliseconds = static_cast<float>((i * 37) % 101);
+        stats.AddSample(sample);
+    }
+
+    AllocationTracker::Scope scope;
+    float total = stats.GetP99Milliseconds() + stats.GetAverageMilliseconds() + stats.GetMaxMilliseconds();
+    EXPECT_EQ(scope.GetStats().allocations, 0u);
+    EXPECT_FLOAT_EQ(stats.GetP99Milliseconds(), 100.0f);
+    EXPECT_GT(total, 0.0f);
+}
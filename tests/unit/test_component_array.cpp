@@ -217,3 +217,49 @@ TEST_F(ComponentArrayTest, GetComponents) {
         EXPECT_FLOAT_EQ(components[i].y, static_cast<float>(i));
     }
 }
+
+// Test that change tracking stamps writes but not const reads
+TEST_F(ComponentArrayTest, ChangeTracking) {
+    Position pos(1.0f, 2.0f);
+    componentArray->InsertData(1, &pos);
+    componentArray->InsertData(2, &pos);
+    
+    // Off by default: nothing is stamped
+    componentArray->GetComponent(1)->x = 5.0f;
+    EXPECT_EQ(componentArray->GetChangeVersion(), 0u);
+    
+    // Turning it on counts as a change to everything
+    componentArray->SetChangeTracking(true);
+    EXPECT_TRUE(componentArray->IsChangeTracking());
+    uint64_t seen = componentArray->GetChangeVersion();
+    EXPECT_GT(seen, 0u);
+    EXPECT_EQ(componentArray->GetChangeVersion(1), seen);
+    
+    // Const access is not a write
+    const ComponentArray<Position>& reader = *componentArray;
+    EXPECT_FLOAT_EQ(reader.GetComponent(1)->x, 5.0f);
+    EXPECT_EQ(componentArray->GetChangeVersion(), seen);
+    
+    // Mutable access, insert and removal are
+    componentArray->GetComponent(2)->y = 3.0f;
+    EXPECT_GT(componentArray->GetChangeVersion(2), seen);
+    EXPECT_EQ(componentArray->GetChangeVersion(1), seen);
+    
+    seen = componentArray->GetChangeVersion();
+    componentArray->InsertData(3, &pos);
+    EXPECT_GT(componentArray->GetChangeVersion(3), seen);
+    componentArray->RemoveData(1);
+    EXPECT_GT(componentArray->GetChangeVersion(1), componentArray->GetChangeVersion(3));
+    EXPECT_EQ(componentArray->GetChangeVersion(2), seen);
+    
+    // Raw array access and Clear stamp every entity
+    seen = componentArray->GetChangeVersion();
+    componentArray->GetComponents();
+    EXPECT_GT(componentArray->GetChangeVersion(2), seen);
+    
+    // Off again drops the stamps
+    componentArray->SetChangeTracking(false);
+    seen = componentArray->GetChangeVersion();
+    componentArray->GetComponent(2)->x = 0.0f;
+    EXPECT_EQ(componentArray->GetChangeVersion(), seen);
+}
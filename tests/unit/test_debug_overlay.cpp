@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "ECS/EntityManager.h"
+#include "ECS/SystemManager.h"
+#include "ECS/Systems/MovementSystem.h"
+#include "ECS/Components/Position.h"
+#include "ECS/Components/Velocity.h"
+#include "Rendering/DebugOverlay.h"
+#include "Rendering/RenderCommandList.h"
+
+using namespace Lite2D::ECS;
+
+class DebugOverlayTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        entityManager = std::make_unique<EntityManager>();
+        for (int i = 0; i < 3; ++i) {
+            Entity entity = entityManager->CreateEntity();
+            entityManager->AddComponent(entity, Position(0.0f, 0.0f));
+            if (i == 0) {
+                entityManager->AddComponent(entity, Velocity(1.0f, 0.0f));
+            }
+        }
+    }
+
+    // True if any recorded text line contains the given fragment
+    bool HasText(const std::string& fragment) const {
+        for (const RenderCommand& command : commands.GetCommands()) {
+            if (command.type == RenderCommandType::Text &&
+                std::string(commands.GetText(command)).find(fragment) != std::string::npos) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::unique_ptr<EntityManager> entityManager;
+    RenderCommandList commands;
+    DebugOverlay overlay;
+};
+
+// Test that counts come from maintained pool sizes
+TEST_F(DebugOverlayTest, ShowsEntityAndPoolCounts) {
+    overlay.Record(commands, 0, *entityManager, DebugOverlay::RenderInfo());
+
+    EXPECT_TRUE(HasText("Entities 3 / 10000"));
+    EXPECT_TRUE(HasText(std::string(Position::GetTypeNameStatic())));
+    EXPECT_TRUE(HasText(std::string(Velocity::GetTypeNameStatic())));
+}
+
+// Test frame-time history and graph bars
+TEST_F(DebugOverlayTest, FrameTimeGraph) {
+    for (size_t i = 0; i < DebugOverlay::FRAME_HISTORY + 20; ++i) {
+        overlay.AddFrameTime(i % 2 ? 10.0f : 30.0f);
+    }
+    EXPECT_FLOAT_EQ(overlay.GetAverageFrameTime(), 20.0f);
+    EXPECT_FLOAT_EQ(overlay.GetMaxFrameTime(), 30.0f);
+
+    overlay.Record(commands, 0, *entityManager, DebugOverlay::RenderInfo());
+
+    size_t fillRects = 0;
+    size_t panels = 0;
+    for (const RenderCommand& command : commands.GetCommands()) {
+        if (command.type == RenderCommandType::FillRect) fillRects++;
+        // Only the panel sits on the base layer, below the bars and text
+        if (command.layer == 0) {
+            panels++;
+            EXPECT_EQ(command.type, RenderCommandType::FillRect);
+        } else {
+            EXPECT_EQ(command.layer, 1);
+        }
+    }
+    EXPECT_EQ(fillRects, DebugOverlay::FRAME_HISTORY + 1); // Bars plus the panel
+    EXPECT_EQ(panels, 1u);
+    EXPECT_TRUE(HasText("FPS 50.0"));
+}
+
+// Test per-system timings
+TEST_F(DebugOverlayTest, ShowsSystemTimings) {
+    SystemManager systemManager;
+    systemManager.RegisterSystem<MovementSystem>();
+    overlay.SetSystemManager(&systemManager);
+
+    overlay.Record(commands, 0, *entityManager, DebugOverlay::RenderInfo());
+    EXPECT_TRUE(HasText("profiling disabled"));
+
+    commands.Clear();
+    systemManager.EnableProfiling(true);
+    systemManager.UpdateSystems(*entityManager, 0.016f);
+    overlay.Record(commands, 0, *entityManager, DebugOverlay::RenderInfo());
+    EXPECT_TRUE(HasText("MovementSystem"));
+}
+
+// Test that per-system numbers are refreshed periodically, not every frame
+TEST_F(DebugOverlayTest, RefreshesSystemTimingsPeriodically) {
+    SystemManager systemManager;
+    systemManager.RegisterSystem<MovementSystem>();
+    systemManager.EnableProfiling(true);
+    overlay.SetSystemManager(&systemManager);
+
+    SystemStats& stats = const_cast<SystemStats&>(systemManager.GetSystemStatsAt(0));
+    SystemFrameSample sample;
+    sample.milliseconds = 1.0f;
+    stats.AddSample(sample);
+    overlay.Record(commands, 0, *entityManager, DebugOverlay::RenderInfo());
+    EXPECT_TRUE(HasText("1.000   1.000"));
+
+    // Held until SYSTEM_REFRESH_FRAMES frames have passed
+    stats.Reset();
+    sample.milliseconds = 3.0f;
+    stats.AddSample(sample);
+    for (size_t frame = 1; frame < DebugOverlay::SYSTEM_REFRESH_FRAMES; ++frame) {
+        commands.Clear();
+        overlay.Record(commands, 0, *entityManager, DebugOverlay::RenderInfo());
+        EXPECT_TRUE(HasText("1.000   1.000")) << "frame " << frame;
+    }
+    commands.Clear();
+    overlay.Record(commands, 0, *entityManager, DebugOverlay::RenderInfo());
+    EXPECT_TRUE(HasText("3.000   3.000"));
+}
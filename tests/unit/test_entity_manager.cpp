@@ -238,6 +238,14 @@ TEST_F(EntityManagerTest, EntityPoolRecycling) {
     EXPECT_EQ(entityManager->GetEntityCount(), 5);
     EXPECT_TRUE(entityManager->IsValid(newEntity1));
     EXPECT_TRUE(entityManager->IsValid(newEntity2));
+    
+    // A recycled ID has a new generation; untouched ones keep theirs
+    EXPECT_EQ(newEntity1, entities[1]);
+    EXPECT_EQ(entityManager->GetGeneration(newEntity1), 1u);
+    EXPECT_EQ(entityManager->GetGeneration(entities[0]), 0u);
+    entityManager->Clear();
+    EXPECT_EQ(entityManager->GetGeneration(entities[0]), 1u);
+    EXPECT_EQ(entityManager->GetGeneration(entities[1]), 2u);
 }
 
 // Test clear operation
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include "Utils/FrameArena.h"
+#include "Utils/AllocationTracker.h"
+#include "ECS/EntityManager.h"
+#include "ECS/SystemManager.h"
+#include "ECS/Components/Position.h"
+#include "ECS/Components/Velocity.h"
+
+using namespace Lite2D;
+using namespace Lite2D::ECS;
+
+// Test bump allocation and alignment
+TEST(FrameArenaTest, AllocateAligned) {
+    FrameArena arena(1024);
+    EXPECT_EQ(arena.GetCapacity(), 0u); // Reserved lazily
+
+    void* byte = arena.Allocate(1, 1);
+    void* aligned = arena.Allocate(8, 64);
+    double* values = arena.AllocateArray<double>(4);
+
+    EXPECT_NE(byte, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned) % 64, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(values) % alignof(double), 0u);
+    EXPECT_EQ(arena.GetCapacity(), 1024u);
+    EXPECT_GE(arena.GetUsedBytes(), 1u + 8u + 4u * sizeof(double));
+}
+
+// Test that reset rewinds to the same memory
+TEST(FrameArenaTest, ResetReusesMemory) {
+    FrameArena arena(256);
+    void* first = arena.Allocate(100);
+    arena.Reset();
+
+    EXPECT_EQ(arena.GetUsedBytes(), 0u);
+    EXPECT_EQ(arena.Allocate(100), first);
+}
+
+// Test that overflow spills into new blocks and is merged on reset
+TEST(FrameArenaTest, OverflowMergesOnReset) {
+    FrameArena arena(128);
+    for (int i = 0; i < 10; ++i) {
+        arena.Allocate(100);
+    }
+    EXPECT_GT(arena.GetBlockCount(), 1u);
+    size_t capacity = arena.GetCapacity();
+    size_t peak = arena.GetPeakBytes();
+    EXPECT_GE(peak, 1000u);
+
+    arena.Reset();
+    EXPECT_EQ(arena.GetBlockCount(), 1u);
+    EXPECT_EQ(arena.GetCapacity(), capacity);
+
+    // The same frame now fits without growing
+    AllocationTracker::Scope scope;
+    for (int i = 0; i < 10; ++i) {
+        arena.Allocate(100);
+    }
+    EXPECT_EQ(arena.GetBlockCount(), 1u);
+    EXPECT_EQ(scope.GetStats().allocations, 0u);
+}
+
+// Test a standard container on arena memory
+TEST(FrameArenaTest, ArenaVector) {
+    FrameArena arena;
+    ArenaVector<int> values{ArenaAllocator<int>(arena)};
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back(i);
+    }
+
+    EXPECT_EQ(values.size(), 1000u);
+    EXPECT_EQ(values[999], 999);
+    EXPECT_GE(arena.GetUsedBytes(), 1000u * sizeof(int));
+}
+
+// Test frame queries against the heap query, and that steady-state frames skip the heap
+TEST(FrameArenaTest, EntityManagerFrameQueries) {
+    EntityManager entityManager;
+    for (int i = 0; i < 500; ++i) {
+        Entity entity = entityManager.CreateEntity();
+        entityManager.AddComponent(entity, Position(0.0f, 0.0f));
+        if (i % 3 == 0) {
+            entityManager.AddComponent(entity, Velocity(1.0f, 0.0f));
+        }
+    }
+
+    std::vector<Entity> expected = entityManager.GetEntitiesWith<Position, Velocity>();
+    {
+        auto frameEntities = entityManager.GetFrameEntitiesWith<Position, Velocity>();
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), frameEntities.begin(), frameEntities.end()));
+    }
+    EXPECT_GT(entityManager.GetFrameArena().GetUsedBytes(), 0u);
+    entityManager.EndFrame();
+    EXPECT_EQ(entityManager.GetFrameArena().GetUsedBytes(), 0u);
+
+    AllocationTracker::Scope scope;
+    for (int frame = 0; frame < 60; ++frame) {
+        auto all = entityManager.GetFrameEntitiesWith<Position>();
+        auto moving = entityManager.GetFrameEntitiesWith<Position, Velocity>();
+        EXPECT_EQ(all.size(), 500u);
+        EXPECT_EQ(moving.size(), expected.size());
+        entityManager.EndFrame();
+    }
+    EXPECT_EQ(scope.GetStats().allocations, 0u);
+}
+
+// Test that UpdateSystems ends the frame
+TEST(FrameArenaTest, UpdateSystemsResetsArena) {
+    EntityManager entityManager;
+    SystemManager systemManager;
+
+    entityManager.GetFrameArena().Allocate(128);
+    systemManager.UpdateSystems(entityManager, 0.016f);
+    EXPECT_EQ(entityManager.GetFrameArena().GetUsedBytes(), 0u);
+}
@@ -0,0 +1,266 @@
+#include <gtest/gtest.h>
+#include "ECS/EntityManager.h"
+#include "Rendering/HeadlessRenderer.h"
+#include "Rendering/RenderSystem.h"
+#include "ECS/Components/Position.h"
+#include "ECS/Components/Renderable.h"
+#include "ECS/Components/Emitter.h"
+#include "ECS/Systems/EmitterSystem.h"
+#include "Utils/AllocationTracker.h"
+#include <vector>
+
+using namespace Lite2D::ECS;
+
+class HeadlessRendererTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        headlessRenderer = std::make_unique<HeadlessRenderer>();
+        ASSERT_TRUE(headlessRenderer->Initialize(64, 64));
+
+        entityManager = std::make_unique<EntityManager>();
+        renderSystem = std::make_unique<RenderSystem>(headlessRenderer->GetRendererObject());
+    }
+
+    void TearDown() override {
+        renderSystem.reset();
+        entityManager.reset();
+        headlessRenderer.reset();
+    }
+
+    std::unique_ptr<HeadlessRenderer> headlessRenderer;
+    std::unique_ptr<EntityManager> entityManager;
+    std::unique_ptr<RenderSystem> renderSystem;
+};
+
+// Test offscreen target creation
+TEST_F(HeadlessRendererTest, Initialize) {
+    EXPECT_NE(headlessRenderer->GetRendererObject(), nullptr);
+    EXPECT_NE(headlessRenderer->GetSurface(), nullptr);
+    EXPECT_EQ(headlessRenderer->GetWidth(), 64);
+    EXPECT_EQ(headlessRenderer->GetHeight(), 64);
+}
+
+// Test RenderSystem output without a window
+TEST_F(HeadlessRendererTest, RenderSystemDrawsEntity) {
+    Entity entity = entityManager->CreateEntity();
+    entityManager->AddComponent(entity, Position(32.0f, 32.0f));
+    entityManager->AddComponent(entity, Renderable(true, 2)); // Food layer (yellow)
+
+    renderSystem->Update(*entityManager, 0.016f);
+
+    SDL_Color color;
+
+    // Background is cleared to black
+    ASSERT_TRUE(headlessRenderer->ReadPixel(0, 0, color));
+    EXPECT_EQ(color.r, 0);
+    EXPECT_EQ(color.g, 0);
+    EXPECT_EQ(color.b, 0);
+
+    // Entity fill color at its center
+    ASSERT_TRUE(headlessRenderer->ReadPixel(32, 32, color));
+    EXPECT_EQ(color.r, 255);
+    EXPECT_EQ(color.g, 255);
+    EXPECT_EQ(color.b, 100);
+
+    // Darker border on the entity's edge
+    ASSERT_TRUE(headlessRenderer->ReadPixel(22, 32, color));
+    EXPECT_EQ(color.r, 127);
+    EXPECT_EQ(color.g, 127);
+    EXPECT_EQ(color.b, 50);
+}
+
+// Test that the debug overlay reads the allocation frame but leaves closing it to the game loop
+TEST_F(HeadlessRendererTest, OverlayDoesNotMarkAllocationFrame) {
+    if (!Lite2D::AllocationTracker::IsEnabled()) {
+        GTEST_SKIP() << "Allocation hooks not linked";
+    }
+
+    Entity entity = entityManager->CreateEntity();
+    entityManager->AddComponent(entity, Position(32.0f, 32.0f));
+    entityManager->AddComponent(entity, Renderable(true, 2));
+    renderSystem->EnableDebugInfo(true);
+
+    Lite2D::AllocationTracker::MarkFrame();
+    auto buffer = std::make_unique<std::vector<int>>(64);
+    const Lite2D::AllocationTracker::AllocationStats frame = Lite2D::AllocationTracker::MarkFrame();
+    ASSERT_GE(frame.allocations, 1u);
+
+    for (int i = 0; i < 3; ++i) {
+        renderSystem->Update(*entityManager, 0.016f);
+    }
+
+    const Lite2D::AllocationTracker::AllocationStats& last = Lite2D::AllocationTracker::GetLastFrame();
+    EXPECT_EQ(last.allocations, frame.allocations);
+    EXPECT_EQ(last.bytes, frame.bytes);
+}
+
+// Test that identical scenes produce identical framebuffers
+TEST_F(HeadlessRendererTest, ChecksumIsStable) {
+    Entity entity = entityManager->CreateEntity();
+    entityManager->AddComponent(entity, Position(20.0f, 40.0f));
+    entityManager->AddComponent(entity, Renderable(true, 1));
+
+    renderSystem->Update(*entityManager, 0.016f);
+    uint64_t firstChecksum = headlessRenderer->ComputeChecksum();
+
+    renderSystem->Update(*entityManager, 0.016f);
+    EXPECT_EQ(headlessRenderer->ComputeChecksum(), firstChecksum);
+
+    // Moving the entity must change the output
+    entityManager->GetComponent<Position>(entity)->x += 5.0f;
+    renderSystem->Update(*entityManager, 0.016f);
+    EXPECT_NE(headlessRenderer->ComputeChecksum(), firstChecksum);
+}
+
+// Test that threaded vertex preparation matches the single-threaded output
+TEST_F(HeadlessRendererTest, WorkerThreadsMatchSingleThread) {
+    // Overlapping entities across layers, so any ordering mistake changes pixels
+    for (int i = 0; i < 200; ++i) {
+        Entity entity = entityManager->CreateEntity();
+        entityManager->AddComponent(entity, Position(static_cast<float>((i * 7) % 64), static_cast<float>((i * 13) % 64)));
+        entityManager->AddComponent(entity, Renderable(true, i % 4));
+    }
+
+    renderSystem->Update(*entityManager, 0.016f);
+    uint64_t singleThreadChecksum = headlessRenderer->ComputeChecksum();
+
+    renderSystem->SetWorkerThreads(4);
+    EXPECT_EQ(renderSystem->GetWorkerThreads(), 4u);
+    renderSystem->Update(*entityManager, 0.016f);
+    EXPECT_EQ(headlessRenderer->ComputeChecksum(), singleThreadChecksum);
+
+    // Reverse order also survives chunking
+    renderSystem->SetRenderOrder(false);
+    renderSystem->Update(*entityManager, 0.016f);
+    uint64_t reversedThreaded = headlessRenderer->ComputeChecksum();
+
+    renderSystem->SetWorkerThreads(1);
+    renderSystem->Update(*entityManager, 0.016f);
+    EXPECT_EQ(headlessRenderer->ComputeChecksum(), reversedThreaded);
+}
+
+// Test that a cached static layer matches direct drawing and only rebuilds on change
+TEST_F(HeadlessRendererTest, StaticLayerCache) {
+    std::vector<Entity> walls;
+    for (int i = 0; i < 4; ++i) {
+        Entity wall = entityManager->CreateEntity();
+        entityManager->AddComponent(wall, Position(10.0f + i * 15.0f, 10.0f));
+        entityManager->AddComponent(wall, Renderable(true, 3));
+        walls.push_back(wall);
+    }
+    Entity head = entityManager->CreateEntity();
+    entityManager->AddComponent(head, Position(30.0f, 40.0f));
+    entityManager->AddComponent(head, Renderable(true, 1));
+
+    renderSystem->Update(*entityManager, 0.016f);
+    uint64_t directChecksum = headlessRenderer->ComputeChecksum();
+
+    renderSystem->SetLayerStatic(3);
+    EXPECT_TRUE(renderSystem->IsLayerStatic(3));
+    renderSystem->Update(*entityManager, 0.016f);
+    EXPECT_EQ(headlessRenderer->ComputeChecksum(), directChecksum);
+    EXPECT_EQ(renderSystem->GetStaticLayerRebuildCount(), 1u);
+
+    // Dynamic entities moving does not touch the cache
+    entityManager->GetComponent<Position>(head)->x += 5.0f;
+    renderSystem->Update(*entityManager, 0.016f);
+    EXPECT_EQ(renderSystem->GetStaticLayerRebuildCount(), 1u);
+
+    // Reading a wall through a const manager is not a change
+    const EntityManager& reader = *entityManager;
+    EXPECT_FLOAT_EQ(reader.GetComponent<Position>(walls[0])->y, 10.0f);
+    renderSystem->Update(*entityManager, 0.016f);
+    EXPECT_EQ(renderSystem->GetStaticLayerRebuildCount(), 1u);
+
+    // Moving a wall rebuilds once, and the cache matches direct drawing again
+    entityManager->GetComponent<Position>(walls[0])->y += 5.0f;
+    renderSystem->Update(*entityManager, 0.016f);
+    EXPECT_EQ(renderSystem->GetStaticLayerRebuildCount(), 2u);
+    uint64_t movedChecksum = headlessRenderer->ComputeChecksum();
+    EXPECT_NE(movedChecksum, directChecksum);
+    renderSystem->Update(*entityManager, 0.016f);
+    EXPECT_EQ(renderSystem->GetStaticLayerRebuildCount(), 2u);
+
+    renderSystem->SetLayerStatic(3, false);
+    renderSystem->Update(*entityManager, 0.016f);
+    EXPECT_EQ(headlessRenderer->ComputeChecksum(), movedChecksum);
+    renderSystem->SetLayerStatic(3);
+    renderSystem->Update(*entityManager, 0.016f);
+    EXPECT_EQ(renderSystem->GetStaticLayerRebuildCount(), 3u);
+
+    // Writing a wall's Renderable rebuilds too, as does an explicit mark
+    entityManager->GetComponent<Renderable>(walls[2])->visible = true;
+    renderSystem->Update(*entityManager, 0.016f);
+    EXPECT_EQ(renderSystem->GetStaticLayerRebuildCount(), 4u);
+    renderSystem->MarkStaticLayerDirty(3);
+    renderSystem->Update(*entityManager, 0.016f);
+    EXPECT_EQ(renderSystem->GetStaticLayerRebuildCount(), 5u);
+
+    // Hiding, adding or destroying a wall rebuilds on its own
+    entityManager->GetComponent<Renderable>(walls[1])->visible = false;
+    renderSystem->Update(*entityManager, 0.016f);
+    EXPECT_EQ(renderSystem->GetStaticLayerRebuildCount(), 6u);
+
+    Entity extra = entityManager->CreateEntity();
+    entityManager->AddComponent(extra, Position(50.0f, 50.0f));
+    entityManager->AddComponent(extra, Renderable(true, 3));
+    renderSystem->Update(*entityManager, 0.016f);
+    EXPECT_EQ(renderSystem->GetStaticLayerRebuildCount(), 7u);
+
+    entityManager->DestroyEntity(extra);
+    renderSystem->Update(*entityManager, 0.016f);
+    EXPECT_EQ(renderSystem->GetStaticLayerRebuildCount(), 8u);
+
+    // A wall replaced by a new entity that recycles its ID, somewhere else
+    entityManager->DestroyEntity(walls[3]);
+    entityManager->CreateEntity(); // Takes extra's ID, freed first
+    Entity replacement = entityManager->CreateEntity();
+    ASSERT_EQ(replacement, walls[3]);
+    entityManager->AddComponent(replacement, Position(10.0f, 50.0f));
+    entityManager->AddComponent(replacement, Renderable(true, 3));
+    renderSystem->Update(*entityManager, 0.016f);
+    EXPECT_EQ(renderSystem->GetStaticLayerRebuildCount(), 9u);
+
+    // Camera changes rebuild as well
+    renderSystem->SetCamera(2.0f, 0.0f);
+    renderSystem->Update(*entityManager, 0.016f);
+    EXPECT_EQ(renderSystem->GetStaticLayerRebuildCount(), 10u);
+    uint64_t cachedChecksum = headlessRenderer->ComputeChecksum();
+
+    renderSystem->SetLayerStatic(3, false);
+    renderSystem->Update(*entityManager, 0.016f);
+    EXPECT_EQ(headlessRenderer->ComputeChecksum(), cachedChecksum);
+}
+
+// Test that emitter particles are drawn on their layer as one batch
+TEST_F(HeadlessRendererTest, EmitterParticlesRender) {
+    Entity entity = entityManager->CreateEntity();
+    entityManager->AddComponent(entity, Position(32.0f, 32.0f));
+
+    Emitter emitter(0.0f, 16, 5);
+    emitter.speedMin = 0.0f;
+    emitter.speedMax = 0.0f;
+    emitter.size = 6.0f;
+    emitter.startColor = {255, 0, 0, 255};
+    emitter.endColor = {255, 0, 0, 255};
+    emitter.burst = 4;
+    entityManager->AddComponent(entity, emitter);
+
+    EmitterSystem emitterSystem;
+    emitterSystem.Update(*entityManager, 0.016f);
+    renderSystem->SetEmitterSource(&emitterSystem);
+    renderSystem->Update(*entityManager, 0.016f);
+
+    SDL_Color color;
+    ASSERT_TRUE(headlessRenderer->ReadPixel(32, 32, color));
+    EXPECT_EQ(color.r, 255);
+    EXPECT_EQ(color.g, 0);
+    ASSERT_TRUE(headlessRenderer->ReadPixel(40, 32, color));
+    EXPECT_EQ(color.r, 0);
+
+    size_t geometryCommands = 0;
+    for (const RenderCommand& command : renderSystem->GetCommandList().GetCommands()) {
+        if (command.type == RenderCommandType::Geometry && command.layer == 5) geometryCommands++;
+    }
+    EXPECT_EQ(geometryCommands, 1u);
+}
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include "Input/InputManager.h"
+#include "Input/ActionMap.h"
+#include "Utils/AllocationTracker.h"
+
+using namespace Lite2D;
+
+namespace {
+
+SDL_Event Key(Uint32 type, SDL_Scancode sc, bool repeat = false) {
+    SDL_Event event;
+    std::memset(&event, 0, sizeof(event));
+    event.type = type;
+    event.key.scancode = sc;
+    event.key.down = type == SDL_EVENT_KEY_DOWN;
+    event.key.repeat = repeat;
+    return event;
+}
+
+SDL_Event Button(Uint32 type, Uint8 button) {
+    SDL_Event event;
+    std::memset(&event, 0, sizeof(event));
+    event.type = type;
+    event.button.button = button;
+    event.button.down = type == SDL_EVENT_MOUSE_BUTTON_DOWN;
+    return event;
+}
+
+enum TestAction {
+    ACTION_JUMP,
+    ACTION_FIRE,
+    ACTION_UNBOUND
+};
+
+} // namespace
+
+// Test the pressed / held / released edges across frames
+TEST(InputManagerTest, TracksKeyEdges) {
+    InputManager input;
+    input.FeedEvent(Key(SDL_EVENT_KEY_DOWN, SDL_SCANCODE_SPACE));
+    EXPECT_TRUE(input.IsKeyPressed(SDL_SCANCODE_SPACE));
+    EXPECT_TRUE(input.IsKeyHeld(SDL_SCANCODE_SPACE));
+    EXPECT_EQ(input.GetKeyState(SDL_SCANCODE_SPACE), KeyState::Pressed);
+    input.Update();
+
+    // Repeats neither re-press nor release
+    input.FeedEvent(Key(SDL_EVENT_KEY_DOWN, SDL_SCANCODE_SPACE, true));
+    EXPECT_FALSE(input.IsKeyPressed(SDL_SCANCODE_SPACE));
+    EXPECT_EQ(input.GetKeyState(SDL_SCANCODE_SPACE), KeyState::Held);
+    input.Update();
+
+    input.FeedEvent(Key(SDL_EVENT_KEY_UP, SDL_SCANCODE_SPACE));
+    EXPECT_TRUE(input.IsKeyReleased(SDL_SCANCODE_SPACE));
+    EXPECT_FALSE(input.IsKeyHeld(SDL_SCANCODE_SPACE));
+    EXPECT_EQ(input.GetKeyState(SDL_SCANCODE_SPACE), KeyState::Released);
+    input.Update();
+    EXPECT_EQ(input.GetKeyState(SDL_SCANCODE_SPACE), KeyState::None);
+
+    // A tap inside one frame is not lost
+    input.FeedEvent(Key(SDL_EVENT_KEY_DOWN, SDL_SCANCODE_R));
+    input.FeedEvent(Key(SDL_EVENT_KEY_UP, SDL_SCANCODE_R));
+    EXPECT_TRUE(input.IsKeyPressed(SDL_SCANCODE_R));
+    EXPECT_TRUE(input.IsKeyReleased(SDL_SCANCODE_R));
+    EXPECT_FALSE(input.IsKeyHeld(SDL_SCANCODE_R));
+
+    // Ups without downs and keys outside the table are ignored
+    input.FeedEvent(Key(SDL_EVENT_KEY_UP, SDL_SCANCODE_W));
+    EXPECT_FALSE(input.IsKeyReleased(SDL_SCANCODE_W));
+    EXPECT_FALSE(input.IsKeyHeld(static_cast<SDL_Scancode>(InputManager::KEY_COUNT + 5)));
+}
+
+// Test that keycode queries and keycode-only events land on the scancode table
+TEST(InputManagerTest, TranslatesKeycodes) {
+    InputManager input;
+    SDL_Event event = Key(SDL_EVENT_KEY_DOWN, SDL_SCANCODE_UNKNOWN);
+    event.key.key = SDLK_SPACE;
+    input.FeedEvent(event);
+    EXPECT_TRUE(input.IsKeyPressed(SDL_SCANCODE_SPACE));
+    EXPECT_TRUE(input.IsKeyHeld(SDLK_SPACE));
+    EXPECT_FALSE(input.IsKeyHeld(SDLK_ESCAPE));
+}
+
+// Test mouse button edges
+TEST(InputManagerTest, TracksMouseButtons) {
+    InputManager input;
+    input.FeedEvent(Button(SDL_EVENT_MOUSE_BUTTON_DOWN, SDL_BUTTON_LEFT));
+    EXPECT_TRUE(input.IsMouseButtonPressed(SDL_BUTTON_LEFT));
+    EXPECT_TRUE(input.IsMouseButtonHeld(SDL_BUTTON_LEFT));
+    EXPECT_FALSE(input.IsMouseButtonHeld(SDL_BUTTON_RIGHT));
+    input.Update();
+
+    EXPECT_FALSE(input.IsMouseButtonPressed(SDL_BUTTON_LEFT));
+    EXPECT_TRUE(input.IsMouseButtonHeld(SDL_BUTTON_LEFT));
+    input.FeedEvent(Button(SDL_EVENT_MOUSE_BUTTON_UP, SDL_BUTTON_LEFT));
+    EXPECT_TRUE(input.IsMouseButtonReleased(SDL_BUTTON_LEFT));
+    EXPECT_FALSE(input.IsMouseButtonHeld(SDL_BUTTON_LEFT));
+}
+
+// Test that actions fire through any of their bindings
+TEST(InputManagerTest, MapsActions) {
+    InputManager input;
+    ActionMap actions(input);
+    EXPECT_TRUE(actions.BindKey(ACTION_JUMP, SDL_SCANCODE_SPACE));
+    EXPECT_TRUE(actions.BindKey(ACTION_JUMP, SDL_SCANCODE_W));
+    EXPECT_TRUE(actions.BindMouseButton(ACTION_FIRE, SDL_BUTTON_LEFT));
+    EXPECT_TRUE(actions.BindKey(ACTION_FIRE, SDL_SCANCODE_RETURN));
+    EXPECT_FALSE(actions.BindKey(ActionMap::MAX_ACTIONS, SDL_SCANCODE_A));
+    EXPECT_FALSE(actions.BindMouseButton(ACTION_FIRE, 200));
+
+    input.FeedEvent(Key(SDL_EVENT_KEY_DOWN, SDL_SCANCODE_W));
+    EXPECT_TRUE(actions.IsPressed(ACTION_JUMP));
+    EXPECT_TRUE(actions.IsHeld(ACTION_JUMP));
+    EXPECT_FALSE(actions.IsHeld(ACTION_FIRE));
+    EXPECT_FALSE(actions.IsHeld(ACTION_UNBOUND));
+    EXPECT_FALSE(actions.IsHeld(ActionMap::MAX_ACTIONS));
+    input.Update();
+
+    input.FeedEvent(Button(SDL_EVENT_MOUSE_BUTTON_DOWN, SDL_BUTTON_LEFT));
+    EXPECT_FALSE(actions.IsPressed(ACTION_JUMP));
+    EXPECT_TRUE(actions.IsHeld(ACTION_JUMP));
+    EXPECT_TRUE(actions.IsPressed(ACTION_FIRE));
+    input.Update();
+
+    input.FeedEvent(Key(SDL_EVENT_KEY_UP, SDL_SCANCODE_W));
+    EXPECT_TRUE(actions.IsReleased(ACTION_JUMP));
+    EXPECT_FALSE(actions.IsHeld(ACTION_JUMP));
+
+    actions.Unbind(ACTION_FIRE);
+    EXPECT_FALSE(actions.IsHeld(ACTION_FIRE));
+}
+
+// Test that a frame of input handling never touches the heap
+TEST(InputManagerTest, FrameDoesNotAllocate) {
+    ASSERT_TRUE(AllocationTracker::IsEnabled());
+    InputManager input;
+    ActionMap actions(input);
+    actions.BindKey(ACTION_JUMP, SDL_SCANCODE_SPACE);
+    actions.BindMouseButton(ACTION_FIRE, SDL_BUTTON_LEFT);
+
+    const SDL_Event events[] = {
+        Key(SDL_EVENT_KEY_DOWN, SDL_SCANCODE_SPACE),
+        Button(SDL_EVENT_MOUSE_BUTTON_DOWN, SDL_BUTTON_LEFT),
+        Key(SDL_EVENT_KEY_UP, SDL_SCANCODE_SPACE),
+        Button(SDL_EVENT_MOUSE_BUTTON_UP, SDL_BUTTON_LEFT),
+    };
+
+    AllocationTracker::Scope scope;
+    int hits = 0;
+    for (int frame = 0; frame < 100; ++frame) {
+        input.FeedEvent(events[frame % 4]);
+        hits += actions.IsPressed(ACTION_JUMP) + actions.IsHeld(ACTION_FIRE) + input.IsKeyHeld(SDL_SCANCODE_SPACE);
+        input.Update();
+    }
+    EXPECT_GT(hits, 0);
+    EXPECT_EQ(scope.GetStats().allocations, 0u);
+}
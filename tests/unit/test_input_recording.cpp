@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "Input/InputManager.h"
+#include "Input/InputRecording.h"
+
+namespace {
+
+SDL_Event KeyEvent(Uint32 type, SDL_Keycode key, bool repeat = false) {
+    SDL_Event event;
+    std::memset(&event, 0, sizeof(event));
+    event.type = type;
+    event.key.key = key;
+    event.key.down = type == SDL_EVENT_KEY_DOWN;
+    event.key.repeat = repeat;
+    return event;
+}
+
+SDL_Event MouseButtonEvent(Uint32 type, Uint8 button, float x, float y) {
+    SDL_Event event;
+    std::memset(&event, 0, sizeof(event));
+    event.type = type;
+    event.button.button = button;
+    event.button.down = type == SDL_EVENT_MOUSE_BUTTON_DOWN;
+    event.button.x = x;
+    event.button.y = y;
+    return event;
+}
+
+// Frames of a short session: a key tap, a click, motion and an event type that isn't recorded
+std::vector<std::vector<SDL_Event>> MakeSession() {
+    SDL_Event motion;
+    std::memset(&motion, 0, sizeof(motion));
+    motion.type = SDL_EVENT_MOUSE_MOTION;
+    motion.motion.x = 40.0f;
+    motion.motion.y = 50.0f;
+    motion.motion.xrel = 4.0f;
+
+    SDL_Event moved;
+    std::memset(&moved, 0, sizeof(moved));
+    moved.type = SDL_EVENT_WINDOW_MOVED;
+
+    return {
+        { KeyEvent(SDL_EVENT_KEY_DOWN, SDLK_SPACE) },
+        { KeyEvent(SDL_EVENT_KEY_DOWN, SDLK_SPACE, true), moved },
+        {},
+        { KeyEvent(SDL_EVENT_KEY_UP, SDLK_SPACE), MouseButtonEvent(SDL_EVENT_MOUSE_BUTTON_DOWN, SDL_BUTTON_LEFT, 10.0f, 20.0f) },
+        { motion, MouseButtonEvent(SDL_EVENT_MOUSE_BUTTON_UP, SDL_BUTTON_LEFT, 40.0f, 50.0f) },
+    };
+}
+
+} // namespace
+
+// Test that playback hands back every frame with its timestep and recorded events
+TEST(InputRecordingTest, RoundTripsFrames) {
+    const auto session = MakeSession();
+    InputRecorder recorder;
+    recorder.RecordFrame(1.0f, session[0].data(), session[0].size()); // Not recording yet
+    recorder.Begin(42, 640, 480);
+    for (size_t i = 0; i < session.size(); ++i) {
+        recorder.RecordFrame(0.016f + i * 0.001f, session[i].data(), session[i].size());
+    }
+    EXPECT_EQ(recorder.GetFrameCount(), session.size());
+
+    InputPlayer player;
+    ASSERT_TRUE(player.Load(recorder.GetData(), recorder.GetSize()));
+    EXPECT_EQ(player.GetSeed(), 42u);
+    EXPECT_EQ(player.GetViewWidth(), 640);
+    EXPECT_EQ(player.GetViewHeight(), 480);
+    ASSERT_EQ(player.GetFrameCount(), session.size());
+    EXPECT_EQ(player.GetEventCount(), 6u); // The window move is dropped
+
+    float deltaTime = 0.0f;
+    const SDL_Event* events = nullptr;
+    size_t count = 0;
+    for (size_t i = 0; i < session.size(); ++i) {
+        ASSERT_TRUE(player.NextFrame(deltaTime, events, count));
+        EXPECT_FLOAT_EQ(deltaTime, 0.016f + i * 0.001f);
+        if (i == 1) {
+            ASSERT_EQ(count, 1u);
+            EXPECT_TRUE(events[0].key.repeat);
+        } else {
+            ASSERT_EQ(count, session[i].size());
+        }
+    }
+    EXPECT_FALSE(player.NextFrame(deltaTime, events, count));
+    EXPECT_TRUE(player.IsFinished());
+
+    player.Restart();
+    ASSERT_TRUE(player.NextFrame(deltaTime, events, count));
+    ASSERT_EQ(count, 1u);
+    EXPECT_EQ(events[0].type, static_cast<Uint32>(SDL_EVENT_KEY_DOWN));
+    EXPECT_EQ(events[0].key.key, static_cast<SDL_Keycode>(SDLK_SPACE));
+    EXPECT_TRUE(events[0].key.down);
+}
+
+// Test that replayed events drive InputManager exactly like the live ones
+TEST(InputRecordingTest, ReplayDrivesInputManager) {
+    const auto session = MakeSession();
+    InputRecorder recorder;
+    recorder.Begin(7, 800, 600);
+    for (const auto& frame : session) {
+        recorder.RecordFrame(1.0f / 60.0f, frame.data(), frame.size());
+    }
+    const std::string path = ::testing::TempDir() + "lite2d_input_test.bin";
+    ASSERT_TRUE(recorder.SaveToFile(path));
+
+    InputPlayer player;
+    ASSERT_TRUE(player.LoadFromFile(path));
+    std::remove(path.c_str());
+
+    InputManager live;
+    InputManager replayed;
+    float deltaTime = 0.0f;
+    const SDL_Event* events = nullptr;
+    size_t count = 0;
+    for (size_t i = 0; i < session.size(); ++i) {
+        for (const SDL_Event& event : session[i]) live.FeedEvent(event);
+        ASSERT_TRUE(player.NextFrame(deltaTime, events, count));
+        for (size_t e = 0; e < count; ++e) replayed.FeedEvent(events[e]);
+
+        EXPECT_EQ(replayed.IsKeyPressed(SDLK_SPACE), live.IsKeyPressed(SDLK_SPACE)) << "frame " << i;
+        EXPECT_EQ(replayed.IsKeyHeld(SDLK_SPACE), live.IsKeyHeld(SDLK_SPACE)) << "frame " << i;
+        EXPECT_EQ(replayed.IsMouseButtonPressed(SDL_BUTTON_LEFT), live.IsMouseButtonPressed(SDL_BUTTON_LEFT));
+        int liveX = 0, liveY = 0, replayX = -1, replayY = -1;
+        live.GetMousePosition(liveX, liveY);
+        replayed.GetMousePosition(replayX, replayY);
+        EXPECT_EQ(replayX, liveX);
+        EXPECT_EQ(replayY, liveY);
+
+        live.Update();
+        replayed.Update();
+    }
+
+    // The mouse position follows the fed events, not the OS cursor
+    int x = 0, y = 0;
+    replayed.GetMousePosition(x, y);
+    EXPECT_EQ(x, 40);
+    EXPECT_EQ(y, 50);
+}
+
+// Test that damaged recordings are rejected without crashing
+TEST(InputRecordingTest, RejectsBadRecordings) {
+    const auto session = MakeSession();
+    InputRecorder recorder;
+    recorder.Begin(1, 320, 240);
+    for (const auto& frame : session) {
+        recorder.RecordFrame(0.02f, frame.data(), frame.size());
+    }
+
+    InputPlayer player;
+    for (size_t size = 1; size < recorder.GetSize(); ++size) {
+        if (player.Load(recorder.GetData(), size)) {
+            // A cut between frames is a shorter but valid recording
+            EXPECT_LT(player.GetFrameCount(), session.size()) << "size " << size;
+        }
+    }
+
+    std::vector<uint8_t> damaged(recorder.GetData(), recorder.GetData() + recorder.GetSize());
+    damaged[0] ^= 0xFF;
+    EXPECT_FALSE(player.Load(damaged.data(), damaged.size()));
+    EXPECT_FALSE(player.IsLoaded());
+    EXPECT_EQ(player.GetFrameCount(), 0u);
+}
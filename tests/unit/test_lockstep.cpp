@@ -0,0 +1,252 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+#include "ECS/Lockstep.h"
+#include "ECS/StateHash.h"
+#include "ECS/WorldScheduler.h"
+#include "ECS/Systems/MovementSystem.h"
+#include "ECS/Systems/EmitterSystem.h"
+#include "ECS/Components/Position.h"
+#include "ECS/Components/Velocity.h"
+#include "ECS/Components/Emitter.h"
+#include "Utils/ThreadPool.h"
+
+using namespace Lite2D;
+using namespace Lite2D::ECS;
+
+namespace {
+
+// Bouncing movers plus one emitter, all placed from the world's random stream
+void PopulateWorld(World& world, int moverCount = 200) {
+    auto movement = world.AddSystem<MovementSystem>();
+    movement->SetBoundaries(0, 0, 800, 600);
+    movement->EnableBoundaryClamping(true);
+    world.AddSystem<EmitterSystem>();
+
+    EntityManager& entityManager = world.GetEntityManager();
+    Random& random = world.GetRandom();
+    for (int i = 0; i < moverCount; ++i) {
+        Entity entity = entityManager.CreateEntity();
+        entityManager.AddComponent(entity, Position(random.Range(0.0f, 800.0f), random.Range(0.0f, 600.0f)));
+        entityManager.AddComponent(entity, Velocity(random.Range(-200.0f, 200.0f), random.Range(-200.0f, 200.0f)));
+    }
+
+    Entity emitter = entityManager.CreateEntity();
+    entityManager.AddComponent(emitter, Position(400.0f, 300.0f));
+    entityManager.AddComponent(emitter, Emitter(600.0f, 2000));
+    world.Initialize();
+}
+
+// Periodic bursts so inputs are part of the run
+void BurstEveryFiftyTicks(World& world, uint64_t tick) {
+    if (tick % 50 != 0) return;
+
+    EntityManager& entityManager = world.GetEntityManager();
+    for (Entity entity : entityManager.GetEntitiesWith<Emitter>()) {
+        entityManager.GetComponent<Emitter>(entity)->burst = 100;
+    }
+}
+
+// Counts its updates, so a rewind has some system state to restore
+class TickCounterSystem : public System {
+public:
+    void Update(EntityManager& entityManager, float deltaTime) override { mTicks++; }
+    const char* GetName() const override { return "TickCounterSystem"; }
+    void HashState(StateHasher& hasher) const override { hasher.Add(mTicks); }
+    void WriteSnapshot(SnapshotWriter& writer) const override { writer.Write(mTicks); }
+    void ReadSnapshot(SnapshotReader& reader) override { reader.Read(mTicks); }
+
+private:
+    uint64_t mTicks = 0;
+};
+
+std::vector<Lockstep::TickHash> RunTrace(uint32_t seed, uint64_t ticks, const Lockstep::InputFunction& input) {
+    World world(seed);
+    PopulateWorld(world);
+    Lockstep lockstep(world);
+    lockstep.SetInput(input);
+    lockstep.Run(ticks);
+    return lockstep.GetHashTrace();
+}
+
+} // namespace
+
+// Test that hashes compare bit patterns and field order
+TEST(StateHasherTest, BitPatternsAndOrder) {
+    StateHasher positive;
+    StateHasher negative;
+    positive.Add(0.0f);
+    negative.Add(-0.0f);
+    EXPECT_NE(positive.GetHash(), negative.GetHash());
+
+    StateHasher ab;
+    StateHasher ba;
+    ab.Add(1);
+    ab.Add(2);
+    ba.Add(2);
+    ba.Add(1);
+    EXPECT_NE(ab.GetHash(), ba.GetHash());
+
+    StateHasher same;
+    same.Add(1);
+    same.Add(2);
+    EXPECT_EQ(ab.GetHash(), same.GetHash());
+}
+
+// Test that the same seed and inputs give the same hash on every tick
+TEST(LockstepTest, SameSeedSameTrace) {
+    auto first = RunTrace(7, 300, BurstEveryFiftyTicks);
+    auto second = RunTrace(7, 300, BurstEveryFiftyTicks);
+
+    ASSERT_EQ(first.size(), 300u);
+    EXPECT_EQ(Lockstep::FindDivergence(first, second), -1);
+    EXPECT_EQ(first.back().hash, second.back().hash);
+
+    auto otherSeed = RunTrace(8, 10, BurstEveryFiftyTicks);
+    EXPECT_EQ(Lockstep::FindDivergence(first, otherSeed), 1);
+}
+
+// Test that a one-ulp change in one component is caught on the tick it happens
+TEST(LockstepTest, DetectsDivergence) {
+    auto reference = RunTrace(3, 200, BurstEveryFiftyTicks);
+    auto perturbed = RunTrace(3, 200, [](World& world, uint64_t tick) {
+        BurstEveryFiftyTicks(world, tick);
+        if (tick == 120) {
+            Position* position = world.GetEntityManager().GetComponent<Position>(1);
+            position->x = std::nextafter(position->x, 1.0e9f);
+        }
+    });
+
+    EXPECT_EQ(Lockstep::FindDivergence(reference, perturbed), 121);
+}
+
+// Test that different inputs diverge where they start to differ
+TEST(LockstepTest, InputsAreApplied) {
+    auto reference = RunTrace(3, 120, BurstEveryFiftyTicks);
+    auto noInput = RunTrace(3, 120, nullptr);
+    EXPECT_EQ(Lockstep::FindDivergence(reference, noInput), 1); // Tick 0 burst
+}
+
+// Test the fixed-step accumulator
+TEST(LockstepTest, AdvanceRunsWholeTicks) {
+    World world(1);
+    PopulateWorld(world, 10);
+    Lockstep lockstep(world, 0.01f);
+    lockstep.SetHashInterval(2);
+
+    EXPECT_EQ(lockstep.Advance(0.025), 2);
+    EXPECT_EQ(lockstep.Advance(0.004), 0);
+    EXPECT_EQ(lockstep.Advance(0.001), 1);
+    EXPECT_EQ(lockstep.GetTick(), 3u);
+    EXPECT_EQ(world.GetFrameCount(), 3u);
+    ASSERT_EQ(lockstep.GetHashTrace().size(), 1u); // Tick 2 only
+    EXPECT_EQ(lockstep.GetHashTrace()[0].tick, 2u);
+
+    // A long stall is capped instead of replayed
+    EXPECT_EQ(lockstep.Advance(10.0, 4), 4);
+    EXPECT_LE(lockstep.GetInterpolationAlpha(), 1.0f);
+}
+
+// Test that worlds stepped concurrently on the scheduler match a serial reference
+TEST(LockstepTest, ParallelMatchesReference) {
+    const int ticks = 120;
+
+    World reference(11);
+    PopulateWorld(reference);
+    Lockstep lockstep(reference);
+    lockstep.SetHashInterval(0);
+    lockstep.Run(ticks);
+    const uint64_t expected = reference.ComputeStateHash();
+
+    ThreadPool pool(4);
+    WorldScheduler scheduler(pool);
+    for (int i = 0; i < 8; ++i) {
+        PopulateWorld(scheduler.CreateWorld(11));
+    }
+    scheduler.StepAll(lockstep.GetFixedDeltaTime(), ticks);
+
+    for (size_t i = 0; i < scheduler.GetWorldCount(); ++i) {
+        EXPECT_EQ(scheduler.GetWorld(i).ComputeStateHash(), expected) << "world " << i;
+    }
+}
+
+// Test that rewinding restores earlier state and re-simulating reproduces the same ticks
+TEST(LockstepTest, RewindAndResimulate) {
+    World world(5);
+    PopulateWorld(world);
+    Lockstep lockstep(world);
+    lockstep.SetInput(BurstEveryFiftyTicks);
+    lockstep.EnableRewind();
+    lockstep.Run(100);
+    const std::vector<Lockstep::TickHash> reference = lockstep.GetHashTrace();
+
+    ASSERT_TRUE(lockstep.Rewind(40));
+    EXPECT_EQ(lockstep.GetTick(), 60u);
+    EXPECT_EQ(world.GetFrameCount(), 60u);
+    EXPECT_EQ(world.ComputeStateHash(), reference[59].hash);
+    EXPECT_EQ(lockstep.GetHashTrace().size(), 60u);
+
+    lockstep.Run(40);
+    EXPECT_EQ(Lockstep::FindDivergence(reference, lockstep.GetHashTrace()), -1);
+    EXPECT_EQ(lockstep.GetLastHash(), reference.back().hash);
+
+    // All the way back to the state recorded when rewind was enabled
+    ASSERT_TRUE(lockstep.Rewind(100));
+    EXPECT_EQ(lockstep.GetTick(), 0u);
+    EXPECT_FALSE(lockstep.Rewind(1));
+}
+
+// Test that a rewind that can't load leaves the world, the tick and the history alone
+TEST(LockstepTest, FailedRewindChangesNothing) {
+    World world(5);
+    PopulateWorld(world);
+    Lockstep lockstep(world);
+    lockstep.EnableRewind();
+    lockstep.Run(30);
+
+    // The recorded frames no longer match the registered systems
+    world.AddSystem<TickCounterSystem>();
+    const uint64_t hash = world.ComputeStateHash();
+    const size_t depth = lockstep.GetRewindBuffer()->GetDepth();
+
+    EXPECT_FALSE(lockstep.Rewind(10));
+    EXPECT_EQ(lockstep.GetTick(), 30u);
+    EXPECT_EQ(world.GetFrameCount(), 30u);
+    EXPECT_EQ(world.ComputeStateHash(), hash);
+    EXPECT_EQ(lockstep.GetRewindBuffer()->GetDepth(), depth);
+    EXPECT_EQ(lockstep.GetHashTrace().size(), 30u);
+
+    // Frames recorded from here on load again
+    lockstep.Run(5);
+    const uint64_t afterFive = lockstep.GetLastHash();
+    lockstep.Run(5);
+    ASSERT_TRUE(lockstep.Rewind(5));
+    EXPECT_EQ(world.ComputeStateHash(), afterFive);
+}
+
+// Test that a world snapshot that fails part way through puts the world back
+TEST(LockstepTest, WorldLoadIsAllOrNothing) {
+    World world(9);
+    PopulateWorld(world, 50);
+    world.AddSystem<TickCounterSystem>();
+    for (int i = 0; i < 10; ++i) {
+        world.Step(1.0f / 60.0f);
+    }
+    SnapshotWriter writer;
+    world.SaveSnapshot(writer);
+
+    for (int i = 0; i < 10; ++i) {
+        world.Step(1.0f / 60.0f);
+    }
+    const uint64_t hash = world.ComputeStateHash();
+
+    // Cut inside the system data: entities load, then the systems fail
+    SnapshotReader truncated(writer.GetData(), writer.GetSize() - 4);
+    EXPECT_FALSE(world.LoadSnapshot(truncated));
+    EXPECT_EQ(world.GetFrameCount(), 20u);
+    EXPECT_EQ(world.ComputeStateHash(), hash);
+
+    SnapshotReader whole(writer.GetData(), writer.GetSize());
+    ASSERT_TRUE(world.LoadSnapshot(whole));
+    EXPECT_EQ(world.GetFrameCount(), 10u);
+}
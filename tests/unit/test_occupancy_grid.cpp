@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include "Systems/OccupancyGrid.h"
+
+using namespace Lite2D::ECS;
+
+class OccupancyGridTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // 5 x 3 cells of 20 units
+        grid.Configure(0.0f, 0.0f, 100.0f, 60.0f, 20.0f);
+    }
+
+    OccupancyGrid grid;
+};
+
+// Test board sizing
+TEST_F(OccupancyGridTest, Configure) {
+    EXPECT_EQ(grid.GetColumns(), 5);
+    EXPECT_EQ(grid.GetRows(), 3);
+    EXPECT_FLOAT_EQ(grid.GetCellSize(), 20.0f);
+
+    // A partial cell at the edge still counts
+    OccupancyGrid partial;
+    partial.Configure(0.0f, 0.0f, 110.0f, 50.0f, 20.0f);
+    EXPECT_EQ(partial.GetColumns(), 6);
+    EXPECT_EQ(partial.GetRows(), 3);
+}
+
+// Test that positions round to the nearest cell corner, so float drift stays in the cell
+TEST_F(OccupancyGridTest, RoundsToNearestCell) {
+    grid.AddSnake(40.0f, 20.0f);
+
+    EXPECT_TRUE(grid.HasSnake(40.0f, 20.0f));
+    EXPECT_TRUE(grid.HasSnake(39.999f, 20.001f));
+    EXPECT_TRUE(grid.HasSnake(30.0f, 10.0f));   // Halfway rounds up into the cell
+    EXPECT_TRUE(grid.HasSnake(49.9f, 29.9f));
+    EXPECT_FALSE(grid.HasSnake(29.9f, 20.0f));
+    EXPECT_FALSE(grid.HasSnake(50.0f, 20.0f));
+    EXPECT_FALSE(grid.HasSnake(40.0f, 30.0f));
+}
+
+// Test that off-board positions count as occupied and are never written
+TEST_F(OccupancyGridTest, OffBoard) {
+    EXPECT_FALSE(grid.IsFree(-20.0f, 0.0f));
+    EXPECT_FALSE(grid.IsFree(0.0f, -20.0f));
+    EXPECT_FALSE(grid.IsFree(100.0f, 0.0f));  // Column 5 of 0..4
+    EXPECT_FALSE(grid.IsFree(0.0f, 60.0f));
+    EXPECT_FALSE(grid.IsFree(-10.1f, 0.0f));
+
+    // Within half a cell of the edge rounds onto the board
+    EXPECT_TRUE(grid.IsFree(-9.9f, 0.0f));
+    EXPECT_TRUE(grid.IsFree(89.9f, 49.9f));
+
+    grid.AddSnake(-20.0f, 0.0f);
+    grid.SetWall(100.0f, 0.0f);
+    grid.SetFood(0.0f, 60.0f, 3);
+    EXPECT_FALSE(grid.HasSnake(-20.0f, 0.0f));
+    EXPECT_FALSE(grid.HasWall(100.0f, 0.0f));
+    EXPECT_EQ(grid.GetFood(0.0f, 60.0f), INVALID_ENTITY);
+    EXPECT_TRUE(grid.IsFree(0.0f, 0.0f));
+    EXPECT_TRUE(grid.IsFree(80.0f, 40.0f));
+}
+
+// Test snake reference counts through moves
+TEST_F(OccupancyGridTest, SnakeRefcounts) {
+    // Three segments in a row, tail at (0, 0)
+    grid.AddSnake(0.0f, 0.0f);
+    grid.AddSnake(20.0f, 0.0f);
+    grid.AddSnake(40.0f, 0.0f);
+
+    // The tail jumps ahead of the neck
+    grid.MoveSnake(0.0f, 0.0f, 60.0f, 0.0f);
+    EXPECT_FALSE(grid.HasSnake(0.0f, 0.0f));
+    EXPECT_TRUE(grid.HasSnake(20.0f, 0.0f));
+    EXPECT_TRUE(grid.HasSnake(60.0f, 0.0f));
+
+    // Two segments on one square: moving one off leaves it occupied
+    grid.AddSnake(20.0f, 0.0f);
+    grid.MoveSnake(20.0f, 0.0f, 20.0f, 20.0f);
+    EXPECT_TRUE(grid.HasSnake(20.0f, 0.0f));
+    EXPECT_TRUE(grid.HasSnake(20.0f, 20.0f));
+    grid.MoveSnake(20.0f, 0.0f, 40.0f, 20.0f);
+    EXPECT_FALSE(grid.HasSnake(20.0f, 0.0f));
+
+    // A one-segment snake moving into the square it leaves
+    grid.MoveSnake(60.0f, 0.0f, 60.0f, 0.0f);
+    EXPECT_TRUE(grid.HasSnake(60.0f, 0.0f));
+
+    // Removing more than was added doesn't wrap the count
+    grid.RemoveSnake(60.0f, 0.0f);
+    grid.RemoveSnake(60.0f, 0.0f);
+    EXPECT_FALSE(grid.HasSnake(60.0f, 0.0f));
+    grid.AddSnake(60.0f, 0.0f);
+    EXPECT_TRUE(grid.HasSnake(60.0f, 0.0f));
+
+    // Moving off the board only removes
+    grid.MoveSnake(60.0f, 0.0f, 60.0f, -20.0f);
+    EXPECT_FALSE(grid.HasSnake(60.0f, 0.0f));
+}
+
+// Test setting and clearing food
+TEST_F(OccupancyGridTest, Food) {
+    const Entity food = 7;
+    EXPECT_EQ(grid.GetFood(40.0f, 40.0f), INVALID_ENTITY);
+
+    grid.SetFood(40.0f, 40.0f, food);
+    EXPECT_EQ(grid.GetFood(40.0f, 40.0f), food);
+    EXPECT_EQ(grid.GetFood(41.0f, 39.0f), food);
+    EXPECT_EQ(grid.GetFood(20.0f, 40.0f), INVALID_ENTITY);
+    EXPECT_FALSE(grid.IsFree(40.0f, 40.0f));
+    EXPECT_FALSE(grid.HasSnake(40.0f, 40.0f));
+
+    // One food per cell, the newest wins
+    grid.SetFood(40.0f, 40.0f, 8);
+    EXPECT_EQ(grid.GetFood(40.0f, 40.0f), 8u);
+
+    grid.ClearFood(40.0f, 40.0f);
+    EXPECT_EQ(grid.GetFood(40.0f, 40.0f), INVALID_ENTITY);
+    EXPECT_TRUE(grid.IsFree(40.0f, 40.0f));
+}
+
+// Test that any snake, wall or food makes a cell non-free, and Clear empties the board
+TEST_F(OccupancyGridTest, IsFree) {
+    for (int row = 0; row < grid.GetRows(); ++row) {
+        for (int column = 0; column < grid.GetColumns(); ++column) {
+            EXPECT_TRUE(grid.IsFree(column * 20.0f, row * 20.0f));
+        }
+    }
+
+    grid.AddSnake(0.0f, 0.0f);
+    grid.SetWall(20.0f, 0.0f);
+    grid.SetFood(40.0f, 0.0f, 1);
+    EXPECT_FALSE(grid.IsFree(0.0f, 0.0f));
+    EXPECT_FALSE(grid.IsFree(20.0f, 0.0f));
+    EXPECT_FALSE(grid.IsFree(40.0f, 0.0f));
+    EXPECT_TRUE(grid.IsFree(60.0f, 0.0f));
+    EXPECT_TRUE(grid.HasWall(20.0f, 0.0f));
+
+    grid.SetWall(20.0f, 0.0f, false);
+    EXPECT_TRUE(grid.IsFree(20.0f, 0.0f));
+
+    grid.Clear();
+    EXPECT_TRUE(grid.IsFree(0.0f, 0.0f));
+    EXPECT_TRUE(grid.IsFree(40.0f, 0.0f));
+    EXPECT_EQ(grid.GetColumns(), 5);
+}
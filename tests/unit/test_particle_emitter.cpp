@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+#include "ECS/EntityManager.h"
+#include "ECS/Components/Position.h"
+#include "ECS/Components/Emitter.h"
+#include "ECS/Systems/EmitterSystem.h"
+#include "Particles/ParticleBuffer.h"
+
+using namespace Lite2D;
+using namespace Lite2D::ECS;
+
+// Test fixed capacity and integration
+TEST(ParticleBufferTest, AddAndUpdate) {
+    ParticleBuffer buffer(2);
+    EXPECT_TRUE(buffer.Add(0.0f, 0.0f, 10.0f, 0.0f, 1.0f));
+    EXPECT_TRUE(buffer.Add(5.0f, 5.0f, 0.0f, -10.0f, 1.0f));
+    EXPECT_FALSE(buffer.Add(0.0f, 0.0f, 0.0f, 0.0f, 1.0f));
+    EXPECT_TRUE(buffer.IsFull());
+
+    buffer.Update(0.5f, 0.0f, 20.0f);
+    EXPECT_FLOAT_EQ(buffer.GetX()[0], 5.0f);
+    EXPECT_FLOAT_EQ(buffer.GetVelocityY()[0], 10.0f);
+    EXPECT_FLOAT_EQ(buffer.GetY()[0], 5.0f);
+    EXPECT_FLOAT_EQ(buffer.GetY()[1], 5.0f);
+    EXPECT_FLOAT_EQ(buffer.GetAge()[1], 0.5f);
+}
+
+// Test that compaction removes only expired particles and keeps order
+TEST(ParticleBufferTest, RemoveExpiredCompacts) {
+    ParticleBuffer buffer(8);
+    for (int i = 0; i < 8; ++i) {
+        buffer.Add(static_cast<float>(i), 0.0f, 0.0f, 0.0f, i % 2 ? 1.0f : 0.25f);
+    }
+
+    buffer.Update(0.5f);
+    EXPECT_EQ(buffer.RemoveExpired(), 4u);
+    ASSERT_EQ(buffer.GetCount(), 4u);
+    for (size_t i = 0; i < buffer.GetCount(); ++i) {
+        EXPECT_FLOAT_EQ(buffer.GetX()[i], static_cast<float>(i * 2 + 1));
+    }
+}
+
+class EmitterSystemTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        entityManager = std::make_unique<EntityManager>();
+        entity = entityManager->CreateEntity();
+        entityManager->AddComponent(entity, Position(100.0f, 100.0f));
+
+        Emitter emitter(60.0f, 1000);
+        emitter.lifetimeMin = 1.0f;
+        emitter.lifetimeMax = 1.0f;
+        entityManager->AddComponent(entity, emitter);
+    }
+
+    std::unique_ptr<EntityManager> entityManager;
+    EmitterSystem emitterSystem;
+    Entity entity;
+};
+
+// Test spawn rate, lifetime and burst
+TEST_F(EmitterSystemTest, EmitsAtRateAndExpires) {
+    // 60 particles/sec at 60 Hz = one per frame
+    for (int frame = 0; frame < 30; ++frame) {
+        emitterSystem.Update(*entityManager, 1.0f / 60.0f);
+    }
+    EXPECT_NEAR(static_cast<double>(emitterSystem.GetParticleCount()), 30.0, 1.0);
+
+    // Steady state: one second of lifetime holds ~60 particles
+    for (int frame = 0; frame < 120; ++frame) {
+        emitterSystem.Update(*entityManager, 1.0f / 60.0f);
+    }
+    EXPECT_NEAR(static_cast<double>(emitterSystem.GetParticleCount()), 60.0, 2.0);
+
+    Emitter* emitter = entityManager->GetComponent<Emitter>(entity);
+    emitter->emitting = false;
+    emitter->burst = 500;
+    size_t before = emitterSystem.GetParticleCount();
+    emitterSystem.Update(*entityManager, 1.0f / 60.0f);
+    EXPECT_EQ(emitter->burst, 0);
+    EXPECT_GE(emitterSystem.GetParticleCount(), before + 500 - 2);
+
+    // Not emitting: everything dies out after one lifetime
+    for (int frame = 0; frame < 70; ++frame) {
+        emitterSystem.Update(*entityManager, 1.0f / 60.0f);
+    }
+    EXPECT_EQ(emitterSystem.GetParticleCount(), 0u);
+}
+
+// Test that capacity caps the particle count
+TEST_F(EmitterSystemTest, RespectsCapacity) {
+    Emitter* emitter = entityManager->GetComponent<Emitter>(entity);
+    emitter->maxParticles = 100;
+    emitter->burst = 1000;
+    emitterSystem.Update(*entityManager, 1.0f / 60.0f);
+    EXPECT_EQ(emitterSystem.GetParticleCount(), 100u);
+}
+
+// Test identical seeds produce identical particles
+TEST_F(EmitterSystemTest, DeterministicPerSeed) {
+    EmitterSystem other;
+    for (int frame = 0; frame < 20; ++frame) {
+        emitterSystem.Update(*entityManager, 1.0f / 60.0f);
+    }
+    const ParticleBuffer* first = emitterSystem.GetParticles(entity);
+    ASSERT_NE(first, nullptr);
+    std::vector<float> firstX(first->GetX(), first->GetX() + first->GetCount());
+
+    EntityManager otherManager;
+    Entity otherEntity = otherManager.CreateEntity();
+    otherManager.AddComponent(otherEntity, Position(100.0f, 100.0f));
+    otherManager.AddComponent(otherEntity, *entityManager->GetComponent<Emitter>(entity));
+    for (int frame = 0; frame < 20; ++frame) {
+        other.Update(otherManager, 1.0f / 60.0f);
+    }
+    const ParticleBuffer* second = other.GetParticles(otherEntity);
+    ASSERT_NE(second, nullptr);
+    ASSERT_EQ(second->GetCount(), firstX.size());
+    for (size_t i = 0; i < firstX.size(); ++i) {
+        EXPECT_FLOAT_EQ(second->GetX()[i], firstX[i]);
+    }
+}
+
+// Test that removing the component releases the emitter's particles
+TEST_F(EmitterSystemTest, ReleasedWithComponent) {
+    emitterSystem.Update(*entityManager, 0.5f);
+    EXPECT_GT(emitterSystem.GetParticleCount(), 0u);
+
+    entityManager->DestroyEntity(entity);
+    emitterSystem.Update(*entityManager, 0.016f);
+    EXPECT_EQ(emitterSystem.GetParticleCount(), 0u);
+    EXPECT_TRUE(emitterSystem.GetEmitters().empty());
+}
+
+// Test that a damaged system snapshot is rejected and leaves the live particles alone
+TEST_F(EmitterSystemTest, RejectsBadSnapshot) {
+    emitterSystem.Update(*entityManager, 0.5f);
+    const size_t count = emitterSystem.GetParticleCount();
+    ASSERT_GT(count, 0u);
+
+    SnapshotWriter writer;
+    emitterSystem.WriteSnapshot(writer);
+    std::vector<uint8_t> data(writer.GetData(), writer.GetData() + writer.GetSize());
+
+    // Emitter count, entity, accumulator, seed, random state, size, two colors, layer, then capacity
+    const size_t capacityOffset = sizeof(uint64_t) + sizeof(Entity) + sizeof(float) + sizeof(uint32_t) +
+                                  4 * sizeof(uint32_t) + sizeof(float) + 2 * sizeof(SDL_Color) + sizeof(int);
+    uint64_t capacity = 0;
+    std::memcpy(&capacity, data.data() + capacityOffset, sizeof(capacity));
+    ASSERT_EQ(capacity, 1000u);
+
+    const uint64_t huge = uint64_t(1) << 60;
+    std::memcpy(data.data() + capacityOffset, &huge, sizeof(huge));
+    SnapshotReader oversized(data.data(), data.size());
+    emitterSystem.ReadSnapshot(oversized);
+    EXPECT_FALSE(oversized.IsOk());
+    EXPECT_EQ(emitterSystem.GetParticleCount(), count);
+
+    // Cut off inside the particle arrays
+    SnapshotReader truncated(writer.GetData(), writer.GetSize() - 8);
+    emitterSystem.ReadSnapshot(truncated);
+    EXPECT_FALSE(truncated.IsOk());
+    EXPECT_EQ(emitterSystem.GetParticleCount(), count);
+    ASSERT_NE(emitterSystem.GetParticles(entity), nullptr);
+    EXPECT_EQ(emitterSystem.GetParticles(entity)->GetCapacity(), 1000u);
+
+    SnapshotReader intact(writer.GetData(), writer.GetSize());
+    emitterSystem.ReadSnapshot(intact);
+    EXPECT_TRUE(intact.IsOk());
+    EXPECT_EQ(emitterSystem.GetParticleCount(), count);
+}
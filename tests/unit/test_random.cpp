@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+#include <bitset>
+#include <random>
+#include <vector>
+#include "Utils/Random.h"
+#include "Utils/ThreadPool.h"
+#include "ECS/SystemManager.h"
+#include "ECS/Systems/MovementSystem.h"
+#include "ECS/Systems/EmitterSystem.h"
+
+using namespace Lite2D;
+using namespace Lite2D::ECS;
+
+// Test that a seed fully determines the stream
+TEST(RandomTest, DeterministicPerSeed) {
+    Random first(42);
+    Random second(42);
+    Random other(43);
+
+    bool differs = false;
+    for (int i = 0; i < 1000; ++i) {
+        uint32_t value = first.NextUInt32();
+        EXPECT_EQ(value, second.NextUInt32());
+        differs |= value != other.NextUInt32();
+    }
+    EXPECT_TRUE(differs);
+
+    first.Seed(42);
+    second.Seed(42);
+    EXPECT_EQ(first.NextUInt64(), second.NextUInt64());
+    EXPECT_EQ(first.GetSeed(), 42u);
+}
+
+// Test range helpers stay in bounds and reach both ends of integer ranges
+TEST(RandomTest, RangesInBounds) {
+    Random random(7);
+    bool sawMin = false;
+    bool sawMax = false;
+    for (int i = 0; i < 10000; ++i) {
+        float f = random.Range(-2.0f, 3.0f);
+        EXPECT_GE(f, -2.0f);
+        EXPECT_LT(f, 3.0f);
+
+        int n = random.Range(-3, 3);
+        EXPECT_GE(n, -3);
+        EXPECT_LE(n, 3);
+        sawMin |= n == -3;
+        sawMax |= n == 3;
+    }
+    EXPECT_TRUE(sawMin);
+    EXPECT_TRUE(sawMax);
+}
+
+// Test batch fills are deterministic, in range and roughly uniform
+TEST(RandomTest, FillMatchesSeed) {
+    for (size_t count : {5u, 37u, 10000u}) {
+        Random first(3);
+        Random second(3);
+        std::vector<float> a(count);
+        std::vector<float> b(count);
+        first.Fill(a.data(), count, 10.0f, 20.0f);
+        second.Fill(b.data(), count, 10.0f, 20.0f);
+        EXPECT_EQ(a, b);
+
+        double sum = 0.0;
+        for (float value : a) {
+            EXPECT_GE(value, 10.0f);
+            EXPECT_LT(value, 20.0f);
+            sum += value;
+        }
+        if (count == 10000u) {
+            EXPECT_NEAR(sum / count, 15.0, 0.2);
+        }
+
+        // Parents stay in step after a fill
+        EXPECT_EQ(first.NextUInt32(), second.NextUInt32());
+    }
+
+    Random bits(9);
+    std::vector<uint32_t> raw(1000);
+    bits.Fill(raw.data(), raw.size());
+    size_t ones = 0;
+    for (uint32_t value : raw) {
+        ones += std::bitset<32>(value).count();
+    }
+    EXPECT_NEAR(static_cast<double>(ones) / (raw.size() * 32), 0.5, 0.02);
+}
+
+// Test that forks are repeatable and independent of the parent's position and of each other
+TEST(RandomTest, ForksAreStable) {
+    Random root(100);
+    Random a = root.Fork(1);
+    root.NextUInt32();
+    Random b = root.Fork(1);
+    Random c = root.Fork(2);
+
+    uint32_t first = a.NextUInt32();
+    EXPECT_EQ(first, b.NextUInt32());
+    EXPECT_NE(first, c.NextUInt32());
+    EXPECT_EQ(root.Fork("ParticleSystem").NextUInt32(), Random(100).Fork("ParticleSystem").NextUInt32());
+}
+
+// Test that per-item forks give identical results whatever the thread count
+TEST(RandomTest, ReproducibleAcrossThreads) {
+    const size_t count = 1000;
+    const Random root(2024);
+
+    auto generate = [&](size_t threads) {
+        ThreadPool pool(threads);
+        std::vector<float> values(count);
+        pool.ParallelFor(count, [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; ++i) {
+                Random random = root.Fork(i);
+                values[i] = random.NextFloat();
+            }
+        });
+        return values;
+    };
+
+    EXPECT_EQ(generate(1), generate(4));
+}
+
+// Test compatibility with the standard distributions
+TEST(RandomTest, UniformRandomBitGenerator) {
+    Random first(5);
+    Random second(5);
+    std::uniform_int_distribution<int> distribution(1, 6);
+    for (int i = 0; i < 100; ++i) {
+        int roll = distribution(first);
+        EXPECT_GE(roll, 1);
+        EXPECT_LE(roll, 6);
+        EXPECT_EQ(roll, distribution(second));
+    }
+}
+
+// Test that SystemManager gives each system its own stream of the manager's seed
+TEST(RandomTest, SystemStreamsFollowSeed) {
+    SystemManager first;
+    SystemManager second;
+    first.SetRandomSeed(11);
+    auto movementA = first.RegisterSystem<MovementSystem>(); // Registered after the seed
+    auto emitterA = first.RegisterSystem<EmitterSystem>();
+    auto emitterB = second.RegisterSystem<EmitterSystem>();
+    auto movementB = second.RegisterSystem<MovementSystem>(); // Order doesn't matter
+    second.SetRandomSeed(11);                                 // Registered before the seed
+
+    uint32_t movement = movementA->GetRandom().NextUInt32();
+    EXPECT_EQ(movement, movementB->GetRandom().NextUInt32());
+    EXPECT_EQ(emitterA->GetRandom().NextUInt32(), emitterB->GetRandom().NextUInt32());
+    EXPECT_NE(movement, emitterA->GetRandom().NextUInt32());
+
+    second.SetRandomSeed(12);
+    EXPECT_EQ(Random(Random::DeriveSeed(12, Random::HashName("MovementSystem"))).NextUInt32(),
+              movementB->GetRandom().NextUInt32());
+}
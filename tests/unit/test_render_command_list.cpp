@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include "Rendering/HeadlessRenderer.h"
+#include "Rendering/RenderCommandList.h"
+#include <cstdio>
+#include <fstream>
+
+class RenderCommandListTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        headlessRenderer = std::make_unique<HeadlessRenderer>();
+        ASSERT_TRUE(headlessRenderer->Initialize(64, 64));
+    }
+
+    void TearDown() override {
+        headlessRenderer.reset();
+    }
+
+    std::unique_ptr<HeadlessRenderer> headlessRenderer;
+    RenderCommandList commandList;
+};
+
+// Test that replay honors layers regardless of record order
+TEST_F(RenderCommandListTest, LayerOrder) {
+    const SDL_FRect rect = {0.0f, 0.0f, 16.0f, 16.0f};
+    commandList.RecordFillRect(1, rect, {255, 0, 0, 255});
+    commandList.RecordFillRect(0, rect, {0, 0, 255, 255});
+
+    commandList.Submit(headlessRenderer->GetRendererObject());
+
+    SDL_Color color;
+    ASSERT_TRUE(headlessRenderer->ReadPixel(8, 8, color));
+    EXPECT_EQ(color.r, 255);
+    EXPECT_EQ(color.b, 0);
+}
+
+// Test that adjacent same-state commands collapse into batched calls
+TEST_F(RenderCommandListTest, BatchesIdenticalState) {
+    const SDL_Color red = {255, 0, 0, 255};
+    const SDL_Color green = {0, 255, 0, 255};
+
+    // Two runs of one color each
+    for (int i = 0; i < 10; ++i) {
+        SDL_FRect rect = {static_cast<float>(i * 4), 0.0f, 4.0f, 4.0f};
+        commandList.RecordFillRect(0, rect, i < 5 ? green : red);
+    }
+
+    commandList.Submit(headlessRenderer->GetRendererObject());
+
+    const auto& stats = commandList.GetLastSubmitStats();
+    EXPECT_EQ(stats.commands, 10u);
+    EXPECT_EQ(stats.drawCalls, 2u);
+    EXPECT_EQ(stats.stateChanges, 2u);
+
+    // Submit leaves the list intact, Clear resets it
+    EXPECT_EQ(commandList.GetCommandCount(), 10u);
+    commandList.Clear();
+    EXPECT_EQ(commandList.GetCommandCount(), 0u);
+}
+
+// Test that overlapping draws on one layer keep their record order
+TEST_F(RenderCommandListTest, SameLayerKeepsRecordOrder) {
+    const SDL_Color red = {255, 0, 0, 255};
+    const SDL_Color green = {0, 255, 0, 255};
+    const SDL_Color blue = {0, 0, 255, 255};
+
+    // Interleaved colors overlapping pairwise; batching them by color would change what is on top
+    for (int i = 0; i < 9; ++i) {
+        SDL_FRect rect = {static_cast<float>(i * 4), 0.0f, 8.0f, 8.0f};
+        commandList.RecordFillRect(0, rect, i % 3 == 0 ? red : (i % 3 == 1 ? green : blue));
+    }
+    commandList.RecordFillRect(1, {28.0f, 18.0f, 8.0f, 4.0f}, red); // Recorded on a higher layer...
+    commandList.RecordFillRect(0, {0.0f, 16.0f, 64.0f, 8.0f}, blue); // ...still drawn over this
+
+    commandList.Submit(headlessRenderer->GetRendererObject());
+
+    SDL_Color color;
+    for (int i = 1; i < 9; ++i) {
+        // Where a rect overlaps the one before it, the later one is on top
+        ASSERT_TRUE(headlessRenderer->ReadPixel(i * 4 + 1, 4, color));
+        const SDL_Color expected = i % 3 == 0 ? red : (i % 3 == 1 ? green : blue);
+        EXPECT_EQ(color.r, expected.r) << "rect " << i;
+        EXPECT_EQ(color.g, expected.g) << "rect " << i;
+        EXPECT_EQ(color.b, expected.b) << "rect " << i;
+    }
+    ASSERT_TRUE(headlessRenderer->ReadPixel(32, 20, color));
+    EXPECT_EQ(color.r, 255);
+    EXPECT_EQ(color.b, 0);
+
+    // Only the last small rect and the adjacent wide one (both blue) batch
+    EXPECT_EQ(commandList.GetLastSubmitStats().drawCalls, 10u);
+}
+
+// Test merging lists recorded separately
+TEST_F(RenderCommandListTest, AppendKeepsText) {
+    RenderCommandList other;
+    other.RecordText(0, "second", 0.0f, 0.0f, {255, 255, 255, 255});
+    commandList.RecordText(0, "first", 0.0f, 0.0f, {255, 255, 255, 255});
+
+    commandList.Append(other);
+
+    const auto& commands = commandList.GetCommands();
+    ASSERT_EQ(commands.size(), 2u);
+    EXPECT_STREQ(commandList.GetText(commands[0]), "first");
+    EXPECT_STREQ(commandList.GetText(commands[1]), "second");
+    EXPECT_LT(commands[0].sequence, commands[1].sequence);
+}
+
+// Test capture to file
+TEST_F(RenderCommandListTest, WriteToFile) {
+    commandList.RecordFillRect(0, {0.0f, 0.0f, 4.0f, 4.0f}, {255, 0, 0, 255});
+    commandList.RecordText(1, "capture", 0.0f, 0.0f, {255, 255, 255, 255});
+
+    const std::string path = "render_capture_test.bin";
+    ASSERT_TRUE(commandList.WriteToFile(path));
+
+    std::ifstream in(path, std::ios::binary);
+    ASSERT_TRUE(in.good());
+
+    char magic[4] = {};
+    uint32_t version = 0, count = 0, textBytes = 0;
+    in.read(magic, sizeof(magic));
+    in.read(reinterpret_cast<char*>(&version), sizeof(version));
+    in.read(reinterpret_cast<char*>(&count), sizeof(count));
+    in.read(reinterpret_cast<char*>(&textBytes), sizeof(textBytes));
+
+    EXPECT_EQ(std::string(magic, 4), "L2RC");
+    EXPECT_EQ(version, 2u);
+    EXPECT_EQ(count, 2u);
+    EXPECT_EQ(textBytes, 8u); // "capture" + terminator
+
+    in.close();
+    std::remove(path.c_str());
+}
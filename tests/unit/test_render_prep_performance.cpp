@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "Rendering/SpriteGeometry.h"
+#include "Utils/ThreadPool.h"
+#include "ECS/Components/Position.h"
+#include "ECS/Components/Renderable.h"
+
+using namespace Lite2D::ECS;
+
+// Render preparation runs over plain component arrays here, since the entity
+// limit (MAX_ENTITIES) is far below the sprite counts this scales to
+class RenderPrepPerformanceTest : public ::testing::Test {
+protected:
+    static constexpr size_t SPRITE_COUNT = 100000;
+
+    void SetUp() override {
+        positions.reserve(SPRITE_COUNT);
+        renderables.reserve(SPRITE_COUNT);
+        for (size_t i = 0; i < SPRITE_COUNT; ++i) {
+            positions.emplace_back(static_cast<float>(i % 800), static_cast<float>((i / 800) % 600));
+            // Already in layer order, as RenderSystem sorts before building
+            renderables.emplace_back(true, static_cast<int>(i * 4 / SPRITE_COUNT));
+        }
+    }
+
+    // The builder RenderSystem runs on its worker threads
+    void PrepareRange(size_t begin, size_t end, SpriteChunk& chunk) const {
+        BuildSpriteChunk(positions.data() + begin, renderables.data() + begin, end - begin,
+                         16.0f, 8.0f, true, chunk);
+    }
+
+    std::vector<Position> positions;
+    std::vector<Renderable> renderables;
+};
+
+// Test chunking covers every sprite exactly once
+TEST_F(RenderPrepPerformanceTest, ChunksCoverAllSprites) {
+    ThreadPool pool(4);
+    std::vector<SpriteChunk> chunks(pool.GetThreadCount());
+
+    pool.ParallelFor(SPRITE_COUNT, [&](size_t begin, size_t end, size_t chunkIndex) {
+        PrepareRange(begin, end, chunks[chunkIndex]);
+    });
+
+    size_t totalIndices = 0;
+    size_t runIndices = 0;
+    for (const SpriteChunk& chunk : chunks) {
+        totalIndices += chunk.geometry.GetIndexCount();
+        for (const GeometryRun& run : chunk.runs) {
+            runIndices += run.indexCount;
+        }
+    }
+    EXPECT_EQ(totalIndices, SPRITE_COUNT * 12);
+    EXPECT_EQ(runIndices, totalIndices);
+}
+
+// Test scaling from 1 to N threads at 100k sprites
+TEST_F(RenderPrepPerformanceTest, ScalingAcrossThreads) {
+    const size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    const int frames = 20;
+    float singleThreadMs = 0.0f;
+
+    // 1, 2, 4, ... and finally every hardware thread
+    for (size_t threads = 1; threads <= maxThreads;
+         threads = (threads < maxThreads && threads * 2 > maxThreads) ? maxThreads : threads * 2) {
+        ThreadPool pool(threads);
+        std::vector<SpriteChunk> chunks(pool.GetThreadCount());
+
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for (int frame = 0; frame < frames; ++frame) {
+            for (SpriteChunk& chunk : chunks) {
+                chunk.Clear();
+            }
+            pool.ParallelFor(SPRITE_COUNT, [&](size_t begin, size_t end, size_t chunkIndex) {
+                PrepareRange(begin, end, chunks[chunkIndex]);
+            });
+        }
+
+        auto end = std::chrono::high_resolution_clock::now();
+        float perFrameMs = std::chrono::duration<float, std::milli>(end - start).count() / frames;
+        if (threads == 1) {
+            singleThreadMs = perFrameMs;
+        }
+
+        std::cout << "\n[RENDER PREP] " << SPRITE_COUNT << " sprites, " << threads << " thread(s): "
+                  << perFrameMs << "ms per frame, speedup " << (singleThreadMs / perFrameMs) << "x" << std::endl;
+
+        // Prep for 100k sprites should stay well inside a frame budget
+        EXPECT_LT(perFrameMs, 100.0f) << "Render preparation too slow with " << threads << " thread(s)";
+    }
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+#include "ECS/RewindBuffer.h"
+
+using namespace Lite2D::ECS;
+
+namespace {
+
+// Frame whose bytes depend on the frame number only in the pages listed
+std::vector<uint8_t> MakeFrame(size_t size, int frame, std::initializer_list<size_t> changingPages, size_t pageSize) {
+    std::vector<uint8_t> bytes(size);
+    for (size_t i = 0; i < size; ++i) {
+        bytes[i] = static_cast<uint8_t>(i * 31);
+    }
+    for (size_t page : changingPages) {
+        for (size_t i = page * pageSize; i < std::min(size, (page + 1) * pageSize); ++i) {
+            bytes[i] = static_cast<uint8_t>(i + frame * 7);
+        }
+    }
+    return bytes;
+}
+
+std::vector<uint8_t> Newest(const RewindBuffer& buffer) {
+    return std::vector<uint8_t>(buffer.GetNewestData(), buffer.GetNewestData() + buffer.GetNewestSize());
+}
+
+} // namespace
+
+// Test that only changed pages are stored and rewinding rebuilds every frame exactly
+TEST(RewindBufferTest, StoresChangedPagesAndRewinds) {
+    const size_t pageSize = 256;
+    RewindBuffer buffer(1024 * 1024, pageSize);
+    std::vector<std::vector<uint8_t>> frames;
+    for (int frame = 0; frame < 10; ++frame) {
+        frames.push_back(MakeFrame(10 * pageSize + 100, frame, {2, 7}, pageSize));
+        buffer.Push(frames.back().data(), frames.back().size());
+    }
+    EXPECT_EQ(buffer.GetDepth(), 9u);
+    EXPECT_EQ(buffer.GetLastPageCount(), 11u);
+    EXPECT_EQ(buffer.GetLastDirtyPageCount(), 2u);
+
+    // Frames that grow and shrink, including a partial last page
+    frames.push_back(MakeFrame(12 * pageSize + 5, 10, {2}, pageSize));
+    buffer.Push(frames.back().data(), frames.back().size());
+    frames.push_back(MakeFrame(3 * pageSize, 11, {}, pageSize));
+    buffer.Push(frames.back().data(), frames.back().size());
+    EXPECT_EQ(buffer.GetLastDirtyPageCount(), 1u); // Page 2 reverts; the cut-off pages don't count
+
+    // Reading a frame back leaves the history alone
+    std::vector<uint8_t> read;
+    ASSERT_TRUE(buffer.ReadFrame(4, read));
+    EXPECT_EQ(read, frames[7]);
+    ASSERT_TRUE(buffer.ReadFrame(0, read));
+    EXPECT_EQ(read, frames[11]);
+    EXPECT_FALSE(buffer.ReadFrame(12, read));
+    EXPECT_EQ(buffer.GetDepth(), 11u);
+    EXPECT_EQ(Newest(buffer), frames[11]);
+
+    ASSERT_TRUE(buffer.Rewind(1));
+    EXPECT_EQ(Newest(buffer), frames[10]);
+    ASSERT_TRUE(buffer.Rewind(3));
+    EXPECT_EQ(Newest(buffer), frames[7]);
+    EXPECT_EQ(buffer.GetDepth(), 7u);
+
+    // Recording continues from the rewound frame
+    frames.resize(8);
+    frames.push_back(MakeFrame(10 * pageSize + 100, 42, {0}, pageSize));
+    buffer.Push(frames.back().data(), frames.back().size());
+    ASSERT_TRUE(buffer.Rewind(8));
+    EXPECT_EQ(Newest(buffer), frames[0]);
+    EXPECT_FALSE(buffer.Rewind(1));
+}
+
+// Test that the history drops its oldest frames to stay within the memory budget
+TEST(RewindBufferTest, StaysWithinBudget) {
+    const size_t pageSize = 256;
+    const size_t maxBytes = 16 * 1024;
+    RewindBuffer buffer(maxBytes, pageSize);
+
+    std::vector<uint8_t> last;
+    std::vector<uint8_t> previous;
+    for (int frame = 0; frame < 200; ++frame) {
+        previous = last;
+        last = MakeFrame(8 * pageSize, frame, {1, 4, 5}, pageSize);
+        buffer.Push(last.data(), last.size());
+        EXPECT_LE(buffer.GetMemoryUsage(), maxBytes);
+    }
+
+    // 2 KB frame plus ~800 bytes per delta
+    EXPECT_GT(buffer.GetDepth(), 5u);
+    EXPECT_LT(buffer.GetDepth(), 20u);
+
+    ASSERT_TRUE(buffer.Rewind(1));
+    EXPECT_EQ(Newest(buffer), previous);
+    EXPECT_FALSE(buffer.Rewind(buffer.GetDepth() + 1));
+
+    buffer.Clear();
+    EXPECT_TRUE(buffer.IsEmpty());
+    EXPECT_EQ(buffer.GetDepth(), 0u);
+}
@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include "Rendering/HeadlessRenderer.h"
+#include "Rendering/ShapeBatcher.h"
+
+class ShapeBatcherTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        headlessRenderer = std::make_unique<HeadlessRenderer>();
+        ASSERT_TRUE(headlessRenderer->Initialize(64, 64));
+    }
+
+    void TearDown() override {
+        headlessRenderer.reset();
+    }
+
+    std::unique_ptr<HeadlessRenderer> headlessRenderer;
+    ShapeBatcher batcher;
+};
+
+// Test that a circle covers its interior and leaves its bounding box corners alone
+TEST_F(ShapeBatcherTest, CircleCoverage) {
+    batcher.AddCircle(32.0f, 32.0f, 16.0f, {255, 0, 0, 255});
+    ASSERT_TRUE(batcher.Submit(headlessRenderer->GetRendererObject()));
+
+    SDL_Color color;
+    ASSERT_TRUE(headlessRenderer->ReadPixel(32, 32, color));
+    EXPECT_EQ(color.r, 255);
+
+    ASSERT_TRUE(headlessRenderer->ReadPixel(32, 18, color));
+    EXPECT_EQ(color.r, 255);
+
+    ASSERT_TRUE(headlessRenderer->ReadPixel(19, 19, color));
+    EXPECT_EQ(color.r, 0);
+}
+
+// Test that tessellation scales with radius and meshes are shared
+TEST_F(ShapeBatcherTest, MeshCache) {
+    EXPECT_LE(ShapeBatcher::GetCircleSegments(2.0f), ShapeBatcher::GetCircleSegments(20.0f));
+    EXPECT_EQ(ShapeBatcher::GetCircleSegments(1000.0f), 128);
+
+    for (int i = 0; i < 100; ++i) {
+        batcher.AddCircle(10.0f, 10.0f, 5.0f, {255, 255, 255, 255});
+    }
+    EXPECT_EQ(batcher.GetShapeCount(), 100u);
+    EXPECT_EQ(batcher.GetCachedMeshCount(), 1u);
+
+    batcher.AddCircle(10.0f, 10.0f, 40.0f, {255, 255, 255, 255});
+    EXPECT_EQ(batcher.GetCachedMeshCount(), 2u);
+
+    // Clearing drops shapes but keeps the cache
+    batcher.Clear();
+    EXPECT_EQ(batcher.GetShapeCount(), 0u);
+    EXPECT_EQ(batcher.GetGeometry().GetIndexCount(), 0u);
+    EXPECT_EQ(batcher.GetCachedMeshCount(), 2u);
+}
+
+// Test that many differently colored shapes share one buffer
+TEST_F(ShapeBatcherTest, ManyShapesOneBuffer) {
+    for (int i = 0; i < 10000; ++i) {
+        SDL_Color color = {static_cast<Uint8>(i), static_cast<Uint8>(i * 3), static_cast<Uint8>(i * 7), 255};
+        batcher.AddCircle(static_cast<float>(i % 64), static_cast<float>((i / 64) % 64), 3.0f, color);
+    }
+    batcher.AddRect({0.0f, 0.0f, 4.0f, 4.0f}, {0, 255, 0, 255});
+
+    const int segments = ShapeBatcher::GetCircleSegments(3.0f);
+    EXPECT_EQ(batcher.GetGeometry().GetVertexCount(), 10000u * (segments + 1) + 4u);
+    EXPECT_EQ(batcher.GetGeometry().GetIndexCount(), 10000u * segments * 3 + 6u);
+    EXPECT_TRUE(batcher.Submit(headlessRenderer->GetRendererObject()));
+}
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <deque>
+#include "Components/SnakeBody.h"
+#include "ECS/StateHash.h"
+#include "ECS/Snapshot.h"
+
+using namespace Lite2D::ECS;
+
+namespace {
+
+SnakeBody::Cell MakeCell(int i) {
+    SnakeBody::Cell cell;
+    cell.x = i * 20.0f;
+    cell.y = i * -20.0f;
+    cell.segment = static_cast<Entity>(100 + i);
+    return cell;
+}
+
+// Body contents equal the reference, neck first
+void ExpectCells(const SnakeBody& body, const std::deque<SnakeBody::Cell>& expected) {
+    ASSERT_EQ(body.GetLength(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_FLOAT_EQ(body.At(i).x, expected[i].x) << "cell " << i;
+        EXPECT_FLOAT_EQ(body.At(i).y, expected[i].y) << "cell " << i;
+        EXPECT_EQ(body.At(i).segment, expected[i].segment) << "cell " << i;
+    }
+}
+
+uint64_t Hash(const SnakeBody& body) {
+    StateHasher hasher;
+    body.HashState(hasher);
+    return hasher.GetHash();
+}
+
+// Four cells, then enough move steps that the front has wrapped past index 0 several times
+void MakeWrapped(SnakeBody& body, std::deque<SnakeBody::Cell>& expected, int steps) {
+    for (int i = 0; i < 4; ++i) {
+        body.PushBack(MakeCell(i));
+        expected.push_back(MakeCell(i));
+    }
+    for (int i = 0; i < steps; ++i) {
+        SnakeBody::Cell tail = body.PopBack();
+        EXPECT_EQ(tail.segment, expected.back().segment);
+        expected.pop_back();
+
+        body.PushFront(MakeCell(10 + i));
+        expected.push_front(MakeCell(10 + i));
+    }
+}
+
+} // namespace
+
+// Test that move steps wrap around the ring without growing it
+TEST(SnakeBodyTest, PushFrontPopBackWraps) {
+    SnakeBody body(16);
+    ASSERT_EQ(body.GetCapacity(), 16u);
+    EXPECT_TRUE(body.IsEmpty());
+
+    std::deque<SnakeBody::Cell> expected;
+    MakeWrapped(body, expected, 50);
+    ExpectCells(body, expected);
+    EXPECT_EQ(body.GetCapacity(), 16u);
+    EXPECT_EQ(body.Front().segment, expected.front().segment);
+    EXPECT_EQ(body.Back().segment, expected.back().segment);
+
+    // Popping empties it and an empty pop returns a blank cell
+    while (!body.IsEmpty()) body.PopBack();
+    EXPECT_EQ(body.PopBack().segment, INVALID_ENTITY);
+    EXPECT_EQ(body.GetLength(), 0u);
+}
+
+// Test that growing a wrapped ring unwraps it in body order
+TEST(SnakeBodyTest, ReserveWhileWrapped) {
+    SnakeBody body(16);
+    std::deque<SnakeBody::Cell> expected;
+    MakeWrapped(body, expected, 14); // Front at slot 2
+
+    // Fill the ring, wrapping the front back past index 0
+    for (int i = 0; i < 12; ++i) {
+        body.PushFront(MakeCell(50 + i));
+        expected.push_front(MakeCell(50 + i));
+    }
+    ASSERT_EQ(body.GetLength(), body.GetCapacity());
+    ExpectCells(body, expected);
+
+    // Full: the next push grows storage
+    body.PushFront(MakeCell(70));
+    expected.push_front(MakeCell(70));
+    EXPECT_EQ(body.GetCapacity(), 32u);
+    ExpectCells(body, expected);
+
+    // Explicit reserve while wrapped again
+    for (int i = 0; i < 40; ++i) {
+        body.PopBack();
+        expected.pop_back();
+        body.PushFront(MakeCell(80 + i));
+        expected.push_front(MakeCell(80 + i));
+    }
+    body.Reserve(100);
+    EXPECT_EQ(body.GetCapacity(), 128u);
+    ExpectCells(body, expected);
+
+    // Reserving less than the capacity changes nothing
+    body.Reserve(10);
+    EXPECT_EQ(body.GetCapacity(), 128u);
+    ExpectCells(body, expected);
+}
+
+// Test that a wrapped ring survives a snapshot round trip, with layout-independent bytes and hash
+TEST(SnakeBodyTest, SnapshotRoundTripWrapped) {
+    SnakeBody wrapped(16);
+    std::deque<SnakeBody::Cell> expected;
+    MakeWrapped(wrapped, expected, 27);
+
+    // Same cells stored unwrapped
+    SnakeBody straight;
+    for (const SnakeBody::Cell& cell : expected) straight.PushBack(cell);
+    EXPECT_EQ(Hash(wrapped), Hash(straight));
+
+    SnapshotWriter writer;
+    wrapped.WriteSnapshot(writer);
+    SnapshotWriter straightWriter;
+    straight.WriteSnapshot(straightWriter);
+    ASSERT_EQ(writer.GetSize(), straightWriter.GetSize());
+    EXPECT_EQ(std::memcmp(writer.GetData(), straightWriter.GetData(), writer.GetSize()), 0);
+
+    SnakeBody loaded;
+    loaded.PushBack(MakeCell(99)); // Replaced by the load
+    SnapshotReader reader(writer.GetData(), writer.GetSize());
+    loaded.ReadSnapshot(reader);
+    ASSERT_TRUE(reader.IsOk());
+    EXPECT_EQ(reader.GetRemaining(), 0u);
+    ExpectCells(loaded, expected);
+    EXPECT_EQ(Hash(loaded), Hash(wrapped));
+
+    // Moves continue the same way after the load
+    wrapped.PopBack();
+    wrapped.PushFront(MakeCell(200));
+    loaded.PopBack();
+    loaded.PushFront(MakeCell(200));
+    EXPECT_EQ(Hash(loaded), Hash(wrapped));
+}
+
+// Test that a damaged body snapshot is rejected
+TEST(SnakeBodyTest, RejectsBadSnapshot) {
+    SnapshotWriter writer;
+    writer.Write(static_cast<uint64_t>(MAX_ENTITIES + 1));
+    SnakeBody body;
+    SnapshotReader tooLong(writer.GetData(), writer.GetSize());
+    body.ReadSnapshot(tooLong);
+    EXPECT_FALSE(tooLong.IsOk());
+    EXPECT_TRUE(body.IsEmpty());
+
+    SnakeBody source;
+    source.PushBack(MakeCell(1));
+    source.PushBack(MakeCell(2));
+    SnapshotWriter full;
+    source.WriteSnapshot(full);
+    SnapshotReader truncated(full.GetData(), full.GetSize() - 2);
+    body.ReadSnapshot(truncated);
+    EXPECT_FALSE(truncated.IsOk());
+}
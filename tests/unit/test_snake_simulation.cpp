@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include "Game/SnakeSimulation.h"
+
+using namespace Lite2D::ECS;
+
+namespace {
+
+bool IsReverse(SnakeHead::Direction a, SnakeHead::Direction b) {
+    return (a == SnakeHead::UP && b == SnakeHead::DOWN) ||
+           (a == SnakeHead::DOWN && b == SnakeHead::UP) ||
+           (a == SnakeHead::LEFT && b == SnakeHead::RIGHT) ||
+           (a == SnakeHead::RIGHT && b == SnakeHead::LEFT);
+}
+
+} // namespace
+
+// Test that a seed and policy replay the same game
+TEST(SnakeSimulationTest, RunIsDeterministic) {
+    SnakeSimulation first;
+    SnakeSimulation second;
+    SnakeGameResult a = first.Run(7, SnakeSimulation::GreedyPolicy, 500);
+    SnakeGameResult b = second.Run(7, SnakeSimulation::GreedyPolicy, 500);
+    EXPECT_EQ(a.stateHash, b.stateHash);
+    EXPECT_EQ(a.score, b.score);
+    EXPECT_EQ(a.steps, b.steps);
+
+    // Reusing an instance gives the same game as a fresh one
+    SnakeGameResult again = first.Run(7, SnakeSimulation::GreedyPolicy, 500);
+    EXPECT_EQ(again.stateHash, a.stateHash);
+}
+
+// Test that batch results do not depend on the thread count
+TEST(SnakeSimulationTest, BatchMatchesAcrossThreadCounts) {
+    const size_t games = 64;
+    SnakeBatchResult single = SnakeSimulation::RunBatch(games, SnakeSimulation::GreedyPolicy, 1, 1, 300);
+    SnakeBatchResult multi = SnakeSimulation::RunBatch(games, SnakeSimulation::GreedyPolicy, 4, 1, 300);
+
+    EXPECT_EQ(single.threads, 1u);
+    EXPECT_EQ(single.games, games);
+    EXPECT_EQ(multi.games, games);
+    EXPECT_EQ(single.stateHash, multi.stateHash);
+    EXPECT_EQ(single.totalSteps, multi.totalSteps);
+    EXPECT_EQ(single.deaths, multi.deaths);
+    EXPECT_EQ(single.bestScore, multi.bestScore);
+
+    // A different seed range plays different games
+    SnakeBatchResult shifted = SnakeSimulation::RunBatch(games, SnakeSimulation::GreedyPolicy, 4, 1000, 300);
+    EXPECT_NE(shifted.stateHash, single.stateHash);
+}
+
+// Test that the greedy bot never asks to reverse, and only picks a blocked cell when boxed in
+TEST(SnakeSimulationTest, GreedyPolicyNeverReverses) {
+    SnakeSimulation simulation;
+    const float cell = simulation.GetCellSize();
+    int checked = 0;
+
+    for (uint32_t seed = 1; seed <= 8; ++seed) {
+        simulation.Reset(seed);
+        while (!simulation.IsGameOver() && simulation.GetSteps() < 2000) {
+            SnakeHead::Direction current = simulation.GetDirection();
+            SnakeHead::Direction chosen = SnakeSimulation::GreedyPolicy(simulation);
+            ASSERT_FALSE(IsReverse(current, chosen)) << "seed " << seed << " step " << simulation.GetSteps();
+
+            float x, y;
+            simulation.GetHeadPosition(x, y);
+            float dx = 0.0f, dy = 0.0f;
+            if (chosen == SnakeHead::UP) dy = -cell;
+            else if (chosen == SnakeHead::DOWN) dy = cell;
+            else if (chosen == SnakeHead::LEFT) dx = -cell;
+            else dx = cell;
+
+            if (simulation.IsBlocked(x + dx, y + dy)) {
+                // Boxed in: keeps going, since every legal move is blocked
+                EXPECT_EQ(chosen, current);
+            }
+            ++checked;
+            if (!simulation.Step(chosen)) break;
+        }
+    }
+    EXPECT_GT(checked, 100);
+}
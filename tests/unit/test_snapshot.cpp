@@ -0,0 +1,255 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include "ECS/EntityManager.h"
+#include "ECS/ComponentArray.h"
+#include "ECS/Snapshot.h"
+#include "ECS/StateHash.h"
+#include "ECS/Components/Position.h"
+#include "ECS/Components/Velocity.h"
+#include "ECS/Components/Renderable.h"
+#include "ECS/Components/Emitter.h"
+#include "Utils/MappedFile.h"
+
+using namespace Lite2D;
+using namespace Lite2D::ECS;
+
+namespace {
+
+uint64_t HashOf(const EntityManager& entityManager) {
+    StateHasher hasher;
+    entityManager.HashState(hasher);
+    return hasher.GetHash();
+}
+
+// Mixed signatures plus a free list, so every table in the snapshot has content
+void Populate(EntityManager& entityManager, int count) {
+    for (int i = 0; i < count; ++i) {
+        Entity entity = entityManager.CreateEntity();
+        entityManager.AddComponent(entity, Position(i * 1.5f, -i * 0.25f));
+        if (i % 2 == 0) entityManager.AddComponent(entity, Velocity(i * 0.1f, 3.0f));
+        if (i % 3 == 0) entityManager.AddComponent(entity, Renderable(i % 6 == 0, i % 4));
+    }
+
+    Entity emitter = entityManager.CreateEntity();
+    Emitter settings(250.0f, 4096, 2);
+    settings.startColor = {1, 2, 3, 4};
+    settings.burst = 17;
+    entityManager.AddComponent(emitter, Position(5.0f, 6.0f));
+    entityManager.AddComponent(emitter, settings);
+
+    for (Entity entity = 3; entity < static_cast<Entity>(count); entity += 7) {
+        entityManager.DestroyEntity(entity);
+    }
+}
+
+void RegisterTypes(EntityManager& entityManager) {
+    entityManager.RegisterComponentType<Position>();
+    entityManager.RegisterComponentType<Velocity>();
+    entityManager.RegisterComponentType<Renderable>();
+    entityManager.RegisterComponentType<Emitter>();
+}
+
+// No snapshot overrides: restored default-constructed
+class Marker : public Component {
+public:
+    int value = 5;
+
+    Component* Clone() const override { return new Marker(*this); }
+    const char* GetTypeName() const override { return "Marker"; }
+    static const char* GetTypeNameStatic() { return "Marker"; }
+};
+
+} // namespace
+
+// Test that a restored manager is indistinguishable from the original
+TEST(SnapshotTest, RoundTripRestoresEverything) {
+    EntityManager original;
+    RegisterTypes(original);
+    Populate(original, 500);
+
+    SnapshotWriter writer;
+    original.SaveSnapshot(writer);
+
+    EntityManager restored;
+    RegisterTypes(restored);
+    Populate(restored, 20); // Existing contents are replaced
+    SnapshotReader reader(writer.GetData(), writer.GetSize());
+    ASSERT_TRUE(restored.LoadSnapshot(reader));
+    EXPECT_EQ(reader.GetRemaining(), 0u);
+
+    EXPECT_EQ(HashOf(restored), HashOf(original));
+    EXPECT_EQ(restored.GetEntityCount(), original.GetEntityCount());
+    EXPECT_EQ((restored.GetEntitiesWith<Position, Velocity>()), (original.GetEntitiesWith<Position, Velocity>()));
+    EXPECT_FALSE(restored.IsValid(3));
+
+    Entity emitter = original.GetEntitiesWith<Emitter>().front();
+    Emitter* settings = restored.GetComponent<Emitter>(emitter);
+    ASSERT_NE(settings, nullptr);
+    EXPECT_EQ(settings->maxParticles, 4096u);
+    EXPECT_EQ(settings->startColor.b, 3);
+    EXPECT_EQ(settings->burst, 17);
+
+    // ID allocation continues exactly where the original left off
+    EXPECT_EQ(restored.CreateEntity(), original.CreateEntity());
+    EXPECT_EQ(restored.CreateEntity(), original.CreateEntity());
+}
+
+// Test that pools are matched by name when types were registered in another order
+TEST(SnapshotTest, RemapsComponentTypes) {
+    EntityManager original;
+    RegisterTypes(original);
+    Populate(original, 100);
+
+    SnapshotWriter writer;
+    original.SaveSnapshot(writer);
+
+    EntityManager restored;
+    restored.RegisterComponentType<Emitter>();
+    restored.RegisterComponentType<Renderable>();
+    restored.RegisterComponentType<Velocity>();
+    restored.RegisterComponentType<Position>();
+    SnapshotReader reader(writer.GetData(), writer.GetSize());
+    ASSERT_TRUE(restored.LoadSnapshot(reader));
+
+    EXPECT_EQ((restored.GetEntitiesWith<Position, Velocity>()), (original.GetEntitiesWith<Position, Velocity>()));
+    EXPECT_EQ(restored.GetEntitiesWith<Renderable>(), original.GetEntitiesWith<Renderable>());
+    ASSERT_NE(restored.GetComponent<Velocity>(5), nullptr);
+    EXPECT_EQ(restored.GetComponent<Velocity>(5)->x, original.GetComponent<Velocity>(5)->x);
+}
+
+// Test reloading over a world of the same shape, the restart case
+TEST(SnapshotTest, ReloadOverwritesInPlace) {
+    EntityManager entityManager;
+    RegisterTypes(entityManager);
+    Populate(entityManager, 100);
+    Entity marked = entityManager.CreateEntity();
+    entityManager.AddComponent(marked, Marker());
+
+    SnapshotWriter writer;
+    entityManager.SaveSnapshot(writer);
+    const uint64_t saved = HashOf(entityManager);
+
+    entityManager.GetComponent<Position>(1)->x = 99.0f;
+    entityManager.GetComponent<Marker>(marked)->value = 9;
+    entityManager.DestroyEntity(2);
+
+    SnapshotReader reader(writer.GetData(), writer.GetSize());
+    ASSERT_TRUE(entityManager.LoadSnapshot(reader));
+    EXPECT_EQ(HashOf(entityManager), saved);
+    EXPECT_EQ(entityManager.GetComponent<Position>(1)->x, 0.0f);
+    EXPECT_EQ(entityManager.GetComponent<Marker>(marked)->value, 5);
+}
+
+// Test that unknown component types and damaged data are rejected without crashing
+TEST(SnapshotTest, RejectsBadSnapshots) {
+    EntityManager original;
+    RegisterTypes(original);
+    Populate(original, 50);
+
+    SnapshotWriter writer;
+    original.SaveSnapshot(writer);
+
+    EntityManager missingType;
+    missingType.RegisterComponentType<Position>();
+    SnapshotReader reader(writer.GetData(), writer.GetSize());
+    EXPECT_FALSE(missingType.LoadSnapshot(reader));
+    EXPECT_EQ(missingType.GetEntityCount(), 0u);
+
+    for (size_t size = 0; size < writer.GetSize(); size += 37) {
+        EntityManager truncated;
+        RegisterTypes(truncated);
+        SnapshotReader partial(writer.GetData(), size);
+        EXPECT_FALSE(truncated.LoadSnapshot(partial)) << "size " << size;
+        EXPECT_EQ(truncated.GetEntityCount(), 0u);
+    }
+}
+
+// Test that entity-to-index entries pointing past the pool, or at a slot another entity owns, are rejected
+TEST(SnapshotTest, RejectsCorruptPoolIndex) {
+    ComponentArray<Position> pool;
+    Position a(1.0f, 2.0f);
+    Position b(3.0f, 4.0f);
+    pool.InsertData(1, &a);
+    pool.InsertData(2, &b);
+    pool.RemoveData(2);
+
+    SnapshotWriter writer;
+    pool.WriteSnapshot(writer);
+
+    // uint64 size, one index-to-entity entry, uint64 map length, then the map itself
+    const size_t mapOffset = sizeof(uint64_t) + sizeof(Entity) + sizeof(uint64_t);
+    auto loadWithSlot = [&](Entity entity, Entity slot) {
+        std::vector<uint8_t> data(writer.GetData(), writer.GetData() + writer.GetSize());
+        std::memcpy(data.data() + mapOffset + entity * sizeof(Entity), &slot, sizeof(slot));
+        ComponentArray<Position> restored;
+        SnapshotReader reader(data.data(), data.size());
+        bool loaded = restored.ReadSnapshot(reader);
+        EXPECT_EQ(loaded, reader.IsOk());
+        if (!loaded) {
+            EXPECT_EQ(restored.GetData(2), nullptr);
+        }
+        return loaded;
+    };
+
+    EXPECT_TRUE(loadWithSlot(2, MAX_ENTITIES)); // Unchanged
+    EXPECT_FALSE(loadWithSlot(2, 100000));      // Past the one-element pool
+    EXPECT_FALSE(loadWithSlot(2, 0));           // Aliases entity 1's slot
+}
+
+// Test the file round trip
+TEST(SnapshotTest, SaveAndLoadFile) {
+    EntityManager original;
+    RegisterTypes(original);
+    Populate(original, 200);
+
+    const std::string path = ::testing::TempDir() + "lite2d_snapshot_test.bin";
+    ASSERT_TRUE(original.SaveSnapshot(path));
+
+    EntityManager restored;
+    RegisterTypes(restored);
+    ASSERT_TRUE(restored.LoadSnapshot(path));
+    EXPECT_EQ(HashOf(restored), HashOf(original));
+    std::remove(path.c_str());
+
+    EXPECT_FALSE(restored.LoadSnapshot(path));
+}
+
+// Test that a mapped file exposes exactly the bytes written
+TEST(SnapshotTest, MappedFileMatchesWrittenBytes) {
+    EntityManager original;
+    RegisterTypes(original);
+    Populate(original, 300);
+
+    SnapshotWriter writer;
+    original.SaveSnapshot(writer);
+    const std::string path = ::testing::TempDir() + "lite2d_mapped_test.bin";
+    ASSERT_TRUE(writer.SaveToFile(path));
+
+    MappedFile file;
+    ASSERT_TRUE(file.Open(path));
+    ASSERT_EQ(file.GetSize(), writer.GetSize());
+    EXPECT_EQ(std::memcmp(file.GetData(), writer.GetData(), writer.GetSize()), 0);
+
+    // Moving hands over the mapping
+    MappedFile moved = std::move(file);
+    EXPECT_FALSE(file.IsOpen());
+    EXPECT_TRUE(moved.IsOpen());
+    EntityManager restored;
+    RegisterTypes(restored);
+    SnapshotReader reader(moved.GetData(), moved.GetSize());
+    ASSERT_TRUE(restored.LoadSnapshot(reader));
+    EXPECT_EQ(HashOf(restored), HashOf(original));
+    moved.Close();
+
+    // Empty files open with no data; parsing them fails cleanly
+    SnapshotWriter empty;
+    ASSERT_TRUE(empty.SaveToFile(path));
+    ASSERT_TRUE(moved.Open(path));
+    EXPECT_EQ(moved.GetSize(), 0u);
+    EXPECT_FALSE(restored.LoadSnapshot(path));
+    moved.Close();
+
+    std::remove(path.c_str());
+    EXPECT_FALSE(moved.Open(path));
+}
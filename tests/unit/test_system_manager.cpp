@@ -228,3 +228,74 @@ TEST_F(SystemManagerTest, MultipleSystems) {
     EXPECT_NE(movementSystem, nullptr);
     EXPECT_NE(renderSystem, nullptr);
 }
+
+// Allocation counter stand-in for profiler tests
+static size_t gFakeAllocations = 0;
+static size_t FakeAllocationCounter() {
+    return gFakeAllocations += 2;
+}
+
+// Test per-system profiling
+TEST_F(SystemManagerTest, ProfileSystems) {
+    auto movementSystem = systemManager->RegisterSystem<MovementSystem>();
+    
+    for (int i = 0; i < 5; ++i) {
+        Entity entity = entityManager->CreateEntity();
+        entityManager->AddComponent(entity, Position(0.0f, 0.0f));
+        entityManager->AddComponent(entity, Velocity(1.0f, 1.0f));
+    }
+    
+    // Disabled by default, nothing is recorded
+    EXPECT_FALSE(systemManager->IsProfilingEnabled());
+    systemManager->UpdateSystems(*entityManager, 0.016f);
+    const SystemStats* stats = systemManager->GetSystemStats("MovementSystem");
+    ASSERT_NE(stats, nullptr);
+    EXPECT_EQ(stats->GetSampleCount(), 0u);
+    EXPECT_FALSE(stats->IsAllocated()); // No history held until profiling is on
+    
+    systemManager->EnableProfiling(true);
+    EXPECT_TRUE(stats->IsAllocated());
+    systemManager->SetAllocationCounter(&FakeAllocationCounter);
+    for (int i = 0; i < 10; ++i) {
+        systemManager->UpdateSystems(*entityManager, 0.016f);
+    }
+    
+    EXPECT_EQ(stats->GetSampleCount(), 10u);
+    EXPECT_EQ(stats->GetLastSample().entityCount, 5u);
+    EXPECT_EQ(stats->GetLastSample().allocations, 2u);
+    EXPECT_LE(stats->GetMinMilliseconds(), stats->GetAverageMilliseconds());
+    EXPECT_LE(stats->GetAverageMilliseconds(), stats->GetMaxMilliseconds());
+    EXPECT_LE(stats->GetP99Milliseconds(), stats->GetMaxMilliseconds());
+    
+    EXPECT_EQ(systemManager->GetSystemStats("NoSuchSystem"), nullptr);
+    
+    systemManager->ResetProfiling();
+    EXPECT_EQ(stats->GetSampleCount(), 0u);
+    
+    // Off keeps the storage until it is released
+    systemManager->EnableProfiling(false);
+    EXPECT_TRUE(stats->IsAllocated());
+    systemManager->ReleaseProfiling();
+    EXPECT_FALSE(stats->IsAllocated());
+}
+
+// Test ring buffer history and percentile
+TEST_F(SystemManagerTest, SystemStatsHistory) {
+    SystemStats stats;
+    
+    // Overfill the ring, only the newest HISTORY_SIZE samples remain
+    for (size_t i = 0; i < SystemStats::HISTORY_SIZE + 10; ++i) {
+        SystemFrameSample sample;
+        sample.milliseconds = static_cast<float>(i);
+        stats.AddSample(sample);
+    }
+    
+    EXPECT_EQ(stats.GetSampleCount(), SystemStats::HISTORY_SIZE);
+    EXPECT_FLOAT_EQ(stats.GetSample(0).milliseconds, 10.0f);
+    EXPECT_FLOAT_EQ(stats.GetMinMilliseconds(), 10.0f);
+    EXPECT_FLOAT_EQ(stats.GetMaxMilliseconds(), static_cast<float>(SystemStats::HISTORY_SIZE + 9));
+    EXPECT_FLOAT_EQ(stats.GetLastSample().milliseconds, static_cast<float>(SystemStats::HISTORY_SIZE + 9));
+    
+    // Nearest-rank p99 of 10..249 is the 238th value
+    EXPECT_FLOAT_EQ(stats.GetP99Milliseconds(), 247.0f);
+}
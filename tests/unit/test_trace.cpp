@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <sstream>
+#include <thread>
+#include "Utils/Trace.h"
+
+using namespace Lite2D;
+
+// Test that markers record only during a capture
+TEST(TraceTest, RecordsOnlyWhileCapturing) {
+    Trace::Start();
+    Trace::Stop();
+    EXPECT_EQ(Trace::GetEventCount(), 0u);
+
+    {
+        LITE2D_TRACE_SCOPE("Outside");
+    }
+    EXPECT_EQ(Trace::GetEventCount(), 0u);
+
+    Trace::Start();
+    EXPECT_TRUE(Trace::IsCapturing());
+    {
+        LITE2D_TRACE_SCOPE("Outer");
+        LITE2D_TRACE_SCOPE("Inner");
+    }
+    Trace::Stop();
+
+#if LITE2D_TRACING_ENABLED
+    EXPECT_EQ(Trace::GetEventCount(), 2u);
+#else
+    EXPECT_EQ(Trace::GetEventCount(), 0u);
+#endif
+}
+
+// Test Chrome JSON export with events from several threads
+TEST(TraceTest, WriteChromeTrace) {
+    Trace::Start();
+    {
+        LITE2D_TRACE_SCOPE("MainThreadWork");
+        std::thread worker([] {
+            Trace::SetThreadName("Test Worker");
+            LITE2D_TRACE_SCOPE("WorkerThreadWork");
+        });
+        worker.join();
+    }
+    Trace::Stop();
+
+    const std::string path = "trace_test.json";
+    ASSERT_TRUE(Trace::WriteChromeTrace(path));
+
+    std::ifstream in(path);
+    std::stringstream contents;
+    contents << in.rdbuf();
+    std::string json = contents.str();
+    in.close();
+    std::remove(path.c_str());
+
+    EXPECT_NE(json.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(json.find("\"Test Worker\""), std::string::npos);
+#if LITE2D_TRACING_ENABLED
+    EXPECT_NE(json.find("\"MainThreadWork\""), std::string::npos);
+    EXPECT_NE(json.find("\"WorkerThreadWork\""), std::string::npos);
+    EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+#endif
+}
+
+// Test that exited threads' buffers are reused and released instead of piling up
+TEST(TraceTest, RecyclesExitedThreadBuffers) {
+    Trace::Start();
+    Trace::Stop();
+    const size_t baseline = Trace::GetBufferMemory();
+
+    // Naming a thread doesn't allocate event storage
+    std::thread([] { Trace::SetThreadName("Idle Worker"); }).join();
+    EXPECT_EQ(Trace::GetBufferMemory(), baseline);
+
+#if LITE2D_TRACING_ENABLED
+    // A recording thread's buffer survives it for export, then goes with the next Start()
+    Trace::Start();
+    std::thread([] { LITE2D_TRACE_SCOPE("ShortLived"); }).join();
+    Trace::Stop();
+    EXPECT_EQ(Trace::GetEventCount(), 1u);
+    const size_t oneWorker = Trace::GetBufferMemory();
+    EXPECT_GT(oneWorker, baseline);
+
+    Trace::Start();
+    EXPECT_EQ(Trace::GetBufferMemory(), baseline);
+
+    // Threads that come and go between captures don't pile up
+    for (int i = 0; i < 8; ++i) {
+        std::thread([] { LITE2D_TRACE_SCOPE("Sequential"); }).join();
+        Trace::Stop();
+        Trace::Start();
+    }
+    EXPECT_EQ(Trace::GetBufferMemory(), baseline);
+
+    // A thread that outlived its capture hands its emptied buffer to the next thread
+    std::promise<void> recorded;
+    std::promise<void> exit;
+    std::thread longLived([&] {
+        { LITE2D_TRACE_SCOPE("LongLived"); }
+        recorded.set_value();
+        exit.get_future().wait();
+    });
+    recorded.get_future().wait();
+    Trace::Stop();
+    Trace::Start(); // Discards its event while it is still running
+    exit.set_value();
+    longLived.join();
+    EXPECT_EQ(Trace::GetBufferMemory(), oneWorker);
+
+    std::thread([] { LITE2D_TRACE_SCOPE("Reuser"); }).join();
+    Trace::Stop();
+    EXPECT_EQ(Trace::GetBufferMemory(), oneWorker);
+    EXPECT_EQ(Trace::GetEventCount(), 1u);
+#endif
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include "ECS/World.h"
+#include "ECS/WorldScheduler.h"
+#include "ECS/Systems/MovementSystem.h"
+#include "Systems/CollisionSystem.h"
+#include "ECS/Components/Position.h"
+#include "ECS/Components/Velocity.h"
+#include "Utils/AllocationTracker.h"
+#include "Utils/ThreadPool.h"
+
+using namespace Lite2D;
+using namespace Lite2D::ECS;
+
+// Test that worlds share no entities, components or random state
+TEST(WorldTest, WorldsAreIsolated) {
+    World first(7);
+    World second(7);
+
+    Entity a = first.GetEntityManager().CreateEntity();
+    Entity b = second.GetEntityManager().CreateEntity();
+    EXPECT_EQ(a, b); // Each world numbers its own entities
+
+    first.GetEntityManager().AddComponent(a, Position(1.0f, 2.0f));
+    EXPECT_TRUE(first.GetEntityManager().HasComponent<Position>(a));
+    EXPECT_FALSE(second.GetEntityManager().HasComponent<Position>(b));
+
+    // Same seed, same stream, advanced independently
+    EXPECT_EQ(first.GetRandom()(), second.GetRandom()());
+    first.GetRandom()();
+    EXPECT_NE(first.GetRandom()(), second.GetRandom()());
+}
+
+// Test that a typical world (movement plus render-less collision, 100 bodies) stays small:
+// entity storage grows with use and systems hold no profiler history unless profiled
+TEST(WorldTest, SmallFootprint) {
+    if (!AllocationTracker::IsEnabled()) {
+        GTEST_SKIP() << "Allocation hooks not linked";
+    }
+
+    AllocationTracker::Scope scope;
+    {
+        auto world = std::make_unique<World>(1);
+        auto movement = world->AddSystem<MovementSystem>();
+        movement->SetBoundaries(0, 0, 800, 600);
+        movement->EnableBoundaryClamping(true);
+        world->AddSystem<CollisionSystem>()->SetBoundaries(0, 0, 800, 600);
+        world->Initialize();
+
+        EntityManager& entityManager = world->GetEntityManager();
+        for (int i = 0; i < 100; ++i) {
+            Entity entity = entityManager.CreateEntity();
+            entityManager.AddComponent(entity, Position(i * 8.0f, i * 6.0f));
+            entityManager.AddComponent(entity, Velocity(1.0f, 1.0f));
+            entityManager.AddComponent(entity, Particle(3.0f));
+        }
+        for (int frame = 0; frame < 10; ++frame) {
+            world->Step(0.016f);
+        }
+        world->Shutdown();
+    }
+
+    // Fixed MAX_ENTITIES arrays alone were ~80 KB of signatures plus ~200 KB per component
+    // type, and an always-allocated profiler ring was ~8.6 KB per system
+    EXPECT_LT(scope.GetStats().bytes, 48u * 1024u);
+}
+
+// Test that IDs are recycled before new ones are issued and validity is tracked
+TEST(WorldTest, EntityIdsRecycled) {
+    EntityManager entityManager;
+    Entity first = entityManager.CreateEntity();
+    Entity second = entityManager.CreateEntity();
+
+    entityManager.DestroyEntity(first);
+    EXPECT_FALSE(entityManager.IsValid(first));
+    EXPECT_TRUE(entityManager.IsValid(second));
+
+    Entity reused = entityManager.CreateEntity();
+    EXPECT_EQ(reused, first);
+    EXPECT_TRUE(entityManager.IsValid(reused));
+    EXPECT_FALSE(entityManager.HasComponent<Position>(reused));
+}
+
+// Test that the scheduler steps every world, spread over the pool's threads
+TEST(WorldTest, SchedulerStepsAllWorlds) {
+    ThreadPool threadPool(4);
+    WorldScheduler scheduler(threadPool);
+
+    const int worldCount = 64;
+    for (int i = 0; i < worldCount; ++i) {
+        World& world = scheduler.CreateWorld(static_cast<uint32_t>(i));
+        world.AddSystem<MovementSystem>();
+
+        EntityManager& entityManager = world.GetEntityManager();
+        for (int e = 0; e <= i % 8; ++e) {
+            Entity entity = entityManager.CreateEntity();
+            entityManager.AddComponent(entity, Position(0.0f, 0.0f));
+            entityManager.AddComponent(entity, Velocity(static_cast<float>(i), 0.0f));
+        }
+    }
+    scheduler.InitializeAll();
+
+    scheduler.StepAll(0.5f, 4);
+    scheduler.StepAll(0.5f);
+
+    for (int i = 0; i < worldCount; ++i) {
+        World& world = scheduler.GetWorld(i);
+        EXPECT_EQ(world.GetFrameCount(), 5u);
+
+        EntityManager& entityManager = world.GetEntityManager();
+        for (Entity entity : entityManager.GetEntitiesWith<Position>()) {
+            EXPECT_FLOAT_EQ(entityManager.GetComponent<Position>(entity)->x, i * 2.5f);
+        }
+    }
+
+    scheduler.DestroyWorld(scheduler.GetWorld(0));
+    EXPECT_EQ(scheduler.GetWorldCount(), static_cast<size_t>(worldCount - 1));
+}